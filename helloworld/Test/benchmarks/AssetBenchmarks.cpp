@@ -0,0 +1,114 @@
+#include "Benchmark.h"
+#include "GameObject.h"
+#include "ComponentMesh.h"
+#include "TextureImporter.h"
+#include <assimp/Importer.hpp>
+#include <assimp/scene.h>
+#include <assimp/postprocess.h>
+#include <IL/il.h>
+#include <fstream>
+#include <iterator>
+
+namespace
+{
+    std::vector<unsigned char> ReadFile(const std::string& path)
+    {
+        std::ifstream file(path, std::ios::binary);
+        return std::vector<unsigned char>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+
+    // Decodifica como TextureManager::DecodeJob: cualquier formato de DevIL a RGBA8
+    bool DecodeRGBA(const std::vector<unsigned char>& bytes, std::vector<unsigned char>* pixels, int& width, int& height)
+    {
+        ILuint image;
+        ilGenImages(1, &image);
+        ilBindImage(image);
+
+        const bool loaded = ilLoadL(IL_TYPE_UNKNOWN, bytes.data(), (ILuint)bytes.size()) == IL_TRUE;
+        if (loaded)
+        {
+            ilConvertImage(IL_RGBA, IL_UNSIGNED_BYTE);
+            width = ilGetInteger(IL_IMAGE_WIDTH);
+            height = ilGetInteger(IL_IMAGE_HEIGHT);
+            if (pixels)
+                pixels->assign(ilGetData(), ilGetData() + (size_t)width * height * 4);
+        }
+
+        ilDeleteImages(1, &image);
+        return loaded;
+    }
+}
+
+void RegisterAssetBenchmarks(const std::string& modelPath, const std::string& texturePath)
+{
+    // Importación completa de la malla más grande del modelo: vértices, colisión,
+    // LODs y subida a la GPU. ns por triángulo
+    Benchmark::Register("ComponentMesh::LoadMesh", false, [modelPath](Benchmark::State& state)
+    {
+        // Mismos pasos que ModuleScene::LoadModel
+        Assimp::Importer importer;
+        const aiScene* scene = importer.ReadFile(modelPath,
+            aiProcess_Triangulate | aiProcess_FlipUVs | aiProcess_GenNormals | aiProcess_JoinIdenticalVertices);
+        if (!scene || scene->mNumMeshes == 0)
+        {
+            state.Skip("could not load " + modelPath);
+            return;
+        }
+
+        const aiMesh* largest = scene->mMeshes[0];
+        for (unsigned int i = 1; i < scene->mNumMeshes; ++i)
+        {
+            if (scene->mMeshes[i]->mNumFaces > largest->mNumFaces)
+                largest = scene->mMeshes[i];
+        }
+
+        GameObject owner("Benchmark Mesh");
+        state.Measure([&]()
+        {
+            ComponentMesh mesh(&owner);
+            mesh.LoadMesh(largest);
+            Benchmark::Consume(mesh.GetIndexCount());
+        }, largest->mNumFaces);
+    });
+
+    // ns por píxel
+    Benchmark::Register("Texture decode (DevIL to RGBA8)", false, [texturePath](Benchmark::State& state)
+    {
+        const std::vector<unsigned char> bytes = ReadFile(texturePath);
+        int width = 0, height = 0;
+        if (bytes.empty() || !DecodeRGBA(bytes, nullptr, width, height))
+        {
+            state.Skip("could not decode " + texturePath);
+            return;
+        }
+
+        state.Measure([&]()
+        {
+            int decodedWidth = 0, decodedHeight = 0;
+            DecodeRGBA(bytes, nullptr, decodedWidth, decodedHeight);
+            Benchmark::Consume(decodedWidth);
+        }, (size_t)width * height);
+    });
+
+    // Compresión BCn del nivel base en la importación; ns por píxel
+    Benchmark::Register("TextureImporter::CompressLevel", false, [texturePath](Benchmark::State& state)
+    {
+        const std::vector<unsigned char> bytes = ReadFile(texturePath);
+        std::vector<unsigned char> pixels;
+        int width = 0, height = 0;
+        if (bytes.empty() || !DecodeRGBA(bytes, &pixels, width, height))
+        {
+            state.Skip("could not decode " + texturePath);
+            return;
+        }
+
+        const TextureImporter::Format format = TextureImporter::ChooseFormat(pixels.data(), width, height);
+        state.Measure([&]()
+        {
+            TextureImporter::CompressedImage image;
+            image.format = format;
+            TextureImporter::CompressLevel(pixels.data(), width, height, image);
+            Benchmark::Consume(image.data.size());
+        }, (size_t)width * height);
+    });
+}
@@ -0,0 +1,182 @@
+#include "Benchmark.h"
+#include "FileUtils.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+
+std::vector<Benchmark::Case> Benchmark::cases;
+std::vector<Benchmark::Result> Benchmark::results;
+Benchmark::Settings Benchmark::settings;
+Benchmark::Result* Benchmark::current = nullptr;
+
+namespace
+{
+    // Tope de llamadas por repetición (kernels de pocos ns)
+    const uint64_t MaxBatch = 1ull << 30;
+
+    double NowNs()
+    {
+        return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    void WriteEscaped(std::ostream& out, const std::string& text)
+    {
+        for (char c : text)
+        {
+            if (c == '"' || c == '\\')
+                out << '\\';
+            out << c;
+        }
+    }
+}
+
+void Benchmark::Register(const char* name, bool scalable, Function function)
+{
+    Case entry;
+    entry.name = name;
+    entry.scalable = scalable;
+    entry.function = std::move(function);
+    cases.push_back(std::move(entry));
+}
+
+void Benchmark::State::Measure(const std::function<void()>& kernel, size_t itemsPerCall)
+{
+    Result& result = *current;
+    measured = true;
+
+    // Primera llamada: calienta cachés y da la estimación para el tamaño de lote
+    double start = NowNs();
+    kernel();
+    const double estimate = std::max(NowNs() - start, 1.0);
+
+    const double budget = settings.minTime * 1e9 / settings.repetitions;
+    const uint64_t batch = std::min(std::max((uint64_t)(budget / estimate), (uint64_t)1), MaxBatch);
+
+    std::vector<double> samples;
+    samples.reserve(settings.repetitions);
+    for (int repetition = 0; repetition < settings.repetitions; ++repetition)
+    {
+        start = NowNs();
+        for (uint64_t i = 0; i < batch; ++i)
+            kernel();
+        samples.push_back((NowNs() - start) / (double)batch);
+    }
+
+    std::sort(samples.begin(), samples.end());
+    result.iterations = batch * samples.size();
+    result.itemsPerCall = std::max(itemsPerCall, (size_t)1);
+    result.nsPerCall = samples[samples.size() / 2];
+    result.minNsPerCall = samples.front();
+    result.maxNsPerCall = samples.back();
+}
+
+void Benchmark::State::Skip(const std::string& reason)
+{
+    current->skipped = reason;
+    measured = true;
+}
+
+void Benchmark::RunAll(const Settings& runSettings)
+{
+    settings = runSettings;
+    settings.repetitions = std::max(settings.repetitions, 1);
+    results.clear();
+
+    for (const Case& entry : cases)
+    {
+        if (!settings.filter.empty() && entry.name.find(settings.filter) == std::string::npos)
+            continue;
+
+        std::vector<size_t> sizes = entry.scalable ? settings.sizes : std::vector<size_t>(1, 0);
+        for (size_t size : sizes)
+        {
+            Result result;
+            result.name = entry.name;
+            result.size = size;
+
+            State state;
+            state.size = size;
+            current = &result;
+            entry.function(state);
+            current = nullptr;
+
+            if (!state.measured)
+                result.skipped = "nothing measured";
+
+            Print(result);
+            results.push_back(result);
+        }
+    }
+}
+
+void Benchmark::Print(const Result& result)
+{
+    char line[256];
+    if (!result.skipped.empty())
+    {
+        snprintf(line, sizeof(line), "%-44s %9zu   skipped: %s", result.name.c_str(), result.size, result.skipped.c_str());
+    }
+    else
+    {
+        snprintf(line, sizeof(line), "%-44s %9zu %14.1f ns/call %10.2f ns/item %12llu calls",
+            result.name.c_str(), result.size, result.nsPerCall, result.nsPerCall / result.itemsPerCall,
+            (unsigned long long)result.iterations);
+    }
+    std::cout << line << std::endl;
+}
+
+bool Benchmark::WriteJson(const std::string& path)
+{
+    size_t slash = path.find_last_of("/\\");
+    if (slash != std::string::npos)
+        FileUtils::CreateDirectories(path.substr(0, slash));
+
+    std::ofstream file(path, std::ios::trunc);
+    if (!file)
+    {
+        std::cerr << "[Benchmark] Could not write " << path << std::endl;
+        return false;
+    }
+
+    // Una fila por caso y tamaño: se puede cargar tal cual en una hoja o en pandas
+    char numbers[256];
+    file << "{\"min_time_s\":" << settings.minTime << ",\"repetitions\":" << settings.repetitions << ",\"results\":[\n";
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        const Result& result = results[i];
+        file << (i ? ",\n" : "") << "{\"name\":\"";
+        WriteEscaped(file, result.name);
+        file << "\",\"size\":" << result.size;
+        if (!result.skipped.empty())
+        {
+            file << ",\"skipped\":\"";
+            WriteEscaped(file, result.skipped);
+            file << "\"}";
+            continue;
+        }
+
+        snprintf(numbers, sizeof(numbers),
+            ",\"iterations\":%llu,\"items_per_call\":%zu,\"ns_per_call\":%.3f,\"min_ns_per_call\":%.3f,"
+            "\"max_ns_per_call\":%.3f,\"ns_per_item\":%.4f}",
+            (unsigned long long)result.iterations, result.itemsPerCall, result.nsPerCall, result.minNsPerCall,
+            result.maxNsPerCall, result.nsPerCall / result.itemsPerCall);
+        file << numbers;
+    }
+    file << "\n]}\n";
+
+    if (!file)
+    {
+        std::cerr << "[Benchmark] Could not write " << path << std::endl;
+        return false;
+    }
+
+    std::cout << "[Benchmark] " << results.size() << " results written to " << path << std::endl;
+    return true;
+}
+
+void Benchmark::UsePointer(const volatile char*)
+{
+}
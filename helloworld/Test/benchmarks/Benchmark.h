@@ -0,0 +1,105 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+// Arnés mínimo de microbenchmarks. Cada caso prepara sus datos y cronometra un
+// kernel con State::Measure, que lo repite hasta llenar el tiempo mínimo y se
+// queda con la mediana de varias repeticiones. Los casos escalables se ejecutan
+// una vez por cada tamaño de escena pedido (--sizes) para poder dibujar la curva.
+//
+//     Benchmark::Register("AABB::Transform", true, [](Benchmark::State& state)
+//     {
+//         std::vector<AABB> boxes = MakeBoxes(state.GetSize());
+//         state.Measure([&]() { ... }, boxes.size());
+//     });
+class Benchmark
+{
+public:
+    class State
+    {
+    public:
+        size_t GetSize() const { return size; }
+
+        // itemsPerCall: elementos que procesa una llamada (ns por elemento en el informe)
+        void Measure(const std::function<void()>& kernel, size_t itemsPerCall = 1);
+        // El caso no puede ejecutarse (falta un asset, tamaño demasiado grande...)
+        void Skip(const std::string& reason);
+
+    private:
+        friend class Benchmark;
+        size_t size = 0;
+        bool measured = false;
+    };
+
+    using Function = std::function<void(State&)>;
+
+    struct Settings
+    {
+        std::vector<size_t> sizes = { 1000, 10000, 100000 };
+        double minTime = 0.5;       // s por caso y tamaño
+        int repetitions = 5;
+        std::string filter;         // subcadena del nombre; vacía = todos
+    };
+
+    struct Result
+    {
+        std::string name;
+        size_t size = 0;            // 0 en los casos no escalables
+        uint64_t iterations = 0;
+        size_t itemsPerCall = 1;
+        double nsPerCall = 0.0;     // mediana
+        double minNsPerCall = 0.0;
+        double maxNsPerCall = 0.0;
+        std::string skipped;
+    };
+
+    // scalable: se repite para cada tamaño de Settings::sizes
+    static void Register(const char* name, bool scalable, Function function);
+
+    static void RunAll(const Settings& settings);
+    static const std::vector<Result>& GetResults() { return results; }
+    static bool WriteJson(const std::string& path);
+
+    // Evita que el compilador elimine un cálculo cuyo resultado no se usa: value
+    // entero (no solo su primer byte) tiene que existir en un registro o en
+    // memoria. Misma barrera que DoNotOptimize de Google Benchmark
+    template <typename T>
+    static void Consume(const T& value)
+    {
+#if defined(_MSC_VER) && !defined(__clang__)
+        UsePointer(&reinterpret_cast<const volatile char&>(value));
+        _ReadWriteBarrier();
+#else
+        asm volatile("" : : "r,m"(value) : "memory");
+#endif
+    }
+
+private:
+    struct Case
+    {
+        std::string name;
+        bool scalable = false;
+        Function function;
+    };
+
+    static void Print(const Result& result);
+
+    static std::vector<Case> cases;
+    static std::vector<Result> results;
+    static Settings settings;
+    static Result* current;
+
+    // Definida en Benchmark.cpp para que MSVC no pueda verla al compilar Consume
+    static void UsePointer(const volatile char* pointer);
+};
+
+// Casos de cada área (los registra BenchmarkMain)
+void RegisterCoreBenchmarks();
+void RegisterSceneBenchmarks();
+void RegisterAssetBenchmarks(const std::string& modelPath, const std::string& texturePath);
@@ -0,0 +1,133 @@
+#include "Benchmark.h"
+#include "Window.h"
+#include "Logger.h"
+#include "Profiler.h"
+#include <glad/glad.h>
+#include <IL/il.h>
+#include <cstdlib>
+#include <iostream>
+
+namespace
+{
+    void PrintUsage()
+    {
+        std::cout <<
+            "Usage: EngineBenchmarks [options]\n"
+            "  --sizes <list>          Scene sizes for scalable cases, e.g. 1k,10k,100k,1M (default 1k,10k,100k)\n"
+            "  --filter <text>         Only cases whose name contains text\n"
+            "  --min-time <seconds>    Time spent measuring each case and size (default 0.5)\n"
+            "  --repetitions <n>       Timed repetitions, the median is reported (default 5)\n"
+            "  --model <file>          Model for ComponentMesh::LoadMesh (default ../Assets/Models/BakerHouse.fbx)\n"
+            "  --texture <file>        Image for the texture cases (default ../Assets/Textures/Baker_house.png)\n"
+            "  --output <file>         JSON results (default ../Library/Benchmark/microbenchmarks.json)\n"
+            << std::endl;
+    }
+
+    // "1k,10k,1M" -> 1000, 10000, 1000000
+    bool ParseSizes(const char* text, std::vector<size_t>& sizes)
+    {
+        sizes.clear();
+        const char* cursor = text;
+        while (*cursor)
+        {
+            char* end = nullptr;
+            unsigned long long value = strtoull(cursor, &end, 10);
+            if (end == cursor)
+                return false;
+            if (*end == 'k' || *end == 'K')
+            {
+                value *= 1000ull;
+                ++end;
+            }
+            else if (*end == 'm' || *end == 'M')
+            {
+                value *= 1000000ull;
+                ++end;
+            }
+            if (value == 0 || (*end != ',' && *end != '\0'))
+                return false;
+
+            sizes.push_back((size_t)value);
+            cursor = *end == ',' ? end + 1 : end;
+        }
+        return !sizes.empty();
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    Benchmark::Settings settings;
+    std::string modelPath = "../Assets/Models/BakerHouse.fbx";
+    std::string texturePath = "../Assets/Textures/Baker_house.png";
+    std::string outputPath = "../Library/Benchmark/microbenchmarks.json";
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string arg = argv[i];
+        if (arg == "--help" || arg == "-h")
+        {
+            PrintUsage();
+            return 0;
+        }
+        if (i + 1 >= argc)
+        {
+            std::cerr << "[Benchmark] Missing value for " << arg << std::endl;
+            PrintUsage();
+            return -1;
+        }
+
+        const char* value = argv[++i];
+        bool valid = true;
+        if (arg == "--sizes")
+            valid = ParseSizes(value, settings.sizes);
+        else if (arg == "--filter")
+            settings.filter = value;
+        else if (arg == "--min-time")
+            valid = (settings.minTime = atof(value)) > 0.0;
+        else if (arg == "--repetitions")
+            valid = (settings.repetitions = atoi(value)) > 0;
+        else if (arg == "--model")
+            modelPath = value;
+        else if (arg == "--texture")
+            texturePath = value;
+        else if (arg == "--output")
+            outputPath = value;
+        else
+            valid = false;
+
+        if (!valid)
+        {
+            std::cerr << "[Benchmark] Invalid argument " << arg << " " << value << std::endl;
+            PrintUsage();
+            return -1;
+        }
+    }
+
+    // Solo avisos y errores: el log de depuración de las cargas no debe entrar en las medidas
+    Logger::minLevel = (int)Logger::Level::WARN;
+    Logger::Init("../Library/Logs/benchmarks.log");
+    Profiler::enabled = false;
+
+    // Contexto GL sin pantalla: LoadMesh y las escenas sintéticas suben mallas a la GPU
+    Window window;
+    window.headless = true;
+    window.vsync = false;
+    if (!window.Start() || !gladLoadGLLoader((GLADloadproc)SDL_GL_GetProcAddress))
+    {
+        std::cerr << "[Benchmark] Could not create an OpenGL context" << std::endl;
+        Logger::Shutdown();
+        return 1;
+    }
+    ilInit();
+
+    RegisterCoreBenchmarks();
+    RegisterSceneBenchmarks();
+    RegisterAssetBenchmarks(modelPath, texturePath);
+
+    Benchmark::RunAll(settings);
+    const bool written = Benchmark::WriteJson(outputPath);
+
+    window.CleanUp();
+    Logger::Shutdown();
+    return written ? 0 : 1;
+}
@@ -0,0 +1,130 @@
+#include "Benchmark.h"
+#include "SyntheticScene.h"
+#include "AABB.h"
+#include "GameObject.h"
+#include "ComponentTransform.h"
+#include "GeometryGenerator.h"
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <random>
+
+namespace
+{
+    // Cajas locales y matrices TRS aleatorias, siempre las mismas para un tamaño
+    void MakeBoxes(size_t count, std::vector<AABB>& boxes, std::vector<glm::mat4>& matrices)
+    {
+        std::mt19937 random(1234);
+        std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+
+        boxes.resize(count);
+        matrices.resize(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            glm::vec3 center(unit(random), unit(random), unit(random));
+            glm::vec3 half = glm::abs(glm::vec3(unit(random), unit(random), unit(random))) + 0.1f;
+            boxes[i] = AABB(center - half, center + half);
+
+            glm::vec3 axis = glm::normalize(glm::vec3(unit(random), unit(random), unit(random)) + glm::vec3(0.0f, 2.0f, 0.0f));
+            matrices[i] = glm::translate(glm::mat4(1.0f), glm::vec3(unit(random), unit(random), unit(random)) * 100.0f)
+                * glm::mat4_cast(glm::angleAxis(unit(random) * 3.14159f, axis))
+                * glm::scale(glm::mat4(1.0f), glm::vec3(1.0f + unit(random) * 0.5f));
+        }
+    }
+
+    std::vector<ComponentTransform*> CollectTransforms(const SyntheticScene& scene)
+    {
+        std::vector<ComponentTransform*> transforms;
+        transforms.reserve(scene.GetObjects().size());
+        for (GameObject* object : scene.GetObjects())
+            transforms.push_back(object->GetComponent<ComponentTransform>());
+        return transforms;
+    }
+
+    void RegisterGeometry(const char* name, MeshGeometry(*build)())
+    {
+        Benchmark::Register(name, false, [build](Benchmark::State& state)
+        {
+            const size_t triangles = build().indices.size() / 3;
+            state.Measure([build]()
+            {
+                MeshGeometry geometry = build();
+                Benchmark::Consume(geometry.indices.size());
+            }, triangles);
+        });
+    }
+}
+
+void RegisterCoreBenchmarks()
+{
+    Benchmark::Register("AABB::Transform", true, [](Benchmark::State& state)
+    {
+        std::vector<AABB> boxes;
+        std::vector<glm::mat4> matrices;
+        MakeBoxes(state.GetSize(), boxes, matrices);
+
+        state.Measure([&]()
+        {
+            glm::vec3 sum(0.0f);
+            for (size_t i = 0; i < boxes.size(); ++i)
+                sum += boxes[i].Transform(matrices[i]).min;
+            Benchmark::Consume(sum);
+        }, boxes.size());
+    });
+
+    Benchmark::Register("AABB::Encapsulate", true, [](Benchmark::State& state)
+    {
+        std::vector<AABB> boxes;
+        std::vector<glm::mat4> matrices;
+        MakeBoxes(state.GetSize(), boxes, matrices);
+
+        state.Measure([&]()
+        {
+            AABB total;
+            for (const AABB& box : boxes)
+                total.Encapsulate(box);
+            Benchmark::Consume(total);
+        }, boxes.size());
+    });
+
+    // Set* marca el transform como sucio; GetGlobalMatrix rehace local y global
+    Benchmark::Register("ComponentTransform update (dirty)", true, [](Benchmark::State& state)
+    {
+        SyntheticScene scene(state.GetSize());
+        std::vector<ComponentTransform*> transforms = CollectTransforms(scene);
+
+        float offset = 0.01f;
+        state.Measure([&]()
+        {
+            offset = -offset;
+            glm::vec3 sum(0.0f);
+            for (ComponentTransform* transform : transforms)
+            {
+                transform->SetPosition(transform->GetPosition() + glm::vec3(offset, 0.0f, 0.0f));
+                sum += glm::vec3(transform->GetGlobalMatrix()[3]);
+            }
+            Benchmark::Consume(sum);
+        }, transforms.size());
+    });
+
+    Benchmark::Register("ComponentTransform::GetGlobalMatrix (cached)", true, [](Benchmark::State& state)
+    {
+        SyntheticScene scene(state.GetSize());
+        std::vector<ComponentTransform*> transforms = CollectTransforms(scene);
+
+        state.Measure([&]()
+        {
+            glm::vec3 sum(0.0f);
+            for (ComponentTransform* transform : transforms)
+                sum += glm::vec3(transform->GetGlobalMatrix()[3]);
+            Benchmark::Consume(sum);
+        }, transforms.size());
+    });
+
+    // Mismos parámetros que OpenGL::LoadGeometry; ns por triángulo
+    RegisterGeometry("GeometryGenerator::CreateCube", []() { return GeometryGenerator::CreateCube(2.0f); });
+    RegisterGeometry("GeometryGenerator::CreateSphere", []() { return GeometryGenerator::CreateSphere(1.0f, 32, 16); });
+    RegisterGeometry("GeometryGenerator::CreateSphere (128x64)", []() { return GeometryGenerator::CreateSphere(1.0f, 128, 64); });
+    RegisterGeometry("GeometryGenerator::CreateCylinder", []() { return GeometryGenerator::CreateCylinder(1.0f, 2.0f, 32); });
+    RegisterGeometry("GeometryGenerator::CreatePyramid", []() { return GeometryGenerator::CreatePyramid(2.0f, 2.0f); });
+    RegisterGeometry("GeometryGenerator::CreatePlane", []() { return GeometryGenerator::CreatePlane(5.0f, 5.0f); });
+}
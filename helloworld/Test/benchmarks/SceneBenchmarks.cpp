@@ -0,0 +1,64 @@
+#include "Benchmark.h"
+#include "SyntheticScene.h"
+#include "GameObject.h"
+#include "Ray.h"
+#include <random>
+
+namespace
+{
+    // Rayos deterministas desde arriba hacia puntos de la rejilla, algo inclinados
+    std::vector<Ray> MakeRays(const SyntheticScene& scene, size_t count)
+    {
+        std::mt19937 random(5678);
+        std::uniform_real_distribution<float> across(0.0f, scene.GetExtent());
+        std::uniform_real_distribution<float> tilt(-0.2f, 0.2f);
+
+        std::vector<Ray> rays;
+        rays.reserve(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            glm::vec3 target(across(random), 0.0f, across(random));
+            glm::vec3 direction = glm::normalize(glm::vec3(tilt(random), -1.0f, tilt(random)));
+            rays.push_back(Ray(target - direction * 50.0f, direction));
+        }
+        return rays;
+    }
+}
+
+void RegisterSceneBenchmarks()
+{
+    // Un rayo por objeto, vertical sobre su centro: siempre pasa el AABB y llega a los triángulos
+    Benchmark::Register("GameObject::IntersectRay", true, [](Benchmark::State& state)
+    {
+        SyntheticScene scene(state.GetSize());
+        const std::vector<GameObject*>& objects = scene.GetObjects();
+
+        std::vector<Ray> rays;
+        rays.reserve(objects.size());
+        for (size_t i = 0; i < objects.size(); ++i)
+            rays.push_back(Ray(scene.GetObjectCenter(i) + glm::vec3(0.0f, 10.0f, 0.0f), glm::vec3(0.0f, -1.0f, 0.0f)));
+
+        state.Measure([&]()
+        {
+            size_t hits = 0;
+            RayHit hit;
+            for (size_t i = 0; i < objects.size(); ++i)
+                hits += objects[i]->IntersectRay(rays[i], hit) ? 1 : 0;
+            Benchmark::Consume(hits);
+        }, objects.size());
+    });
+
+    // Picking del editor: recorre toda la jerarquía por cada rayo
+    Benchmark::Register("ModuleScene::PerformRaycast", true, [](Benchmark::State& state)
+    {
+        SyntheticScene scene(state.GetSize());
+        const std::vector<Ray> rays = MakeRays(scene, 64);
+
+        size_t next = 0;
+        state.Measure([&]()
+        {
+            GameObject* picked = scene.GetScene().PerformRaycast(rays[next++ % rays.size()]);
+            Benchmark::Consume(picked);
+        });
+    });
+}
@@ -0,0 +1,60 @@
+#include "SyntheticScene.h"
+#include "GameObject.h"
+#include "ComponentTransform.h"
+#include "ComponentMesh.h"
+#include "MeshResource.h"
+#include "GeometryGenerator.h"
+#include <cmath>
+#include <string>
+
+namespace
+{
+    const float Spacing = 2.0f;
+}
+
+SyntheticScene::SyntheticScene(size_t count)
+{
+    scene.Start();
+
+    MeshGeometry geometry = GeometryGenerator::CreateSphere(0.5f, 16, 8);
+    sphere = std::make_shared<MeshResource>();
+    sphere->LoadFromGeometry(&geometry);
+
+    const size_t side = (size_t)std::ceil(std::sqrt((double)count));
+    extent = side * Spacing;
+    objects.reserve(count);
+
+    GameObject* group = nullptr;
+    glm::vec3 groupPosition(0.0f);
+    for (size_t i = 0; i < count; ++i)
+    {
+        const glm::vec3 position((float)(i % side) * Spacing, 0.0f, (float)(i / side) * Spacing);
+
+        // Los grupos empiezan en su primer hijo: las posiciones de los hijos son locales
+        if (i % GroupSize == 0)
+        {
+            group = scene.CreateGameObject(("Group_" + std::to_string(i / GroupSize)).c_str());
+            group->ReserveChildren(GroupSize);
+            groupPosition = position;
+            ComponentTransform* groupTransform = (ComponentTransform*)group->CreateComponent(ComponentType::TRANSFORM);
+            groupTransform->SetPosition(groupPosition);
+        }
+
+        GameObject* object = scene.CreateGameObject(("Object_" + std::to_string(i)).c_str(), group);
+        ComponentTransform* transform = (ComponentTransform*)object->CreateComponent(ComponentType::TRANSFORM);
+        transform->SetPosition(position - groupPosition);
+        transform->SetRotation(glm::angleAxis((float)i * 0.37f, glm::normalize(glm::vec3(0.3f, 1.0f, 0.2f))));
+        transform->SetScale(glm::vec3(0.75f + 0.5f * (float)(i % 7) / 6.0f));
+
+        ComponentMesh* mesh = (ComponentMesh*)object->CreateComponent(ComponentType::MESH);
+        mesh->SetResource(sphere);
+        objects.push_back(object);
+    }
+
+    scene.UpdateAllAABBs();
+}
+
+glm::vec3 SyntheticScene::GetObjectCenter(size_t index) const
+{
+    return objects[index]->GetAABB().GetCenter();
+}
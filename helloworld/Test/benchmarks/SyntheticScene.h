@@ -0,0 +1,38 @@
+#pragma once
+#include "ModuleScene.h"
+#include <glm/glm.hpp>
+#include <memory>
+#include <vector>
+
+class GameObject;
+class MeshResource;
+
+// Escena de prueba con count objetos: transform y una esfera compartida (la
+// misma MeshResource, como las instancias de un modelo). Van en grupos de
+// GroupSize bajo nodos intermedios, en una rejilla sobre el plano XZ, con una
+// rotación y escala distintas cada uno. Todo depende solo de count: dos
+// ejecuciones construyen exactamente la misma escena.
+// Necesita contexto GL (la malla se sube a la GPU al crearla).
+class SyntheticScene
+{
+public:
+    static const size_t GroupSize = 64;
+
+    explicit SyntheticScene(size_t count);
+
+    SyntheticScene(const SyntheticScene&) = delete;
+    SyntheticScene& operator=(const SyntheticScene&) = delete;
+
+    ModuleScene& GetScene() { return scene; }
+    const std::vector<GameObject*>& GetObjects() const { return objects; }
+
+    // Centro en mundo del objeto index (los AABB deben estar actualizados)
+    glm::vec3 GetObjectCenter(size_t index) const;
+    float GetExtent() const { return extent; }
+
+private:
+    ModuleScene scene;
+    std::shared_ptr<MeshResource> sphere;
+    std::vector<GameObject*> objects;       // solo los que tienen malla
+    float extent = 0.0f;                    // lado de la rejilla
+};
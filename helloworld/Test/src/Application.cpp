@@ -1,6 +1,24 @@
 #include "Application.h"
+#include "JobSystem.h"
+#include "VirtualFileSystem.h"
+#include "FileUtils.h"
+#include "Profiler.h"
+#include "MemoryTracker.h"
+#include "Logger.h"
+#include "FrameTimer.h"
+#include <algorithm>
 #include <iostream>
 
+namespace
+{
+    // Frames que se siguen pintando tras la ltima actividad: ImGui necesita
+    // alguno ms para asentar hover, foco y cambios de layout
+    const int SettleFrames = 3;
+    // Latido en reposo (log de otros hilos, tooltips); con cargas en curso, ms corto
+    const int IdleTimeoutMs = 250;
+    const int PendingWorkTimeoutMs = 10;
+}
+
 Application::Application() : isRunning(true)
 {
     std::cout << "Application Constructor" << std::endl;
@@ -17,6 +35,12 @@ Application::Application() : isRunning(true)
         -90.0f, 0.0f
     );
 
+    // Nombres para el profiler (ModuleScene ya pone el suyo)
+    window->name = "Window";
+    input->name = "Input";
+    opengl->name = "OpenGL";
+    editor->name = "ModuleEditor";
+
     // ORDEN DE INICIALIZACIN (importante):
     // 1. ModuleScene (crea el root)
     // 2. Window
@@ -41,6 +65,21 @@ void Application::AddModule(std::shared_ptr<Module> module)
     moduleList.push_back(module);
 }
 
+void Application::EnableBenchmark(const ModuleBenchmark::Options& options)
+{
+    // El editor sobra: el benchmark dibuja la escena en su propio framebuffer
+    std::shared_ptr<Module> editorModule = std::static_pointer_cast<Module>(editor);
+    moduleList.erase(std::remove(moduleList.begin(), moduleList.end(), editorModule), moduleList.end());
+    editor.reset();
+
+    benchmark = std::make_shared<ModuleBenchmark>(options);
+    benchmark->name = "ModuleBenchmark";
+    AddModule(std::static_pointer_cast<Module>(benchmark));
+
+    window->headless = true;
+    window->vsync = false;
+}
+
 bool Application::Awake()
 {
     return true;
@@ -49,6 +88,16 @@ bool Application::Awake()
 bool Application::Start()
 {
     std::cout << "Starting Application..." << std::endl;
+    Profiler::SetThreadName("Main");
+    Logger::Init("../Library/Logs/engine.log");
+    JobSystem::Init();
+
+    // Assets: la carpeta del proyecto y, por encima, el paquete si existe (builds de distribucin)
+    if (FileUtils::IsDirectory("../Assets"))
+        VirtualFileSystem::Mount("../Assets", "../Assets");
+    if (FileUtils::Exists("../Assets.pak"))
+        VirtualFileSystem::Mount("../Assets", "../Assets.pak");
+
     bool result = true;
     for (const auto& module : moduleList) {
         result = module.get()->Start();
@@ -61,53 +110,106 @@ bool Application::Start()
     return result;
 }
 
+void Application::WaitWhileIdle()
+{
+    if (!opengl->renderOnDemand)
+        return;
+
+    if (input->HasActivity() || opengl->DrewSceneRecently())
+    {
+        framesToSettle = SettleFrames;
+        return;
+    }
+    if (framesToSettle > 0)
+    {
+        framesToSettle--;
+        return;
+    }
+
+    FrameTimer::WaitForEvents(opengl->HasPendingWork() ? PendingWorkTimeoutMs : IdleTimeoutMs);
+}
+
 bool Application::Update()
 {
+    WaitWhileIdle();
+
+    Profiler::BeginFrame();
+    FrameTimer::BeginFrame();
+
     bool ret = true;
-    if (input->GetWindowEvent(WE_QUIT) == true)
-        ret = false;
-    if (ret == true)
-        ret = PreUpdate();
-    if (ret == true)
-        ret = DoUpdate();
-    if (ret == true)
-        ret = PostUpdate();
+    {
+        PROFILE_SCOPE("Frame");
+        if (input->GetWindowEvent(WE_QUIT) == true)
+            ret = false;
+        if (ret == true)
+            ret = PreUpdate();
+        if (ret == true)
+            ret = DoUpdate();
+        if (ret == true)
+            ret = PostUpdate();
+
+        FrameTimer::WaitForNextFrame(window->vsync);
+    }
+
+    Profiler::EndFrame();
     return ret;
 }
 
 bool Application::PreUpdate()
 {
     //El orden este es muy importante porque si lo cambias de sitio se renderizan cosas encima de otras y luego no se vera el imgui
-    input->PreUpdate();
-    opengl->PreUpdate();
-    editor->PreUpdate();
-    window->PreUpdate();
+    PROFILE_SCOPE("PreUpdate");
+    { PROFILE_SCOPE(input->name.c_str()); input->PreUpdate(); }
+    { PROFILE_SCOPE(opengl->name.c_str()); opengl->PreUpdate(); }
+    if (editor) { PROFILE_SCOPE(editor->name.c_str()); editor->PreUpdate(); }
+    { PROFILE_SCOPE(window->name.c_str()); window->PreUpdate(); }
     return true;
 }
 
 bool Application::DoUpdate()
 {
+    PROFILE_SCOPE("Update");
     bool result = true;
-    for (const auto& module : moduleList) {
-        result = module.get()->Update();
-        if (!result) {
-            break;
+
+    // Simulacin a paso fijo; lo que sobra se acumula para el siguiente frame
+    const float fixedDeltaTime = FrameTimer::GetFixedDeltaTime();
+    while (result && FrameTimer::StepFixed())
+    {
+        PROFILE_SCOPE("FixedUpdate");
+        if (camera && input)
+            camera->fixedUpdate(input.get(), fixedDeltaTime);
+        for (const auto& module : moduleList) {
+            result = module.get()->FixedUpdate(fixedDeltaTime);
+            if (!result) {
+                break;
+            }
         }
     }
+
+    // Antes que los mdulos: OpenGL::Update dibuja la escena con esta cmara
     if (camera && input)
     {
-        float deltaTime = 0.016f;
-        camera->update(input.get(), deltaTime);
+        camera->update(input.get());
+        camera->interpolate(FrameTimer::GetAlpha());
+    }
+
+    for (const auto& module : moduleList) {
+        if (!result) {
+            break;
+        }
+        PROFILE_SCOPE(module->name.c_str());
+        result = module.get()->Update();
     }
     return result;
 }
 
 bool Application::PostUpdate()
 {
-    opengl->PostUpdate();
-    editor->PostUpdate();
-    window->PostUpdate();
-    input->PostUpdate();
+    PROFILE_SCOPE("PostUpdate");
+    { PROFILE_SCOPE(opengl->name.c_str()); opengl->PostUpdate(); }
+    if (editor) { PROFILE_SCOPE(editor->name.c_str()); editor->PostUpdate(); }
+    { PROFILE_SCOPE(window->name.c_str()); window->PostUpdate(); }
+    { PROFILE_SCOPE(input->name.c_str()); input->PostUpdate(); }
     return true;
 }
 
@@ -121,5 +223,11 @@ bool Application::CleanUp()
             break;
         }
     }
+    JobSystem::Shutdown();
+    VirtualFileSystem::UnmountAll();
+    Logger::Shutdown();
+
+    // Lo que siga vivo aqu son estticos o fugas; con sitios capturados se ve de dnde vienen
+    MemoryTracker::ReportLeaks();
     return result;
 }
@@ -6,6 +6,7 @@
 #include "ModuleEditor.h"
 #include "Camera.h"
 #include "ModuleScene.h"
+#include "ModuleBenchmark.h"
 #include <memory>
 #include <vector>
 
@@ -21,6 +22,11 @@ public:
     std::shared_ptr<ModuleEditor> editor;
     std::shared_ptr<Camera> camera;
     std::shared_ptr<ModuleScene> moduleScene;
+    std::shared_ptr<ModuleBenchmark> benchmark;     // solo con --benchmark (sin editor)
+
+    // Antes de Start: sin editor ni pantalla, el benchmark dibuja y mide la escena
+    void EnableBenchmark(const ModuleBenchmark::Options& options);
+
     bool Awake();
     bool Start();
     bool Update();
@@ -40,6 +46,10 @@ private:
     bool DoUpdate();
     bool PostUpdate();
 
+    // Render bajo demanda: sin eventos, cargas ni cambios en la escena espera al siguiente evento
+    void WaitWhileIdle();
+
     std::vector<std::shared_ptr<Module>> moduleList;
     bool isRunning;
+    int framesToSettle = 0;
 };
\ No newline at end of file
@@ -4,7 +4,7 @@
 #include <SDL3/SDL.h>
 
 Camera::Camera(glm::vec3 position, glm::vec3 up, float yaw, float pitch)
-    : position(position), worldUp(up), yaw(yaw), pitch(pitch),
+    : position(position), previousPosition(position), renderPosition(position), worldUp(up), yaw(yaw), pitch(pitch),
     front(glm::vec3(0, 0, -1)), baseMovementSpeed(2.5f), movementSpeed(2.5f),
     sprintMultiplier(2.0f), mouseSensitivity(0.1f),
     zoom(45.0f), fov(45.0f), aspectRatio(16.0f / 9.0f),
@@ -16,7 +16,7 @@ Camera::Camera(glm::vec3 position, glm::vec3 up, float yaw, float pitch)
 
 glm::mat4 Camera::getViewMatrix() const
 {
-    return glm::lookAt(position, position + front, up);
+    return glm::lookAt(renderPosition, renderPosition + front, up);
 }
 
 glm::mat4 Camera::getProjectionMatrix() const
@@ -33,7 +33,20 @@ void Camera::setProjection(float fov, float aspect, float nearP, float farP)
     zoom = fov;
 }
 
-void Camera::update(Input* input, float deltaTime)
+void Camera::lookAt(const glm::vec3& eye, const glm::vec3& target)
+{
+    position = eye;
+    previousPosition = eye;
+    renderPosition = eye;
+
+    // yaw/pitch equivalentes para que el ratn siga desde aqu sin saltos
+    glm::vec3 direction = glm::normalize(target - eye);
+    pitch = glm::clamp(glm::degrees(asinf(glm::clamp(direction.y, -1.0f, 1.0f))), -89.0f, 89.0f);
+    yaw = glm::degrees(atan2f(direction.z, direction.x));
+    updateCameraVectors();
+}
+
+void Camera::update(Input* input)
 {
     if (!input) return;
 
@@ -42,11 +55,6 @@ void Camera::update(Input* input, float deltaTime)
     bool altPressed = input->GetKey(SDL_SCANCODE_LALT) == KEY_DOWN || input->GetKey(SDL_SCANCODE_LALT) == KEY_REPEAT ||
         input->GetKey(SDL_SCANCODE_RALT) == KEY_DOWN || input->GetKey(SDL_SCANCODE_RALT) == KEY_REPEAT;
 
-    float currentSpeed = (input->GetKey(SDL_SCANCODE_LSHIFT) == KEY_REPEAT || input->GetKey(SDL_SCANCODE_RSHIFT) == KEY_REPEAT)
-        ? baseMovementSpeed * sprintMultiplier
-        : baseMovementSpeed;
-
-    float velocity = currentSpeed * deltaTime;
     SDL_Point motion = input->GetMouseMotion();
     int wheel = input->GetMouseWheel();
 
@@ -63,7 +71,6 @@ void Camera::update(Input* input, float deltaTime)
     else if (rightMouse)
     {
         processMouseMovement(static_cast<float>(motion.x), -static_cast<float>(motion.y));
-        processKeyboard(input, velocity);
     }
 
     // --- ZOOM ---
@@ -74,6 +81,28 @@ void Camera::update(Input* input, float deltaTime)
     wasLeftMousePressed = leftMouse;
 }
 
+void Camera::fixedUpdate(Input* input, float fixedDeltaTime)
+{
+    previousPosition = position;
+    if (!input) return;
+
+    // WASD solo en modo vuelo (botn derecho), igual que antes
+    bool rightMouse = input->GetMouseButton(3) == KEY_DOWN || input->GetMouseButton(3) == KEY_REPEAT;
+    if (!rightMouse)
+        return;
+
+    float currentSpeed = (input->GetKey(SDL_SCANCODE_LSHIFT) == KEY_REPEAT || input->GetKey(SDL_SCANCODE_RSHIFT) == KEY_REPEAT)
+        ? baseMovementSpeed * sprintMultiplier
+        : baseMovementSpeed;
+
+    processKeyboard(input, currentSpeed * fixedDeltaTime);
+}
+
+void Camera::interpolate(float alpha)
+{
+    renderPosition = glm::mix(previousPosition, position, alpha);
+}
+
 
 void Camera::processKeyboard(Input* input, float velocity)
 {
@@ -121,6 +150,9 @@ void Camera::processOrbitMovement(float xoffset, float yoffset)
     direction.z = cos(glm::radians(pitch)) * sin(glm::radians(yaw));
 
     position = orbitTarget - glm::normalize(direction) * orbitDistance;
+    // La rbita mueve la cmara directamente, sin interpolar entre pasos
+    previousPosition = position;
+    renderPosition = position;
 
     front = glm::normalize(orbitTarget - position);
 
@@ -167,5 +199,5 @@ Ray Camera::ScreenPointToRay(float mouseX, float mouseY, int screenWidth, int sc
     glm::vec4 rayWorld = viewInverse * rayEye;
     glm::vec3 rayDirection = glm::normalize(glm::vec3(rayWorld));
 
-    return Ray(position, rayDirection);
+    return Ray(renderPosition, rayDirection);
 }
\ No newline at end of file
@@ -10,13 +10,20 @@ class Camera
 public:
     Camera(glm::vec3 position, glm::vec3 up, float yaw = -90.0f, float pitch = 0.0f);
 
-    void update(Input* input, float deltaTime);
+    // Cada frame: mirar, orbitar y zoom (el ratón ya llega como delta del frame)
+    void update(Input* input);
+    // Cada paso fijo: desplazamiento con WASD
+    void fixedUpdate(Input* input, float fixedDeltaTime);
+    // Posición que se dibuja, entre los dos últimos pasos fijos
+    void interpolate(float alpha);
 
     glm::mat4 getViewMatrix() const;
     glm::mat4 getProjectionMatrix() const;
-    glm::vec3 getPosition() const { return position; }
+    glm::vec3 getPosition() const { return renderPosition; }
 
     void setProjection(float fov, float aspect, float nearP, float farP);
+    // Coloca la cámara sin interpolar (rutas del benchmark)
+    void lookAt(const glm::vec3& eye, const glm::vec3& target);
     Ray ScreenPointToRay(float mouseX, float mouseY, int screenWidth, int screenHeight);
 
 
@@ -29,6 +36,8 @@ private:
 
 private:
     glm::vec3 position;
+    glm::vec3 previousPosition;     // al empezar el último paso fijo
+    glm::vec3 renderPosition;
     glm::vec3 front;
     glm::vec3 up;
     glm::vec3 right;
@@ -1,20 +1,20 @@
 #include "ComponentMaterial.h"
 #include "GameObject.h"
-#include "Texture.h" // Tu clase Texture existente
-#include <IL/il.h>
-#include <IL/ilu.h>
+#include "TextureManager.h"
+#include "TextureResource.h"
+#include "TextureArrayPool.h"
+#include "RenderStats.h"
+#include <cstring>
 #include <iostream>
 
+uint32_t ComponentMaterial::changeVersion = 0;
+
 ComponentMaterial::ComponentMaterial(GameObject* owner)
     : Component(owner, ComponentType::MATERIAL),
-    textureID(0), width(0), height(0), channels(0), overrideTextureID(0), overrideTextureOwned(false)
+    overrideTextureID(0), overrideTextureOwned(false)
 {
-    // Crear textura checkerboard por defecto
-    textureID = Texture::CreateCheckerboardTexture(512, 512, 32);
-    texturePath = "checkerboard_default";
-    width = 512;
-    height = 512;
-    channels = 3;
+    // Checkerboard por defecto, compartido por todos los materiales
+    texture = TextureManager::GetDefault();
 }
 
 ComponentMaterial::~ComponentMaterial()
@@ -30,81 +30,38 @@ void ComponentMaterial::LoadTexture(const char* path)
         return;
     }
 
-    // Limpiar textura anterior
-    if (textureID != 0)
-    {
-        glDeleteTextures(1, &textureID);
-        textureID = 0;
-    }
+    // La textura anterior se libera sola si nadie ms la usa;
+    // si la carga falla, el gestor devuelve el checkerboard por defecto
+    texture = TextureManager::LoadAsync(path);
+    arrayLayer.reset();
+    changeVersion++;
+}
 
-    // Detectar formato
-    std::string pathStr(path);
-    std::string ext = pathStr.substr(pathStr.find_last_of('.') + 1);
-    for (auto& c : ext) c = tolower(c);
+void ComponentMaterial::SetTexture(std::shared_ptr<TextureResource> newTexture)
+{
+    texture = newTexture ? std::move(newTexture) : TextureManager::GetDefault();
+    arrayLayer.reset();
+    changeVersion++;
+}
 
-    // Cargar segn formato
-    if (ext == "dds")
-    {
-        textureID = Texture::LoadDDSTexture(path);
-    }
-    else
-    {
-        // Usar DevIL para otros formatos (jpg, png, tga, bmp, etc.)
-        ILuint imgID;
-        ilGenImages(1, &imgID);
-        ilBindImage(imgID);
-
-        if (!ilLoadImage(path))
-        {
-            std::cerr << "[ComponentMaterial] Failed to load: " << path << std::endl;
-            ilDeleteImages(1, &imgID);
-
-            // Usar checkerboard como fallback
-            textureID = Texture::CreateCheckerboardTexture(512, 512, 32);
-            texturePath = "checkerboard_fallback";
-            width = 512;
-            height = 512;
-            channels = 3;
-            return;
-        }
-
-        // Convertir a RGBA
-        ilConvertImage(IL_RGBA, IL_UNSIGNED_BYTE);
-
-        // Obtener informacin de la imagen
-        width = ilGetInteger(IL_IMAGE_WIDTH);
-        height = ilGetInteger(IL_IMAGE_HEIGHT);
-        channels = ilGetInteger(IL_IMAGE_CHANNELS);
-
-        // Crear textura OpenGL
-        glGenTextures(1, &textureID);
-        glBindTexture(GL_TEXTURE_2D, textureID);
-        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA,
-            width, height,
-            0, GL_RGBA, GL_UNSIGNED_BYTE, ilGetData());
-        glGenerateMipmap(GL_TEXTURE_2D);
-
-        // Parmetros de textura
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-
-        ilDeleteImages(1, &imgID);
-        std::cout << "[ComponentMaterial] Loaded texture: " << path
-            << " (" << width << "x" << height << ")" << std::endl;
-    }
+GLuint ComponentMaterial::GetTextureID() const
+{
+    return texture ? texture->GetID() : 0;
+}
+
+const char* ComponentMaterial::GetTexturePath() const
+{
+    return texture ? texture->GetPath().c_str() : "";
+}
 
-    texturePath = path;
+int ComponentMaterial::GetWidth() const
+{
+    return texture ? texture->GetWidth() : 0;
 }
 
-void ComponentMaterial::SetTexture(GLuint texID, const char* path)
+int ComponentMaterial::GetHeight() const
 {
-    textureID = texID;
-    if (path && strlen(path) > 0)
-        texturePath = path;
-    else
-        texturePath = "external_texture";
+    return texture ? texture->GetHeight() : 0;
 }
 
 void ComponentMaterial::SetOverrideTexture(GLuint texID, bool takeOwnership)
@@ -118,6 +75,7 @@ void ComponentMaterial::SetOverrideTexture(GLuint texID, bool takeOwnership)
 
     overrideTextureID = texID;
     overrideTextureOwned = takeOwnership;
+    changeVersion++;
 }
 
 void ComponentMaterial::ClearOverrideTexture()
@@ -129,11 +87,16 @@ void ComponentMaterial::ClearOverrideTexture()
     }
     overrideTextureID = 0;
     overrideTextureOwned = false;
+    changeVersion++;
 }
 
 void ComponentMaterial::Bind()
 {
-    GLuint toBind = textureID;
+    // Cuenta como uso para el LRU de VRAM (y recarga la textura si estaba expulsada)
+    if (texture)
+        texture->MarkUsed();
+
+    GLuint toBind = GetTextureID();
     if (overrideTextureID != 0)
         toBind = overrideTextureID;
 
@@ -141,9 +104,22 @@ void ComponentMaterial::Bind()
     {
         glActiveTexture(GL_TEXTURE0);
         glBindTexture(GL_TEXTURE_2D, toBind);
+        RenderStats::CountTextureBind();
     }
 }
 
+const TextureArrayLayer* ComponentMaterial::GetArrayLayer()
+{
+    // Con override se dibuja la textura temporal, que no est en ningn array
+    if (overrideTextureID != 0 || !TextureArrayPool::enabled)
+        return nullptr;
+
+    // Las texturas asncronas solo se pueden copiar cuando terminan de subirse
+    if (!arrayLayer)
+        arrayLayer = TextureArrayPool::Acquire(texture);
+    return arrayLayer.get();
+}
+
 void ComponentMaterial::Unbind()
 {
     glBindTexture(GL_TEXTURE_2D, 0);
@@ -165,10 +141,6 @@ void ComponentMaterial::CleanUp()
         overrideTextureOwned = false;
     }
 
-    if (textureID != 0)
-    {
-        if (glIsTexture(textureID))
-            glDeleteTextures(1, &textureID);
-        textureID = 0;
-    }
+    arrayLayer.reset();
+    texture.reset();
 }
\ No newline at end of file
@@ -1,31 +1,38 @@
 #pragma once
 #include "BaseComponent.h"
 #include <string>
+#include <cstdint>
+#include <memory>
 #include <glad/glad.h>
 
+class TextureResource;
+class TextureArrayLayer;
+
 class ComponentMaterial : public Component
 {
 private:
-    GLuint textureID;
-    std::string texturePath;
+    // Textura compartida a traves de TextureManager (nunca nula: por defecto el checkerboard)
+    std::shared_ptr<TextureResource> texture;
 
-    int width;
-    int height;
-    int channels;
+    // Capa de TextureArrayPool con una copia de la textura (para el dibujado agrupado)
+    std::shared_ptr<TextureArrayLayer> arrayLayer;
 
     // Optional override texture used only for rendering (not replacing original texture)
     GLuint overrideTextureID = 0;
     bool overrideTextureOwned = false;
 
+    static uint32_t changeVersion;
+
 public:
     ComponentMaterial(GameObject* owner);
     ~ComponentMaterial();
 
-    // Carga desde archivo (usando DevIL como en tu Texture.cpp)
+    // Carga desde archivo a traves de TextureManager (reutiliza si ya esta cargada)
     void LoadTexture(const char* path);
 
-    // Asigna una textura ya cargada (para usar con tu sistema actual)
-    void SetTexture(GLuint texID, const char* path = "");
+    // Asigna una textura ya cargada
+    void SetTexture(std::shared_ptr<TextureResource> newTexture);
+    const std::shared_ptr<TextureResource>& GetTexture() const { return texture; }
 
     // Override: asigna una textura temporal para usar en Bind() sin perder la referencia original
     void SetOverrideTexture(GLuint texID, bool takeOwnership = false);
@@ -33,13 +40,19 @@ public:
     GLuint GetOverrideTextureID() const { return overrideTextureID; }
 
     void Bind();
+
+    // Capa del array con la textura, o nullptr si no se puede agrupar (se reserva al pedirla)
+    const TextureArrayLayer* GetArrayLayer();
     void Unbind();
     void OnEditor() override;
 
-    GLuint GetTextureID() const { return textureID; }
-    const char* GetTexturePath() const { return texturePath.c_str(); }
-    int GetWidth() const { return width; }
-    int GetHeight() const { return height; }
+    // Cambia al asignar o quitar cualquier textura de cualquier material (render bajo demanda)
+    static uint32_t GetChangeVersion() { return changeVersion; }
+
+    GLuint GetTextureID() const;
+    const char* GetTexturePath() const;
+    int GetWidth() const;
+    int GetHeight() const;
 
 private:
     void CleanUp();
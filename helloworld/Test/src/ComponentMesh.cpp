@@ -1,17 +1,19 @@
 #include "ComponentMesh.h"
 #include "GameObject.h"
+#include "MeshManager.h"
+#include "RenderStats.h"
 #include <glad/glad.h>
 #include <iostream>
 
 ComponentMesh::ComponentMesh(GameObject* owner)
-    :Component(owner, ComponentType::MESH),
-    VAO(0), VBO(0), EBO(0), numVertices(0), numIndices(0)
+    :Component(owner, ComponentType::MESH)
 {
 }
 
 ComponentMesh::~ComponentMesh()
 {
-    CleanupBuffers();
+    // El recurso se libera solo cuando ninguna otra instancia lo usa
+    resource.reset();
 }
 
 void ComponentMesh::LoadMesh(const aiMesh* mesh)
@@ -22,157 +24,103 @@ void ComponentMesh::LoadMesh(const aiMesh* mesh)
         return;
     }
 
-    // Limpiar datos anteriores
-    CleanupBuffers();
-    vertices.clear();
-    indices.clear();
-
-    // Cargar vrtices
-    for (unsigned int i = 0; i < mesh->mNumVertices; i++)
-    {
-        MeshVertex vertex;
-
-        // Posicin
-        vertex.Position.x = mesh->mVertices[i].x;
-        vertex.Position.y = mesh->mVertices[i].y;
-        vertex.Position.z = mesh->mVertices[i].z;
-
-        // Normales
-        if (mesh->HasNormals())
-        {
-            vertex.Normal.x = mesh->mNormals[i].x;
-            vertex.Normal.y = mesh->mNormals[i].y;
-            vertex.Normal.z = mesh->mNormals[i].z;
-        }
-        else
-        {
-           vertex.Normal = glm::vec3(0.0f, 1.0f, 0.0f);
-        }
+    // Sin ruta de origen no se puede compartir: recurso propio
+    std::shared_ptr<MeshResource> newResource = std::make_shared<MeshResource>();
+    newResource->LoadMesh(mesh);
+    SetResource(newResource);
+}
 
-        // Coordenadas de textura
-        if (mesh->mTextureCoords[0])
-        {
-            vertex.TexCoords.x = mesh->mTextureCoords[0][i].x;
-            vertex.TexCoords.y = mesh->mTextureCoords[0][i].y;
-        }
-        else
-        {
-            vertex.TexCoords = glm::vec2(0.0f, 0.0f);
-        }
+void ComponentMesh::LoadMesh(const aiMesh* mesh, const std::string& sourcePath, unsigned int meshIndex)
+{
+    std::shared_ptr<MeshResource> shared = MeshManager::Load(sourcePath, meshIndex, mesh);
+    if (!shared)
+        return;
 
-        vertices.push_back(vertex);
-    }
+    SetResource(shared);
+}
 
-    // Cargar ndices
-    for (unsigned int i = 0; i < mesh->mNumFaces; i++)
+void ComponentMesh::LoadFromGeometry(MeshGeometry* geom)
+{
+    if (!geom)
     {
-        aiFace face = mesh->mFaces[i];
-        for (unsigned int j = 0; j < face.mNumIndices; j++)
-        {
-            indices.push_back(face.mIndices[j]);
-        }
+        std::cerr << "[ComponentMesh] Invalid geometry pointer" << std::endl;
+        return;
     }
 
-    numVertices = vertices.size();
-    numIndices = indices.size();
-
-    // Configurar buffers de OpenGL
-    SetupMesh();
-
-    std::cout << "[ComponentMesh] Loaded mesh: "
-        << numVertices << " vertices, "
-        << numIndices << " indices" << std::endl;
+    std::shared_ptr<MeshResource> newResource = std::make_shared<MeshResource>();
+    newResource->LoadFromGeometry(geom);
+    SetResource(newResource);
 }
 
-void ComponentMesh::SetupMesh()
+void ComponentMesh::SetResource(std::shared_ptr<MeshResource> newResource)
 {
-    // Generar buffers
-    glGenVertexArrays(1, &VAO);
-    glGenBuffers(1, &VBO);
-    glGenBuffers(1, &EBO);
-
-    glBindVertexArray(VAO);
-
-    // VBO - Vertex Buffer
-    glBindBuffer(GL_ARRAY_BUFFER, VBO);
-    glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(MeshVertex), &vertices[0], GL_STATIC_DRAW);
+    resource = std::move(newResource);
+    currentLOD = 0;
+}
 
-    // EBO - Element Buffer (ndices)
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(unsigned int), &indices[0], GL_STATIC_DRAW);
+int ComponentMesh::SelectLOD(float screenCoverage, float hysteresis)
+{
+    if (!resource || resource->GetLODCount() <= 1)
+        return currentLOD;
 
-    // Atributo 0: Posicin
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(MeshVertex), (void*)0);
+    const int lodCount = resource->GetLODCount();
+    int lod = glm::clamp(currentLOD, 0, lodCount - 1);
 
-    // Atributo 1: Normales
-    glEnableVertexAttribArray(1);
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(MeshVertex), (void*)offsetof(MeshVertex, Normal));
+    // Bajar de detalle solo cuando la cobertura queda claramente por debajo del umbral
+    while (lod + 1 < lodCount && screenCoverage < resource->GetLOD(lod + 1).switchCoverage * (1.0f - hysteresis))
+        lod++;
 
-    // Atributo 2: Coordenadas de textura
-    glEnableVertexAttribArray(2);
-    glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(MeshVertex), (void*)offsetof(MeshVertex, TexCoords));
+    // Subir de detalle solo cuando la cobertura supera claramente el umbral del LOD actual
+    while (lod > 0 && screenCoverage > resource->GetLOD(lod).switchCoverage * (1.0f + hysteresis))
+        lod--;
 
-    glBindVertexArray(0);
+    currentLOD = lod;
+    return currentLOD;
 }
 
-void ComponentMesh::Draw()
+void ComponentMesh::SetCurrentLOD(int lod)
 {
-    if (VAO == 0 || numIndices == 0)
+    if (!resource || resource->GetLODCount() == 0)
         return;
-
-    glBindVertexArray(VAO);
-    glDrawElements(GL_TRIANGLES, numIndices, GL_UNSIGNED_INT, 0);
-    glBindVertexArray(0);
+    currentLOD = glm::clamp(lod, 0, resource->GetLODCount() - 1);
 }
 
-// NUEVO: Dibujar normales como lneas. Crea un VBO temporal con pares (pos, pos+normal*length)
-void ComponentMesh::DrawNormals(const glm::mat4& modelMatrix, float length)
+void ComponentMesh::Draw()
 {
-    if (vertices.empty()) return;
-
-    std::vector<float> lines;
-    lines.reserve(vertices.size() * 6);
+    if (resource)
+        resource->Draw(currentLOD);
+}
 
-    for (const auto& v : vertices)
+void ComponentMesh::ApplyVertexFormatUniforms(unsigned int programID) const
+{
+    if (resource)
     {
-        glm::vec3 p = v.Position;
-        glm::vec3 n = v.Normal;
-        glm::vec3 p2 = p + n * length;
-
-        // P1
-        lines.push_back(p.x);
-        lines.push_back(p.y);
-        lines.push_back(p.z);
-        // P2
-        lines.push_back(p2.x);
-        lines.push_back(p2.y);
-        lines.push_back(p2.z);
+        resource->ApplyVertexFormatUniforms(programID);
+        return;
     }
 
-    // Crear buffers temporales
-    GLuint tmpVAO = 0, tmpVBO = 0;
-    glGenVertexArrays(1, &tmpVAO);
-    glGenBuffers(1, &tmpVBO);
-
-    glBindVertexArray(tmpVAO);
-    glBindBuffer(GL_ARRAY_BUFFER, tmpVBO);
-    glBufferData(GL_ARRAY_BUFFER, lines.size() * sizeof(float), lines.data(), GL_STATIC_DRAW);
+    glUniform3f(glGetUniformLocation(programID, "posOffset"), 0.0f, 0.0f, 0.0f);
+    glUniform3f(glGetUniformLocation(programID, "posScale"), 1.0f, 1.0f, 1.0f);
+    glUniform1i(glGetUniformLocation(programID, "octNormals"), 0);
+    RenderStats::CountUniforms(3);
+}
 
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
+void ComponentMesh::DrawNormals(const glm::mat4& modelMatrix, float length)
+{
+    if (resource)
+        resource->DrawNormals(modelMatrix, length);
+}
 
-    // Usar estado fijo: color blanco para las normales y dibujar lneas
-    glDisable(GL_TEXTURE_2D);
-    glLineWidth(1.0f);
-    // Asumimos que se usa un shader ya activo que respeta la matriz model/view/projection
-    glBindVertexArray(tmpVAO);
-    glDrawArrays(GL_LINES, 0, (GLsizei)(lines.size() / 3));
-    glBindVertexArray(0);
+const std::vector<glm::vec3>& ComponentMesh::GetCollisionPositions() const
+{
+    static const std::vector<glm::vec3> empty;
+    return resource ? resource->GetCollisionPositions() : empty;
+}
 
-    // Limpiar
-    glDeleteBuffers(1, &tmpVBO);
-    glDeleteVertexArrays(1, &tmpVAO);
+const std::vector<unsigned int>& ComponentMesh::GetIndices() const
+{
+    static const std::vector<unsigned int> empty;
+    return resource ? resource->GetIndices() : empty;
 }
 
 void ComponentMesh::OnEditor()
@@ -180,127 +128,18 @@ void ComponentMesh::OnEditor()
     // TODO: Implementar con ImGui
 }
 
-void ComponentMesh::CleanupBuffers()
-{
-    if (EBO != 0)
-    {
-        glDeleteBuffers(1, &EBO);
-        EBO = 0;
-    }
-
-    if (VBO != 0)
-    {
-        glDeleteBuffers(1, &VBO);
-        VBO = 0;
-    }
-
-    if (VAO != 0)
-    {
-        glDeleteVertexArrays(1, &VAO);
-        VAO = 0;
-    }
-}
 void ComponentMesh::Update()
 {
     // Si no necesitas actualizar nada en cada frame, djalo vaco
     // Pero la implementacin DEBE existir porque est declarada en el .h
 }
 
-void ComponentMesh::LoadFromGeometry(MeshGeometry* geom)
-{
-    if (!geom)
-    {
-        std::cerr << "[ComponentMesh] Invalid geometry pointer" << std::endl;
-        return;
-    }
-
-    // Limpiar datos anteriores
-    CleanupBuffers();
-    vertices.clear();
-    indices.clear();
-
-    // Convertir de MeshGeometry a MeshVertex
-    for (const auto& v : geom->vertices)
-    {
-        MeshVertex vertex;
-        vertex.Position = v.Position;
-        vertex.Normal = v.Normal;
-        vertex.TexCoords = v.TexCoords;
-        vertex.Tangent = glm::vec3(0.0f);    // O calcular si es necesario
-        vertex.Bitangent = glm::vec3(0.0f);  // O calcular si es necesario
-
-        vertices.push_back(vertex);
-    }
-
-    // Copiar ndices
-    indices = geom->indices;
-
-    numVertices = vertices.size();
-    numIndices = indices.size();
-
-    // Configurar buffers de OpenGL
-    SetupMesh();
-
-    std::cout << "[ComponentMesh] Loaded procedural geometry: "
-        << numVertices << " vertices, "
-        << numIndices << " indices" << std::endl;
-
-    aabbDirty = true;
-
-}
-
 AABB ComponentMesh::CalculateLocalAABB() const
 {
-    AABB aabb;
-
-    if (vertices.empty())
-        return aabb;
-
-    // Iterar sobre todos los vrtices usando la estructura MeshVertex
-    for (const MeshVertex& vertex : vertices)
-    {
-        aabb.Encapsulate(vertex.Position);
-    }
-
-    return aabb;
+    return resource ? resource->CalculateLocalAABB() : AABB();
 }
 
 AABB ComponentMesh::GetLocalAABB()
 {
-    if (aabbDirty)
-    {
-        localAABB = CalculateLocalAABB();
-        aabbDirty = false;
-    }
-    return localAABB;
-}
-
-void ComponentMesh::UpdateFlatVertices() const
-{
-    if (!flatVerticesDirty)
-        return;
-
-    flatVertices.clear();
-    flatVertices.reserve(vertices.size() * 8);
-
-    // Formato: [x, y, z, nx, ny, nz, u, v]
-    for (const MeshVertex& v : vertices)
-    {
-        flatVertices.push_back(v.Position.x);
-        flatVertices.push_back(v.Position.y);
-        flatVertices.push_back(v.Position.z);
-        flatVertices.push_back(v.Normal.x);
-        flatVertices.push_back(v.Normal.y);
-        flatVertices.push_back(v.Normal.z);
-        flatVertices.push_back(v.TexCoords.x);
-        flatVertices.push_back(v.TexCoords.y);
-    }
-
-    flatVerticesDirty = false;
-}
-
-const std::vector<float>& ComponentMesh::GetVertices() const
-{
-    UpdateFlatVertices();
-    return flatVertices;
+    return resource ? resource->GetLocalAABB() : AABB();
 }
\ No newline at end of file
@@ -1,43 +1,23 @@
 #pragma once
 #include "BaseComponent.h"
 #include "GeometryGenerator.h"
+#include "MeshResource.h"
 #include "AABB.h"
 #include <glad/glad.h>
 #include <glm/glm.hpp>
 #include <vector>
+#include <memory>
+#include <string>
 #include <assimp/scene.h>
 
-// Estructura de vrtice para ComponentMesh
-struct MeshVertex {
-    glm::vec3 Position;
-    glm::vec3 Normal;
-    glm::vec2 TexCoords;
-    glm::vec3 Tangent;
-    glm::vec3 Bitangent;
-};
-
 class ComponentMesh : public Component
 {
 private:
-    // Representacin estructurada (para OpenGL y uso interno)
-    std::vector<MeshVertex> vertices;
-    std::vector<unsigned int> indices;
-
-    // Representacin plana (para raycast - generada bajo demanda)
-    mutable std::vector<float> flatVertices;
-    mutable bool flatVerticesDirty = true;
-
-    GLuint VAO = 0;
-    GLuint VBO = 0;
-    GLuint EBO = 0;
-    GLuint numIndices, numVertices;
+    // Datos de GPU compartidos entre instancias de la misma malla
+    std::shared_ptr<MeshResource> resource;
 
-    AABB localAABB;
-    bool aabbDirty = true;
-
-    void SetupMesh();
-    void CleanupBuffers();
-    void UpdateFlatVertices() const;
+    // El LOD depende de la distancia de cada instancia
+    int currentLOD = 0;
 
 public:
     ComponentMesh(GameObject* owner);
@@ -47,25 +27,51 @@ public:
     void Update() override;
     void OnEditor() override;
 
-    // Cargar mesh desde Assimp (para modelos FBX/OBJ)
+    // Cargar mesh desde Assimp (para modelos FBX/OBJ). Con ruta de origen se
+    // comparte a travs de MeshManager con otros nodos que usan la misma malla.
     void LoadMesh(const aiMesh* mesh);
+    void LoadMesh(const aiMesh* mesh, const std::string& sourcePath, unsigned int meshIndex);
 
     // Cargar desde geometra procedural
     void LoadFromGeometry(MeshGeometry* geom);
 
+    void SetResource(std::shared_ptr<MeshResource> newResource);
+    const std::shared_ptr<MeshResource>& GetResource() const { return resource; }
+    long GetResourceUseCount() const { return resource.use_count(); }
+
     // Renderizar
     void Draw();
 
-    // Debug: dibujar normales en pantalla
+    // Sube los uniforms de decuantizacin que espera el shader principal
+    void ApplyVertexFormatUniforms(unsigned int programID) const;
+    bool HasPackedVertices() const { return resource && resource->HasPackedVertices(); }
+    size_t GetVertexStride() const { return resource ? resource->GetVertexStride() : sizeof(MeshVertex); }
+
+    // Debug: dibujar normales en pantalla (requiere los atributos en RAM)
     void DrawNormals(const glm::mat4& modelMatrix, float length = 0.1f);
 
     // GETTERS NECESARIOS PARA RAYCAST
-    const std::vector<float>& GetVertices() const;
-    const std::vector<MeshVertex>& GetMeshVertices() const { return vertices; }
-    const std::vector<unsigned int>& GetIndices() const { return indices; }
+    const std::vector<glm::vec3>& GetCollisionPositions() const;
+    const std::vector<unsigned int>& GetIndices() const;
+
+    size_t GetVertexCount() const { return resource ? resource->GetVertexCount() : 0; }
+    size_t GetIndexCount() const { return resource ? resource->GetIndexCount() : 0; }
+
+    // Memoria ocupada por la malla (compartida entre todas sus instancias)
+    size_t GetCPUMemoryBytes() const { return resource ? resource->GetCPUMemoryBytes() : 0; }
+    size_t GetGPUMemoryBytes() const { return resource ? resource->GetGPUMemoryBytes() : 0; }
+
+    // Sistema de LOD
+    int SelectLOD(float screenCoverage, float hysteresis);
+    void SetCurrentLOD(int lod);
+    int GetCurrentLOD() const { return currentLOD; }
+    int GetLODCount() const { return resource ? resource->GetLODCount() : 0; }
+    unsigned int GetLODTriangleCount(int lod) const { return resource ? resource->GetLODTriangleCount(lod) : 0; }
 
-    size_t GetVertexCount() const { return vertices.size(); }
-    size_t GetIndexCount() const { return indices.size(); }
+    // Formato de ndices de la malla completa (LOD 0)
+    GLenum GetIndexType() const { return resource ? resource->GetIndexType() : GL_UNSIGNED_INT; }
+    size_t GetIndexRangeCount() const { return resource ? resource->GetIndexRangeCount() : 0; }
+    size_t GetIndexBufferBytes() const { return resource ? resource->GetIndexBufferBytes() : 0; }
 
     // Sistema de AABB
     AABB CalculateLocalAABB() const;
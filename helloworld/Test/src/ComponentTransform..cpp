@@ -4,6 +4,8 @@
 #define GLM_ENABLE_EXPERIMENTAL
 #include <glm/gtx/quaternion.hpp>
 
+uint32_t ComponentTransform::changeVersion = 0;
+
 ComponentTransform::ComponentTransform(GameObject* owner)
     : Component(owner, ComponentType::TRANSFORM),
     position(0.0f, 0.0f, 0.0f),
@@ -46,18 +48,21 @@ void ComponentTransform::SetPosition(const glm::vec3& pos)
 {
     position = pos;
     isDirty = true;
+    changeVersion++;
 }
 
 void ComponentTransform::SetRotation(const glm::quat& rot)
 {
     rotation = rot;
     isDirty = true;
+    changeVersion++;
 }
 
 void ComponentTransform::SetScale(const glm::vec3& scl)
 {
     scale = scl;
     isDirty = true;
+    changeVersion++;
 }
 
 glm::mat4 ComponentTransform::GetLocalMatrix()
@@ -1,5 +1,6 @@
 #pragma once
 #include "BaseComponent.h"
+#include <cstdint>
 #include <glm/glm.hpp>
 #include <glm/gtc/quaternion.hpp>
 #include <glm/gtc/matrix_transform.hpp>
@@ -18,6 +19,8 @@ private:
 
     bool isDirty; // Flag para lazy evaluation
 
+    static uint32_t changeVersion;
+
 public:
     ComponentTransform(GameObject* owner);
     ~ComponentTransform();
@@ -39,6 +42,9 @@ public:
     glm::mat4 GetLocalMatrix();
     glm::mat4 GetGlobalMatrix();
 
+    // Cambia con cualquier Set* de cualquier transform (render bajo demanda)
+    static uint32_t GetChangeVersion() { return changeVersion; }
+
 private:
     void UpdateLocalMatrix();
     void UpdateGlobalMatrix();
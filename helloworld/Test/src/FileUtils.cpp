@@ -0,0 +1,162 @@
+#include "FileUtils.h"
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cstdio>
+#include <sys/stat.h>
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#include <direct.h>
+#include <process.h>
+#else
+#include <dirent.h>
+#include <unistd.h>
+#endif
+
+void FileUtils::CreateDirectories(const std::string& path)
+{
+    // Las carpetas que ya existen simplemente fallan al crearse
+    for (size_t pos = path.find_first_of("/\\", 1); ; pos = path.find_first_of("/\\", pos + 1))
+    {
+        std::string partial = path.substr(0, pos);
+        if (!partial.empty() && partial != "..")
+        {
+#ifdef _WIN32
+            _mkdir(partial.c_str());
+#else
+            mkdir(partial.c_str(), 0755);
+#endif
+        }
+        if (pos == std::string::npos)
+            break;
+    }
+}
+
+bool FileUtils::Exists(const std::string& path)
+{
+    struct stat info;
+    return stat(path.c_str(), &info) == 0;
+}
+
+bool FileUtils::IsDirectory(const std::string& path)
+{
+    struct stat info;
+    return stat(path.c_str(), &info) == 0 && (info.st_mode & S_IFDIR) != 0;
+}
+
+std::vector<std::string> FileUtils::ListFiles(const std::string& directory)
+{
+    std::vector<std::string> files;
+    std::vector<std::string> pending(1, std::string());
+
+    while (!pending.empty())
+    {
+        std::string relative = pending.back();
+        pending.pop_back();
+        std::string absolute = relative.empty() ? directory : directory + "/" + relative;
+        std::string prefix = relative.empty() ? std::string() : relative + "/";
+
+#ifdef _WIN32
+        WIN32_FIND_DATAA data;
+        HANDLE find = FindFirstFileA((absolute + "/*").c_str(), &data);
+        if (find == INVALID_HANDLE_VALUE)
+            continue;
+        do
+        {
+            std::string name = data.cFileName;
+            if (name == "." || name == "..")
+                continue;
+            if (data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)
+                pending.push_back(prefix + name);
+            else
+                files.push_back(prefix + name);
+        } while (FindNextFileA(find, &data));
+        FindClose(find);
+#else
+        DIR* dir = opendir(absolute.c_str());
+        if (!dir)
+            continue;
+        while (dirent* entry = readdir(dir))
+        {
+            std::string name = entry->d_name;
+            if (name == "." || name == "..")
+                continue;
+            if (IsDirectory(absolute + "/" + name))
+                pending.push_back(prefix + name);
+            else
+                files.push_back(prefix + name);
+        }
+        closedir(dir);
+#endif
+    }
+
+    std::sort(files.begin(), files.end());
+    return files;
+}
+
+std::string FileUtils::NormalizePath(const std::string& path)
+{
+    std::string lowered = path;
+    std::replace(lowered.begin(), lowered.end(), '\\', '/');
+    std::transform(lowered.begin(), lowered.end(), lowered.begin(),
+        [](unsigned char c) { return (char)std::tolower(c); });
+
+    std::vector<std::string> parts;
+    size_t start = 0;
+    while (start <= lowered.size())
+    {
+        size_t end = lowered.find('/', start);
+        if (end == std::string::npos)
+            end = lowered.size();
+
+        std::string part = lowered.substr(start, end - start);
+        if (part == "..")
+        {
+            if (!parts.empty() && parts.back() != ".." && !parts.back().empty())
+                parts.pop_back();
+            else
+                parts.push_back(part);
+        }
+        else if (part != "." && !(part.empty() && !parts.empty()))
+        {
+            parts.push_back(part);
+        }
+        start = end + 1;
+    }
+
+    std::string normalized;
+    for (size_t i = 0; i < parts.size(); ++i)
+    {
+        if (i > 0)
+            normalized += '/';
+        normalized += parts[i];
+    }
+    return normalized;
+}
+
+std::string FileUtils::MakeTempPath(const std::string& path)
+{
+    static std::atomic<unsigned int> counter(0);
+#ifdef _WIN32
+    const int processId = _getpid();
+#else
+    const int processId = (int)getpid();
+#endif
+    return path + "." + std::to_string(processId) + "." + std::to_string(counter++) + ".tmp";
+}
+
+bool FileUtils::RenameOver(const std::string& tempPath, const std::string& path)
+{
+#ifdef _WIN32
+    // rename de la CRT falla si el destino existe
+    if (MoveFileExA(tempPath.c_str(), path.c_str(), MOVEFILE_REPLACE_EXISTING) != 0)
+        return true;
+#else
+    if (std::rename(tempPath.c_str(), path.c_str()) == 0)
+        return true;
+#endif
+    std::remove(tempPath.c_str());
+    return false;
+}
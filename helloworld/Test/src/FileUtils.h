@@ -0,0 +1,27 @@
+#pragma once
+#include <string>
+#include <vector>
+
+// Utilidades de sistema de archivos que no cubre C++14
+class FileUtils
+{
+public:
+    // Crea cada carpeta de la ruta que todavía no exista
+    static void CreateDirectories(const std::string& path);
+
+    static bool Exists(const std::string& path);
+    static bool IsDirectory(const std::string& path);
+
+    // Rutas relativas a directory (con '/') de todos los archivos que contiene, recursivo
+    static std::vector<std::string> ListFiles(const std::string& directory);
+
+    // Barras unificadas, minúsculas (rutas de Windows) y sin "." ni "dir/.."
+    static std::string NormalizePath(const std::string& path);
+
+    // Temporal junto a path, distinto para cada llamada (y proceso): varios hilos
+    // pueden escribir el mismo archivo de caché a la vez sin pisarse el temporal
+    static std::string MakeTempPath(const std::string& path);
+
+    // Mueve tempPath a path sustituyendo lo que hubiera; nunca deja path a medias
+    static bool RenameOver(const std::string& tempPath, const std::string& path);
+};
@@ -0,0 +1,155 @@
+#include "FrameTimer.h"
+#include "Profiler.h"
+#include <SDL3/SDL.h>
+#include <algorithm>
+#include <cmath>
+#include <thread>
+#include <vector>
+
+uint64_t FrameTimer::startTicks = 0;
+uint64_t FrameTimer::frameStartTicks = 0;
+uint64_t FrameTimer::frameCount = 0;
+float FrameTimer::deltaTime = 0.0f;
+float FrameTimer::fixedDeltaTime = 1.0f / 60.0f;
+double FrameTimer::accumulator = 0.0;
+int FrameTimer::stepsThisFrame = 0;
+int FrameTimer::targetFps = 0;
+uint64_t FrameTimer::idleTicks = 0;
+
+float FrameTimer::history[FrameTimer::HistorySize] = {};
+int FrameTimer::historyOffset = 0;
+int FrameTimer::historyCount = 0;
+
+namespace
+{
+    // Un parón (breakpoint, carga síncrona) no se convierte en una ráfaga de pasos
+    const double MaxFrameDelta = 0.25;
+    const int MaxStepsPerFrame = 8;
+
+    // Tramo final del limitador en espera activa: dormir puede pasarse ~1 ms
+    const double SpinMargin = 0.002;
+}
+
+uint64_t FrameTimer::Ticks()
+{
+    return SDL_GetPerformanceCounter();
+}
+
+double FrameTimer::ToSeconds(uint64_t ticks)
+{
+    return (double)ticks / (double)SDL_GetPerformanceFrequency();
+}
+
+void FrameTimer::BeginFrame()
+{
+    const uint64_t now = Ticks();
+
+    if (frameCount == 0)
+    {
+        startTicks = now;
+        deltaTime = 0.0f;
+    }
+    else
+    {
+        const double seconds = ToSeconds(now - frameStartTicks - std::min(idleTicks, now - frameStartTicks));
+        deltaTime = (float)std::min(seconds, MaxFrameDelta);
+
+        history[historyOffset] = (float)(seconds * 1000.0);
+        historyOffset = (historyOffset + 1) % HistorySize;
+        historyCount = std::min(historyCount + 1, HistorySize);
+    }
+
+    frameStartTicks = now;
+    frameCount++;
+    idleTicks = 0;
+
+    accumulator += deltaTime;
+    stepsThisFrame = 0;
+}
+
+bool FrameTimer::StepFixed()
+{
+    if (accumulator < fixedDeltaTime)
+        return false;
+
+    // Demasiado atraso: se descarta en vez de arrastrarlo a los frames siguientes
+    if (stepsThisFrame >= MaxStepsPerFrame)
+    {
+        accumulator = std::fmod(accumulator, (double)fixedDeltaTime);
+        return false;
+    }
+
+    accumulator -= fixedDeltaTime;
+    stepsThisFrame++;
+    return true;
+}
+
+void FrameTimer::SetFixedDeltaTime(float seconds)
+{
+    fixedDeltaTime = std::max(seconds, 0.001f);
+}
+
+float FrameTimer::GetAlpha()
+{
+    return std::min((float)(accumulator / fixedDeltaTime), 1.0f);
+}
+
+double FrameTimer::GetTime()
+{
+    return frameCount == 0 ? 0.0 : ToSeconds(frameStartTicks - startTicks);
+}
+
+void FrameTimer::WaitForNextFrame(bool vsync)
+{
+    if (vsync || targetFps <= 0)
+        return;
+
+    PROFILE_SCOPE("Frame pacing");
+
+    const uint64_t target = frameStartTicks + SDL_GetPerformanceFrequency() / (uint64_t)targetFps;
+    for (;;)
+    {
+        const uint64_t now = Ticks();
+        if (now >= target)
+            break;
+
+        const double remaining = ToSeconds(target - now);
+        if (remaining > SpinMargin)
+            SDL_DelayNS((Uint64)((remaining - SpinMargin) * 1e9));
+        else
+            std::this_thread::yield();
+    }
+}
+
+void FrameTimer::WaitForEvents(int timeoutMs)
+{
+    const uint64_t start = Ticks();
+    SDL_WaitEventTimeout(nullptr, timeoutMs);
+    idleTicks += Ticks() - start;
+}
+
+float FrameTimer::GetLastFrameMs()
+{
+    return historyCount == 0 ? 0.0f : history[(historyOffset + HistorySize - 1) % HistorySize];
+}
+
+void FrameTimer::GetPercentiles(float& p50, float& p95, float& p99)
+{
+    p50 = p95 = p99 = 0.0f;
+    if (historyCount == 0)
+        return;
+
+    static std::vector<float> sorted;
+    sorted.assign(history, history + historyCount);
+
+    auto percentile = [](float fraction)
+    {
+        const size_t index = std::min((size_t)(fraction * sorted.size()), sorted.size() - 1);
+        std::nth_element(sorted.begin(), sorted.begin() + index, sorted.end());
+        return sorted[index];
+    };
+
+    p50 = percentile(0.50f);
+    p95 = percentile(0.95f);
+    p99 = percentile(0.99f);
+}
@@ -0,0 +1,64 @@
+#pragma once
+#include <cstdint>
+
+// Reloj del bucle principal. Mide el tiempo real de cada frame con el contador
+// de alta resolución de SDL, reparte la simulación en pasos fijos (el resto se
+// acumula para el frame siguiente y GetAlpha() permite interpolar al dibujar) y,
+// sin VSync, puede limitar los FPS durmiendo y apurando el final con espera activa.
+//
+//     FrameTimer::BeginFrame();
+//     while (FrameTimer::StepFixed())
+//         Simulate(FrameTimer::GetFixedDeltaTime());
+//     Render(FrameTimer::GetAlpha());
+//     FrameTimer::WaitForNextFrame(vsync);
+class FrameTimer
+{
+public:
+    static const int HistorySize = 1000;    // frames para los percentiles
+
+    static void BeginFrame();
+
+    // true mientras quede un paso fijo pendiente en este frame
+    static bool StepFixed();
+
+    static float GetDeltaTime() { return deltaTime; }          // s, real (acotado)
+    static float GetFixedDeltaTime() { return fixedDeltaTime; }
+    static void SetFixedDeltaTime(float seconds);
+    static float GetAlpha();                                    // [0, 1) entre el último paso y el siguiente
+    static double GetTime();                                    // s desde el primer frame
+    static uint64_t GetFrameCount() { return frameCount; }
+
+    // 0 = sin límite. Solo se aplica con VSync desactivado
+    static void SetTargetFps(int fps) { targetFps = fps < 0 ? 0 : fps; }
+    static int GetTargetFps() { return targetFps; }
+    static void WaitForNextFrame(bool vsync);
+
+    // Bloquea hasta el siguiente evento de SDL o timeoutMs; ese tiempo no cuenta
+    // como duración del frame (ni para el delta ni para los percentiles)
+    static void WaitForEvents(int timeoutMs);
+
+    // Duración de los últimos frames en ms (anillo, el más antiguo en GetHistoryOffset)
+    static const float* GetHistory() { return history; }
+    static int GetHistoryOffset() { return historyOffset; }
+    static int GetHistoryCount() { return historyCount; }
+    static float GetLastFrameMs();                              // sin acotar, 0 en el primer frame
+    static void GetPercentiles(float& p50, float& p95, float& p99);
+
+private:
+    static uint64_t Ticks();
+    static double ToSeconds(uint64_t ticks);
+
+    static uint64_t startTicks;
+    static uint64_t frameStartTicks;
+    static uint64_t frameCount;
+    static float deltaTime;
+    static float fixedDeltaTime;
+    static double accumulator;
+    static int stepsThisFrame;
+    static int targetFps;
+    static uint64_t idleTicks;
+
+    static float history[HistorySize];
+    static int historyOffset;
+    static int historyCount;
+};
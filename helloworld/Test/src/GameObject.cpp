@@ -4,13 +4,17 @@
 #include "ComponentMesh.h"
 #include "ComponentMaterial.h"
 #include "AABB.h"
+#include "MemoryTracker.h"
 #include <iostream>
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
 
+uint32_t GameObject::hierarchyVersion = 0;
+
 GameObject::GameObject(const char* name)
     : name(name), active(true), parent(nullptr)
 {
+    hierarchyVersion++;
 }
 
 GameObject::~GameObject()
@@ -21,6 +25,7 @@ GameObject::~GameObject()
         delete comp;
     }
     components.clear();
+    hierarchyVersion++;
 
     // No eliminamos hijos aqu, lo hace ModuleScene::RecursiveDelete
 }
@@ -48,6 +53,7 @@ void GameObject::Update()
 
 Component* GameObject::CreateComponent(ComponentType type)
 {
+    MEMORY_TAG(SCENE);
     Component* newComponent = nullptr;
 
     switch (type)
@@ -96,6 +102,7 @@ void GameObject::AddChild(GameObject* child)
 
     child->parent = this;
     children.push_back(child);
+    hierarchyVersion++;
 }
 
 void GameObject::RemoveChild(GameObject* child)
@@ -108,6 +115,7 @@ void GameObject::RemoveChild(GameObject* child)
     {
         (*it)->parent = nullptr;
         children.erase(it);
+        hierarchyVersion++;
     }
 }
 
@@ -188,8 +196,8 @@ bool GameObject::IntersectRayTriangles(const Ray& rayLocal, ComponentMesh* mesh,
     if (!mesh)
         return false;
 
-    // CORREGIDO: Ahora usa MeshVertex en lugar de float[]
-    const std::vector<MeshVertex>& vertices = mesh->GetMeshVertices();
+    // Posiciones compactas que la malla conserva tras subir los atributos a la GPU
+    const std::vector<glm::vec3>& vertices = mesh->GetCollisionPositions();
     const std::vector<unsigned int>& indices = mesh->GetIndices();
 
     if (vertices.empty() || indices.empty())
@@ -212,10 +220,9 @@ bool GameObject::IntersectRayTriangles(const Ray& rayLocal, ComponentMesh* mesh,
             idx2 >= vertices.size())
             continue;
 
-        // CORREGIDO: Extraer posiciones directamente de MeshVertex
-        glm::vec3 v0 = vertices[idx0].Position;
-        glm::vec3 v1 = vertices[idx1].Position;
-        glm::vec3 v2 = vertices[idx2].Position;
+        glm::vec3 v0 = vertices[idx0];
+        glm::vec3 v1 = vertices[idx1];
+        glm::vec3 v2 = vertices[idx2];
 
         // Algoritmo de interseccin Mller-Trumbore
         const float EPSILON = 1e-8f;
@@ -292,16 +299,13 @@ bool GameObject::IntersectRay(const Ray& ray, RayHit& outHit)
     Ray localRay(localOrigin, localDirection);
 
     // 4. OBTENER DATOS DEL MESH
-    const std::vector<float>& vertices = mesh->GetVertices();
+    const std::vector<glm::vec3>& vertices = mesh->GetCollisionPositions();
     const std::vector<unsigned int>& indices = mesh->GetIndices();
 
     if (vertices.empty() || indices.empty())
         return false;
 
     // 5. TEST CONTRA CADA TRINGULO
-    // Formato: [x, y, z, nx, ny, nz, u, v] = 8 floats por vrtice
-    const size_t VERTEX_STRIDE = 8;
-
     float closestDistance = FLT_MAX;
     bool foundHit = false;
 
@@ -312,13 +316,9 @@ bool GameObject::IntersectRay(const Ray& ray, RayHit& outHit)
         unsigned int idx2 = indices[i + 2];
 
         // Obtener posiciones de los vrtices del tringulo
-        size_t offset0 = idx0 * VERTEX_STRIDE;
-        size_t offset1 = idx1 * VERTEX_STRIDE;
-        size_t offset2 = idx2 * VERTEX_STRIDE;
-
-        glm::vec3 v0(vertices[offset0], vertices[offset0 + 1], vertices[offset0 + 2]);
-        glm::vec3 v1(vertices[offset1], vertices[offset1 + 1], vertices[offset1 + 2]);
-        glm::vec3 v2(vertices[offset2], vertices[offset2 + 1], vertices[offset2 + 2]);
+        glm::vec3 v0 = vertices[idx0];
+        glm::vec3 v1 = vertices[idx1];
+        glm::vec3 v2 = vertices[idx2];
 
         // ALGORITMO MLLER-TRUMBORE para interseccin ray-tringulo
         glm::vec3 edge1 = v1 - v0;
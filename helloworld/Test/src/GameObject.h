@@ -1,4 +1,5 @@
 #pragma once
+#include <cstdint>
 #include <vector>
 #include <string>
 #include <memory>
@@ -29,6 +30,8 @@ private:
 
     AABB globalAABB;  // AABB en espacio global (world space)
 
+    static uint32_t hierarchyVersion;
+
     // Helper para interseccin con tringulos
     bool IntersectRayTriangles(const Ray& rayLocal, ComponentMesh* mesh, float& closestDist, glm::vec3& hitPoint);
     
@@ -65,12 +68,17 @@ public:
     void SetParent(GameObject* newParent);
     GameObject* GetParent() const { return parent; }
     const std::vector<GameObject*>& GetChildren() const { return children; }
+    void ReserveChildren(size_t count) { children.reserve(count); }
+
+    // Cambia al crear/destruir GameObjects, reparentar o renombrar: las vistas
+    // cacheadas del editor (rbol de la jerarqua, ndice de bsqueda) lo comparan
+    static uint32_t GetHierarchyVersion() { return hierarchyVersion; }
 
     bool IntersectRay(const Ray& ray, RayHit& outHit);
 
     // Getters/Setters
     const char* GetName() const { return name.c_str(); }
-    void SetName(const char* newName) { name = newName; }
+    void SetName(const char* newName) { name = newName; hierarchyVersion++; }
     bool IsActive() const { return active; }
     void SetActive(bool state) { active = state; }
 };
\ No newline at end of file
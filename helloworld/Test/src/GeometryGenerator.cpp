@@ -1,4 +1,5 @@
 #include "GeometryGenerator.h"
+#include "RenderStats.h"
 #include <cmath>
 
 #ifndef M_PI
@@ -311,15 +312,70 @@ MeshGeometry GeometryGenerator::CreatePlane(float width, float depth)
 
 void MeshGeometry::SetupMesh()
 {
-    // Ya implementado en tu cdigo existente
+    if (vertices.empty() || indices.empty())
+        return;
+
+    Cleanup();
+
+    glGenVertexArrays(1, &VAO);
+    glGenBuffers(1, &VBO);
+    glGenBuffers(1, &EBO);
+
+    glBindVertexArray(VAO);
+
+    glBindBuffer(GL_ARRAY_BUFFER, VBO);
+    glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(GeomVertex), vertices.data(), GL_STATIC_DRAW);
+
+    // Las primitivas tienen pocos vrtices: ndices de 16 bits (u 8 si se permiten)
+    std::vector<uint8_t> indexData;
+    ranges = IndexBuffer::Build(indices.data(), indices.size(), indexData);
+
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, indexData.size(), indexData.data(), GL_STATIC_DRAW);
+    RenderStats::CountBufferUpload(vertices.size() * sizeof(GeomVertex) + indexData.size());
+
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(GeomVertex), (void*)offsetof(GeomVertex, Position));
+
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(GeomVertex), (void*)offsetof(GeomVertex, Normal));
+
+    glEnableVertexAttribArray(2);
+    glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(GeomVertex), (void*)offsetof(GeomVertex, TexCoords));
+
+    glBindVertexArray(0);
 }
 
 void MeshGeometry::Draw()
 {
-    // Ya implementado en tu cdigo existente
+    if (VAO == 0)
+        return;
+
+    glBindVertexArray(VAO);
+    RenderStats::CountVAOBind();
+    IndexBuffer::Draw(ranges);
+    glBindVertexArray(0);
 }
 
 void MeshGeometry::Cleanup()
 {
-    // Ya implementado en tu cdigo existente
+    if (EBO != 0)
+    {
+        glDeleteBuffers(1, &EBO);
+        EBO = 0;
+    }
+
+    if (VBO != 0)
+    {
+        glDeleteBuffers(1, &VBO);
+        VBO = 0;
+    }
+
+    if (VAO != 0)
+    {
+        glDeleteVertexArrays(1, &VAO);
+        VAO = 0;
+    }
+
+    ranges.clear();
 }
\ No newline at end of file
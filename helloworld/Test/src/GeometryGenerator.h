@@ -2,6 +2,7 @@
 #include <vector>
 #include <glm/glm.hpp>
 #include <glad/glad.h>
+#include "IndexBuffer.h"
 
 struct GeomVertex {
     glm::vec3 Position;
@@ -15,6 +16,7 @@ struct MeshGeometry {
     GLuint VAO = 0;
     GLuint VBO = 0;
     GLuint EBO = 0;
+    std::vector<IndexRange> ranges;
 
     void SetupMesh();
     void Draw();
@@ -0,0 +1,110 @@
+#include "GpuProfiler.h"
+#include "Logger.h"
+
+bool GpuProfiler::enabled = true;
+
+GpuProfiler::FrameQueries GpuProfiler::frames[GpuProfiler::FrameLatency];
+int GpuProfiler::frameIndex = 0;
+bool GpuProfiler::passOpen = false;
+std::vector<GpuProfiler::PassTiming> GpuProfiler::lastResults;
+unsigned int GpuProfiler::droppedFrames = 0;
+
+void GpuProfiler::BeginFrame()
+{
+    if (passOpen)
+        EndPass();
+
+    // El juego de queries que toca reutilizar es el de hace FrameLatency frames
+    frameIndex = (frameIndex + 1) % FrameLatency;
+    FrameQueries& frame = frames[frameIndex];
+    if (frame.used > 0 && frame.scene)
+        Collect(frame);
+    frame.used = 0;
+    frame.scene = false;
+}
+
+void GpuProfiler::MarkSceneFrame()
+{
+    frames[frameIndex].scene = true;
+}
+
+void GpuProfiler::Collect(FrameQueries& frame)
+{
+    // Las queries terminan en orden: si la última está lista, lo están todas
+    GLint available = 0;
+    glGetQueryObjectiv(frame.queries[frame.used - 1], GL_QUERY_RESULT_AVAILABLE, &available);
+    if (!available)
+    {
+        droppedFrames++;
+        return;
+    }
+
+    lastResults.clear();
+    for (size_t i = 0; i < frame.used; ++i)
+    {
+        GLuint64 elapsed = 0;
+        glGetQueryObjectui64v(frame.queries[i], GL_QUERY_RESULT, &elapsed);
+
+        PassTiming timing;
+        timing.name = frame.names[i];
+        timing.ms = elapsed / 1000000.0;
+        lastResults.push_back(timing);
+    }
+}
+
+void GpuProfiler::BeginPass(const char* name)
+{
+    if (passOpen)
+    {
+        LOG_WARN(RENDER, "GPU profiler: nested pass ignored: {}", name);
+        return;
+    }
+
+    FrameQueries& frame = frames[frameIndex];
+    if (frame.used == frame.queries.size())
+    {
+        GLuint query = 0;
+        glGenQueries(1, &query);
+        frame.queries.push_back(query);
+        frame.names.push_back(name);
+    }
+    frame.names[frame.used] = name;
+
+    glBeginQuery(GL_TIME_ELAPSED, frame.queries[frame.used]);
+    passOpen = true;
+}
+
+void GpuProfiler::EndPass()
+{
+    if (!passOpen)
+        return;
+
+    glEndQuery(GL_TIME_ELAPSED);
+    frames[frameIndex].used++;
+    passOpen = false;
+}
+
+double GpuProfiler::GetLastFrameMs()
+{
+    double total = 0.0;
+    for (const PassTiming& timing : lastResults)
+        total += timing.ms;
+    return total;
+}
+
+void GpuProfiler::Shutdown()
+{
+    if (passOpen)
+        EndPass();
+
+    for (FrameQueries& frame : frames)
+    {
+        if (!frame.queries.empty())
+            glDeleteQueries((GLsizei)frame.queries.size(), frame.queries.data());
+        frame.queries.clear();
+        frame.names.clear();
+        frame.used = 0;
+        frame.scene = false;
+    }
+    lastResults.clear();
+}
@@ -0,0 +1,77 @@
+#pragma once
+#include "Profiler.h"
+#include <glad/glad.h>
+#include <vector>
+
+// Tiempos de GPU por pasada con queries GL_TIME_ELAPSED. Cada frame usa su
+// propio juego de queries y los resultados se leen FrameLatency frames después,
+// cuando la GPU ya los ha terminado: leerlos nunca bloquea. Si aun así no están
+// listos, ese frame se descarta.
+// GL_TIME_ELAPSED no se puede anidar: las pasadas medidas deben ser consecutivas.
+class GpuProfiler
+{
+public:
+    static bool enabled;
+
+    struct PassTiming
+    {
+        const char* name = nullptr;
+        double ms = 0.0;
+    };
+
+    // Al principio de cada frame, antes de la primera pasada
+    static void BeginFrame();
+    // El frame en curso ha dibujado la escena. Solo esos frames sustituyen los
+    // resultados publicados: en reposo se mantienen los del último frame dibujado
+    static void MarkSceneFrame();
+
+    static void BeginPass(const char* name);
+    static void EndPass();
+
+    // Último frame con resultados (FrameLatency frames de retraso)
+    static const std::vector<PassTiming>& GetLastResults() { return lastResults; }
+    static double GetLastFrameMs();
+    static unsigned int GetDroppedFrames() { return droppedFrames; }
+
+    // Antes de destruir el contexto
+    static void Shutdown();
+
+    class Scope
+    {
+    public:
+        explicit Scope(const char* name) : active(enabled) { if (active) BeginPass(name); }
+        ~Scope() { if (active) EndPass(); }
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        bool active;
+    };
+
+private:
+    static const int FrameLatency = 3;
+
+    struct FrameQueries
+    {
+        std::vector<GLuint> queries;        // se reutilizan de un frame a otro
+        std::vector<const char*> names;
+        size_t used = 0;
+        bool scene = false;
+    };
+
+    static void Collect(FrameQueries& frame);
+
+    static FrameQueries frames[FrameLatency];
+    static int frameIndex;
+    static bool passOpen;
+    static std::vector<PassTiming> lastResults;
+    static unsigned int droppedFrames;
+};
+
+// Pasada medida en CPU (Profiler) y GPU con el mismo nombre
+#if defined(ENGINE_PROFILER)
+#define PROFILE_GPU_SCOPE(name) PROFILE_SCOPE(name); GpuProfiler::Scope PROFILE_CONCAT(gpuScope_, __LINE__)(name)
+#else
+#define PROFILE_GPU_SCOPE(name) ((void)0)
+#endif
@@ -0,0 +1,186 @@
+#include "IndexBuffer.h"
+#include "RenderStats.h"
+#include <algorithm>
+#include <cstring>
+
+bool IndexBuffer::allowByteIndices = false;
+
+GLenum IndexBuffer::ChooseIndexType(size_t vertexCount)
+{
+    if (allowByteIndices && vertexCount <= 0x100)
+        return GL_UNSIGNED_BYTE;
+    if (vertexCount <= 0x10000)
+        return GL_UNSIGNED_SHORT;
+    return GL_UNSIGNED_INT;
+}
+
+size_t IndexBuffer::IndexSize(GLenum type)
+{
+    switch (type)
+    {
+    case GL_UNSIGNED_BYTE:  return 1;
+    case GL_UNSIGNED_SHORT: return 2;
+    default:                return 4;
+    }
+}
+
+const char* IndexBuffer::TypeName(GLenum type)
+{
+    switch (type)
+    {
+    case GL_UNSIGNED_BYTE:  return "8-bit";
+    case GL_UNSIGNED_SHORT: return "16-bit";
+    default:                return "32-bit";
+    }
+}
+
+IndexRange IndexBuffer::Append(const unsigned int* indices, size_t count, GLenum type, unsigned int baseVertex, std::vector<uint8_t>& data)
+{
+    const size_t size = IndexSize(type);
+
+    // Cada tramo empieza alineado a su tamaño de índice
+    size_t offset = (data.size() + size - 1) / size * size;
+    data.resize(offset + count * size);
+    uint8_t* dst = data.data() + offset;
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        unsigned int value = indices[i] - baseVertex;
+        if (type == GL_UNSIGNED_BYTE)
+        {
+            dst[i] = (uint8_t)value;
+        }
+        else if (type == GL_UNSIGNED_SHORT)
+        {
+            uint16_t v16 = (uint16_t)value;
+            memcpy(dst + i * 2, &v16, 2);
+        }
+        else
+        {
+            memcpy(dst + i * 4, &value, 4);
+        }
+    }
+
+    IndexRange range;
+    range.type = type;
+    range.byteOffset = offset;
+    range.count = (GLsizei)count;
+    range.baseVertex = (GLint)baseVertex;
+    return range;
+}
+
+std::vector<IndexRange> IndexBuffer::Build(const unsigned int* indices, size_t count, std::vector<uint8_t>& data)
+{
+    std::vector<IndexRange> ranges;
+    if (!indices || count == 0)
+        return ranges;
+
+    unsigned int maxIndex = *std::max_element(indices, indices + count);
+    GLenum type = ChooseIndexType((size_t)maxIndex + 1);
+
+    if (type != GL_UNSIGNED_INT || count % 3 != 0)
+    {
+        ranges.push_back(Append(indices, count, type, 0, data));
+        return ranges;
+    }
+
+    // Partir en clusters consecutivos cuyo rango de vértices quepa en 16 bits.
+    // Los triángulos que por sí solos abarcan más de 65536 vértices van a un resto de 32 bits.
+    struct Cluster
+    {
+        std::vector<unsigned int> indices;
+        unsigned int minVertex = 0;
+    };
+
+    std::vector<Cluster> clusters;
+    std::vector<unsigned int> wide;
+    Cluster current;
+    unsigned int curMin = 0, curMax = 0;
+
+    for (size_t t = 0; t < count; t += 3)
+    {
+        unsigned int a = indices[t], b = indices[t + 1], c = indices[t + 2];
+        unsigned int triMin = std::min(a, std::min(b, c));
+        unsigned int triMax = std::max(a, std::max(b, c));
+
+        if (triMax - triMin > 0xFFFF)
+        {
+            wide.insert(wide.end(), { a, b, c });
+            continue;
+        }
+
+        if (!current.indices.empty())
+        {
+            unsigned int newMin = std::min(curMin, triMin);
+            unsigned int newMax = std::max(curMax, triMax);
+            if (newMax - newMin > 0xFFFF)
+            {
+                current.minVertex = curMin;
+                clusters.push_back(std::move(current));
+                current = Cluster();
+            }
+            else
+            {
+                curMin = newMin;
+                curMax = newMax;
+            }
+        }
+
+        if (current.indices.empty())
+        {
+            curMin = triMin;
+            curMax = triMax;
+        }
+        current.indices.insert(current.indices.end(), { a, b, c });
+    }
+
+    if (!current.indices.empty())
+    {
+        current.minVertex = curMin;
+        clusters.push_back(std::move(current));
+    }
+
+    // Solo compensa si los clusters son grandes y el resto de 32 bits es pequeño:
+    // cada cluster es una llamada de dibujo más
+    const size_t triangles = count / 3;
+    bool worthIt = clusters.size() <= 1 + triangles / MIN_CLUSTER_TRIANGLES
+        && wide.size() * 10 <= count;
+
+    if (!worthIt)
+    {
+        ranges.push_back(Append(indices, count, GL_UNSIGNED_INT, 0, data));
+        return ranges;
+    }
+
+    for (const Cluster& cluster : clusters)
+        ranges.push_back(Append(cluster.indices.data(), cluster.indices.size(), GL_UNSIGNED_SHORT, cluster.minVertex, data));
+
+    if (!wide.empty())
+        ranges.push_back(Append(wide.data(), wide.size(), GL_UNSIGNED_INT, 0, data));
+
+    return ranges;
+}
+
+void IndexBuffer::Draw(const std::vector<IndexRange>& ranges, GLenum mode)
+{
+    for (const IndexRange& range : ranges)
+    {
+        RenderStats::CountDraw(mode, range.count);
+        if (range.baseVertex == 0)
+            glDrawElements(mode, range.count, range.type, (void*)range.byteOffset);
+        else
+            glDrawElementsBaseVertex(mode, range.count, range.type, (void*)range.byteOffset, range.baseVertex);
+    }
+}
+
+void IndexBuffer::DrawInstanced(const std::vector<IndexRange>& ranges, GLsizei instanceCount, GLenum mode)
+{
+    for (const IndexRange& range : ranges)
+    {
+        RenderStats::CountDraw(mode, range.count, instanceCount);
+        if (range.baseVertex == 0)
+            glDrawElementsInstanced(mode, range.count, range.type, (void*)range.byteOffset, instanceCount);
+        else
+            glDrawElementsInstancedBaseVertex(mode, range.count, range.type, (void*)range.byteOffset, instanceCount, range.baseVertex);
+    }
+}
@@ -0,0 +1,42 @@
+#pragma once
+#include <glad/glad.h>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+// Tramo de un EBO que se dibuja con una sola llamada: todos sus índices
+// comparten tipo y se desplazan con el mismo vértice base
+struct IndexRange {
+    GLenum type = GL_UNSIGNED_INT;
+    size_t byteOffset = 0;
+    GLsizei count = 0;
+    GLint baseVertex = 0;
+};
+
+// Empaquetado de índices en el tipo más pequeño posible (8/16/32 bits).
+// Las mallas con más de 65536 vértices se parten en clusters direccionables
+// con 16 bits (glDrawElementsBaseVertex) cuando sale a cuenta.
+class IndexBuffer {
+public:
+    // Los índices de 8 bits ahorran muy poco y algunos drivers los convierten
+    // en cada draw, así que solo se usan si se piden explícitamente
+    static bool allowByteIndices;
+
+    // Por debajo de esta media de triángulos por cluster no compensa partir
+    static constexpr size_t MIN_CLUSTER_TRIANGLES = 1024;
+
+    static GLenum ChooseIndexType(size_t vertexCount);
+    static size_t IndexSize(GLenum type);
+    static const char* TypeName(GLenum type);
+
+    // Codifica una lista de triángulos al final de data (respetando la
+    // alineación de cada tipo) y devuelve los rangos necesarios para dibujarla
+    static std::vector<IndexRange> Build(const unsigned int* indices, size_t count, std::vector<uint8_t>& data);
+
+    // Dibuja los rangos con el VAO y el EBO ya enlazados
+    static void Draw(const std::vector<IndexRange>& ranges, GLenum mode = GL_TRIANGLES);
+    static void DrawInstanced(const std::vector<IndexRange>& ranges, GLsizei instanceCount, GLenum mode = GL_TRIANGLES);
+
+private:
+    static IndexRange Append(const unsigned int* indices, size_t count, GLenum type, unsigned int baseVertex, std::vector<uint8_t>& data);
+};
@@ -40,9 +40,12 @@ bool Input::PreUpdate()
     for (int i = 0; i < WE_COUNT; ++i)
         windowEvents[i] = false;
 
+    activity = false;
     while (SDL_PollEvent(&event))
     {
-        Application::GetInstance().editor->ProcessEvent(event);
+        activity = true;
+        if (Application::GetInstance().editor)
+            Application::GetInstance().editor->ProcessEvent(event);
 
         switch (event.type)
         {
@@ -132,6 +135,9 @@ bool Input::PreUpdate()
             keyboard[i] = KEY_REPEAT;
         else if (keyboard[i] == KEY_UP)
             keyboard[i] = KEY_IDLE;
+
+        if (keyboard[i] == KEY_REPEAT)
+            activity = true;
     }
 
     for (int i = 0; i < NUM_MOUSE_BUTTONS; ++i)
@@ -140,6 +146,9 @@ bool Input::PreUpdate()
             mouseButtons[i] = KEY_REPEAT;
         else if (mouseButtons[i] == KEY_UP)
             mouseButtons[i] = KEY_IDLE;
+
+        if (mouseButtons[i] == KEY_REPEAT)
+            activity = true;
     }
 
     return true;
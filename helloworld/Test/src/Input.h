@@ -48,6 +48,9 @@ public:
         return windowEvents[event];
     }
 
+    // Eventos en este frame o teclas/botones mantenidos: el bucle no debe dormirse
+    bool HasActivity() const { return activity; }
+
     std::vector<std::string> droppedFiles;
 
 
@@ -59,4 +62,5 @@ private:
     int mouseX, mouseY;
     int mouseMotionX, mouseMotionY;
     int mouseWheelY;
+    bool activity = false;
 };
@@ -0,0 +1,135 @@
+#include "JobSystem.h"
+#include "Profiler.h"
+#include <string>
+#include <iostream>
+
+std::vector<std::thread> JobSystem::workers;
+std::deque<JobSystem::Job> JobSystem::queue;
+std::mutex JobSystem::queueMutex;
+std::condition_variable JobSystem::queueCondition;
+std::condition_variable JobSystem::idleCondition;
+unsigned int JobSystem::busyWorkers = 0;
+bool JobSystem::stopping = false;
+
+void JobSystem::Init(unsigned int workerCount)
+{
+    if (!workers.empty())
+        return;
+
+    if (workerCount == 0)
+    {
+        unsigned int cores = std::thread::hardware_concurrency();
+        workerCount = cores > 1 ? cores - 1 : 1;
+    }
+
+    stopping = false;
+    for (unsigned int i = 0; i < workerCount; ++i)
+        workers.emplace_back(&JobSystem::WorkerLoop, i);
+
+    std::cout << "[JobSystem] Started " << workerCount << " worker threads" << std::endl;
+}
+
+void JobSystem::Shutdown()
+{
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        stopping = true;
+        queue.clear();
+    }
+    queueCondition.notify_all();
+
+    for (std::thread& worker : workers)
+    {
+        if (worker.joinable())
+            worker.join();
+    }
+    workers.clear();
+}
+
+void JobSystem::Submit(Job job)
+{
+    // Sin workers (antes de Init o tras Shutdown) se ejecuta en el llamador
+    if (workers.empty())
+    {
+        job();
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        queue.push_back(std::move(job));
+    }
+    queueCondition.notify_one();
+}
+
+void JobSystem::WaitIdle()
+{
+    std::unique_lock<std::mutex> lock(queueMutex);
+    idleCondition.wait(lock, [] { return queue.empty() && busyWorkers == 0; });
+}
+
+void JobSystem::ParallelFor(size_t count, const std::function<void(size_t)>& body)
+{
+    if (workers.empty() || count <= 1)
+    {
+        for (size_t i = 0; i < count; ++i)
+            body(i);
+        return;
+    }
+
+    std::mutex doneMutex;
+    std::condition_variable doneCondition;
+    size_t remaining = count;
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        Submit([&, i]
+        {
+            body(i);
+
+            std::lock_guard<std::mutex> lock(doneMutex);
+            if (--remaining == 0)
+                doneCondition.notify_one();
+        });
+    }
+
+    std::unique_lock<std::mutex> lock(doneMutex);
+    doneCondition.wait(lock, [&] { return remaining == 0; });
+}
+
+size_t JobSystem::GetPendingCount()
+{
+    std::lock_guard<std::mutex> lock(queueMutex);
+    return queue.size() + busyWorkers;
+}
+
+void JobSystem::WorkerLoop(unsigned int index)
+{
+    Profiler::SetThreadName(("Worker " + std::to_string(index)).c_str());
+
+    for (;;)
+    {
+        Job job;
+        {
+            std::unique_lock<std::mutex> lock(queueMutex);
+            queueCondition.wait(lock, [] { return stopping || !queue.empty(); });
+            if (stopping)
+                return;
+
+            job = std::move(queue.front());
+            queue.pop_front();
+            busyWorkers++;
+        }
+
+        {
+            PROFILE_SCOPE("Job");
+            job();
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(queueMutex);
+            busyWorkers--;
+        }
+        idleCondition.notify_all();
+    }
+}
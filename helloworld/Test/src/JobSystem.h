@@ -0,0 +1,42 @@
+#pragma once
+#include <functional>
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+// Pool de hilos para trabajo de CPU que no toca OpenGL (decodificar imágenes,
+// generar mips, descomprimir...). Los resultados los recoge el hilo principal.
+class JobSystem
+{
+public:
+    using Job = std::function<void()>;
+
+    // workerCount = 0 -> núcleos disponibles menos el hilo principal
+    static void Init(unsigned int workerCount = 0);
+    static void Shutdown();
+
+    static void Submit(Job job);
+
+    // Bloquea hasta que la cola esté vacía y ningún worker esté ocupado
+    static void WaitIdle();
+
+    // Ejecuta body(0..count-1) repartido entre los workers y espera solo a esos
+    // trabajos. Llamar desde el hilo principal, nunca desde dentro de un job.
+    static void ParallelFor(size_t count, const std::function<void(size_t)>& body);
+
+    static unsigned int GetWorkerCount() { return (unsigned int)workers.size(); }
+    static size_t GetPendingCount();
+
+private:
+    static void WorkerLoop(unsigned int index);
+
+    static std::vector<std::thread> workers;
+    static std::deque<Job> queue;
+    static std::mutex queueMutex;
+    static std::condition_variable queueCondition;
+    static std::condition_variable idleCondition;
+    static unsigned int busyWorkers;
+    static bool stopping;
+};
@@ -0,0 +1,448 @@
+#include "Logger.h"
+#include "FileUtils.h"
+#include "MemoryTracker.h"
+#include "Profiler.h"
+#include <fmt/args.h>
+#include <fmt/format.h>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <thread>
+
+std::atomic<int> Logger::minLevel((int)Logger::Level::TRACE);
+std::atomic<bool> Logger::echoToStdout(true);
+std::atomic<uint64_t> Logger::droppedCount(0);
+std::mutex Logger::historyMutex;
+std::deque<Logger::Line> Logger::history;
+uint64_t Logger::historyBase = 0;
+
+namespace
+{
+    static_assert(sizeof(void*) <= sizeof(uint64_t), "Pointers are stored as uint64_t");
+
+    const uint32_t RingCapacity = 8192;     // potencia de 2
+    const uint32_t RingMask = RingCapacity - 1;
+
+    const std::chrono::steady_clock::time_point LogEpoch = std::chrono::steady_clock::now();
+
+    std::atomic<uint32_t> nextThreadId(1);
+    thread_local uint32_t threadId = 0;
+
+    std::thread loggerThread;
+    std::atomic<bool> running(false);
+
+    // Solo para despertar antes al logger en ráfagas; los productores no toman el mutex
+    std::mutex wakeMutex;
+    std::condition_variable wakeCondition;
+    std::ofstream logFile;
+}
+
+// Cola acotada de Vyukov: cada celda lleva un número de secuencia que dice si está
+// libre para la vuelta actual del productor o lista para el consumidor
+struct LoggerRing
+{
+    struct Cell
+    {
+        std::atomic<uint32_t> sequence;
+        Logger::Record record;
+    };
+
+    Cell cells[RingCapacity];
+    std::atomic<uint32_t> enqueuePosition;
+    uint32_t dequeuePosition = 0;           // solo el hilo del logger
+
+    LoggerRing() : enqueuePosition(0)
+    {
+        for (uint32_t i = 0; i < RingCapacity; ++i)
+            cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+};
+
+namespace
+{
+    LoggerRing ring;
+}
+
+Logger::Record* Logger::Acquire(uint32_t& position)
+{
+    static_assert(sizeof(Record) == 256, "Logger::Record should stay at 256 bytes");
+
+    position = ring.enqueuePosition.load(std::memory_order_relaxed);
+    for (;;)
+    {
+        LoggerRing::Cell& cell = ring.cells[position & RingMask];
+        uint32_t sequence = cell.sequence.load(std::memory_order_acquire);
+        int32_t diff = (int32_t)(sequence - position);
+        if (diff == 0)
+        {
+            if (ring.enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                return &cell.record;
+        }
+        else if (diff < 0)
+        {
+            // Lleno: el consumidor aún no ha liberado esta celda
+            droppedCount.fetch_add(1, std::memory_order_relaxed);
+            return nullptr;
+        }
+        else
+        {
+            position = ring.enqueuePosition.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+void Logger::Publish(uint32_t position)
+{
+    ring.cells[position & RingMask].sequence.store(position + 1, std::memory_order_release);
+
+    // Cada cuarto de anillo se avisa al logger para que no se llene mientras duerme
+    if ((position & (RingCapacity / 4 - 1)) == 0)
+        wakeCondition.notify_one();
+}
+
+void Logger::Begin(Record& record, Level level, Category category, const char* format)
+{
+    if (threadId == 0)
+        threadId = nextThreadId.fetch_add(1, std::memory_order_relaxed);
+
+    record.timestamp = (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - LogEpoch).count();
+    record.format = format;
+    record.threadId = threadId;
+    record.level = level;
+    record.category = category;
+    record.argCount = 0;
+    record.flags = 0;
+    record.payloadSize = 0;
+}
+
+bool Logger::Reserve(Record& record, size_t& offset, ArgType type, size_t bytes)
+{
+    if (offset + 1 + bytes > sizeof(record.payload))
+    {
+        record.flags |= RECORD_TRUNCATED;
+        return false;
+    }
+    record.payload[offset++] = (char)type;
+    record.argCount++;
+    return true;
+}
+
+void Logger::EncodeInt(Record& record, size_t& offset, int64_t value)
+{
+    if (!Reserve(record, offset, ARG_INT, sizeof(value)))
+        return;
+    memcpy(record.payload + offset, &value, sizeof(value));
+    offset += sizeof(value);
+}
+
+void Logger::EncodeUInt(Record& record, size_t& offset, uint64_t value)
+{
+    if (!Reserve(record, offset, ARG_UINT, sizeof(value)))
+        return;
+    memcpy(record.payload + offset, &value, sizeof(value));
+    offset += sizeof(value);
+}
+
+void Logger::EncodeDouble(Record& record, size_t& offset, double value)
+{
+    if (!Reserve(record, offset, ARG_DOUBLE, sizeof(value)))
+        return;
+    memcpy(record.payload + offset, &value, sizeof(value));
+    offset += sizeof(value);
+}
+
+void Logger::EncodeString(Record& record, size_t& offset, const char* text, size_t length)
+{
+    // Longitud en 2 bytes; si no cabe entero se recorta a lo que quede
+    const size_t header = 1 + sizeof(uint16_t);
+    if (offset + header > sizeof(record.payload))
+    {
+        record.flags |= RECORD_TRUNCATED;
+        return;
+    }
+    size_t room = sizeof(record.payload) - offset - header;
+    if (length > room)
+    {
+        length = room;
+        record.flags |= RECORD_TRUNCATED;
+    }
+
+    Reserve(record, offset, ARG_STRING, sizeof(uint16_t) + length);
+    uint16_t size = (uint16_t)length;
+    memcpy(record.payload + offset, &size, sizeof(size));
+    offset += sizeof(size);
+    memcpy(record.payload + offset, text, length);
+    offset += length;
+}
+
+void Logger::EncodePointer(Record& record, size_t& offset, const void* ptr)
+{
+    uint64_t value = (uint64_t)(uintptr_t)ptr;
+    if (!Reserve(record, offset, ARG_POINTER, sizeof(value)))
+        return;
+    memcpy(record.payload + offset, &value, sizeof(value));
+    offset += sizeof(value);
+}
+
+void Logger::Encode(Record& record, size_t& offset, bool value)
+{
+    if (!Reserve(record, offset, ARG_BOOL, 1))
+        return;
+    record.payload[offset++] = value ? 1 : 0;
+}
+
+void Logger::Encode(Record& record, size_t& offset, char value)
+{
+    if (!Reserve(record, offset, ARG_CHAR, 1))
+        return;
+    record.payload[offset++] = value;
+}
+
+void Logger::Encode(Record& record, size_t& offset, const char* value)
+{
+    if (!value)
+        value = "(null)";
+    EncodeString(record, offset, value, strlen(value));
+}
+
+void Logger::Encode(Record& record, size_t& offset, const std::string& value)
+{
+    EncodeString(record, offset, value.data(), value.size());
+}
+
+void Logger::WriteText(Level level, Category category, const char* text)
+{
+    if ((int)level < minLevel.load(std::memory_order_relaxed))
+        return;
+
+    uint32_t position = 0;
+    Record* record = Acquire(position);
+    if (!record)
+        return;
+
+    Begin(*record, level, category, nullptr);
+    size_t length = strlen(text);
+    if (length > sizeof(record->payload))
+    {
+        length = sizeof(record->payload);
+        record->flags |= RECORD_TRUNCATED;
+    }
+    memcpy(record->payload, text, length);
+    record->payloadSize = (uint16_t)length;
+    record->flags |= RECORD_PREFORMATTED;
+    Publish(position);
+}
+
+void Logger::WriteTextV(Level level, Category category, const char* format, va_list args)
+{
+    if ((int)level < minLevel.load(std::memory_order_relaxed))
+        return;
+
+    uint32_t position = 0;
+    Record* record = Acquire(position);
+    if (!record)
+        return;
+
+    // printf directo sobre el registro: sin buffer intermedio ni std::string
+    Begin(*record, level, category, nullptr);
+    int length = vsnprintf(record->payload, sizeof(record->payload), format, args);
+    if (length < 0)
+        length = 0;
+    if ((size_t)length >= sizeof(record->payload))
+    {
+        length = (int)sizeof(record->payload) - 1;
+        record->flags |= RECORD_TRUNCATED;
+    }
+    record->payloadSize = (uint16_t)length;
+    record->flags |= RECORD_PREFORMATTED;
+    Publish(position);
+}
+
+std::string Logger::Format(const Record& record)
+{
+    std::string text;
+    if (record.flags & RECORD_PREFORMATTED)
+    {
+        text.assign(record.payload, record.payloadSize);
+    }
+    else
+    {
+        fmt::dynamic_format_arg_store<fmt::format_context> store;
+        const char* data = record.payload;
+        for (uint8_t i = 0; i < record.argCount; ++i)
+        {
+            ArgType type = (ArgType)*data++;
+            switch (type)
+            {
+            case ARG_INT: { int64_t v; memcpy(&v, data, sizeof(v)); data += sizeof(v); store.push_back(v); break; }
+            case ARG_UINT: { uint64_t v; memcpy(&v, data, sizeof(v)); data += sizeof(v); store.push_back(v); break; }
+            case ARG_DOUBLE: { double v; memcpy(&v, data, sizeof(v)); data += sizeof(v); store.push_back(v); break; }
+            case ARG_BOOL: store.push_back(*data++ != 0); break;
+            case ARG_CHAR: store.push_back(*data++); break;
+            case ARG_STRING:
+            {
+                uint16_t length;
+                memcpy(&length, data, sizeof(length));
+                data += sizeof(length);
+                store.push_back(fmt::string_view(data, length));
+                data += length;
+                break;
+            }
+            case ARG_POINTER:
+            {
+                uint64_t v;
+                memcpy(&v, data, sizeof(v));
+                data += sizeof(v);
+                store.push_back((const void*)(uintptr_t)v);
+                break;
+            }
+            }
+        }
+
+        try
+        {
+            text = fmt::vformat(record.format, store);
+        }
+        catch (const fmt::format_error& e)
+        {
+            text = std::string(record.format) + " [log format error: " + e.what() + "]";
+        }
+    }
+
+    if (record.flags & RECORD_TRUNCATED)
+        text += "...";
+    return text;
+}
+
+void Logger::Drain()
+{
+    char prefix[64];
+    bool wroteFile = false;
+
+    for (;;)
+    {
+        LoggerRing::Cell& cell = ring.cells[ring.dequeuePosition & RingMask];
+        if (cell.sequence.load(std::memory_order_acquire) != ring.dequeuePosition + 1)
+            break;
+
+        const Record& record = cell.record;
+        Line line;
+        line.level = record.level;
+        line.category = record.category;
+        line.text = Format(record);
+
+        snprintf(prefix, sizeof(prefix), "[%10.3f] [%s] [%s] ", record.timestamp / 1e9,
+            GetLevelName(record.level), GetCategoryName(record.category));
+
+        // Celda libre para la siguiente vuelta de los productores
+        cell.sequence.store(ring.dequeuePosition + RingCapacity, std::memory_order_release);
+        ring.dequeuePosition++;
+
+        if (logFile.is_open())
+        {
+            logFile << prefix << line.text << '\n';
+            wroteFile = true;
+        }
+        if (echoToStdout.load(std::memory_order_relaxed))
+            std::cout << line.text << '\n';
+
+        std::lock_guard<std::mutex> lock(historyMutex);
+        history.push_back(std::move(line));
+        if (history.size() > HistoryCapacity)
+        {
+            history.pop_front();
+            historyBase++;
+        }
+    }
+
+    if (wroteFile)
+        logFile.flush();
+}
+
+void Logger::ThreadLoop()
+{
+    Profiler::SetThreadName("Logger");
+    MEMORY_TAG(EDITOR);
+
+    while (running.load(std::memory_order_acquire))
+    {
+        {
+            PROFILE_SCOPE("Log drain");
+            Drain();
+        }
+        std::unique_lock<std::mutex> lock(wakeMutex);
+        wakeCondition.wait_for(lock, std::chrono::milliseconds(5));
+    }
+    Drain();
+}
+
+void Logger::Init(const std::string& filePath)
+{
+    if (running)
+        return;
+
+    size_t slash = filePath.find_last_of("/\\");
+    if (slash != std::string::npos)
+        FileUtils::CreateDirectories(filePath.substr(0, slash));
+
+    logFile.open(filePath, std::ios::trunc);
+    if (!logFile)
+        std::cerr << "[Logger] Could not open " << filePath << std::endl;
+
+    running = true;
+    loggerThread = std::thread(ThreadLoop);
+}
+
+void Logger::Shutdown()
+{
+    if (!running)
+        return;
+
+    running = false;
+    wakeCondition.notify_one();
+    if (loggerThread.joinable())
+        loggerThread.join();
+
+    if (droppedCount > 0 && logFile.is_open())
+        logFile << "[Logger] " << droppedCount << " messages dropped (ring buffer full)\n";
+    logFile.close();
+}
+
+void Logger::ClearHistory()
+{
+    std::lock_guard<std::mutex> lock(historyMutex);
+    historyBase += history.size();
+    history.clear();
+}
+
+const char* Logger::GetLevelName(Level level)
+{
+    switch (level)
+    {
+    case Level::TRACE: return "TRACE";
+    case Level::DEBUG: return "DEBUG";
+    case Level::INFO: return "INFO";
+    case Level::WARN: return "WARN";
+    case Level::ERR: return "ERROR";
+    default: return "?";
+    }
+}
+
+const char* Logger::GetCategoryName(Category category)
+{
+    switch (category)
+    {
+    case Category::ENGINE: return "Engine";
+    case Category::SCENE: return "Scene";
+    case Category::MESH: return "Mesh";
+    case Category::TEXTURE: return "Texture";
+    case Category::RENDER: return "Render";
+    case Category::EDITOR: return "Editor";
+    case Category::IMPORT: return "Import";
+    default: return "?";
+    }
+}
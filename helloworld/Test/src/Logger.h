@@ -0,0 +1,175 @@
+#pragma once
+#include <atomic>
+#include <cstdarg>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <type_traits>
+
+// Log asíncrono. Quien escribe solo reserva un hueco en un anillo de registros de
+// tamaño fijo (varios productores, sin locks) y copia el formato y los argumentos
+// en binario; el hilo del logger los formatea con fmt ("{}") y los pasa a los
+// sinks: archivo, stdout y el historial de la consola del editor.
+// Si el anillo está lleno el mensaje se descarta (GetDroppedCount), nunca se espera.
+//
+// El formato debe ser un literal: se guarda el puntero, no el texto.
+// Los niveles por debajo de ENGINE_LOG_LEVEL no generan código.
+class Logger
+{
+public:
+    // ERR y no ERROR: wingdi.h define ERROR como macro
+    enum class Level : uint8_t { TRACE, DEBUG, INFO, WARN, ERR, COUNT };
+    enum class Category : uint8_t { ENGINE, SCENE, MESH, TEXTURE, RENDER, EDITOR, IMPORT, COUNT };
+
+    struct Line
+    {
+        Level level = Level::INFO;
+        Category category = Category::ENGINE;
+        std::string text;
+    };
+
+    static const size_t HistoryCapacity = 8192;
+
+    static std::atomic<int> minLevel;       // filtro en tiempo de ejecución (Level)
+    static std::atomic<bool> echoToStdout;
+
+    // Abre el archivo y arranca el hilo; lo escrito antes de Init espera en el anillo
+    static void Init(const std::string& filePath);
+    // Vacía el anillo, cierra el archivo y para el hilo
+    static void Shutdown();
+
+    template <typename... Args>
+    static void Write(Level level, Category category, const char* format, const Args&... args)
+    {
+        if ((int)level < minLevel.load(std::memory_order_relaxed))
+            return;
+
+        uint32_t position = 0;
+        Record* record = Acquire(position);
+        if (!record)
+            return;
+
+        Begin(*record, level, category, format);
+        size_t offset = 0;
+        int expand[] = { 0, (Encode(*record, offset, args), 0)... };
+        (void)expand;
+        record->payloadSize = (uint16_t)offset;
+        Publish(position);
+    }
+
+    // Texto ya formateado (ModuleEditor::PushEngineLog / PushEnginePrintf)
+    static void WriteText(Level level, Category category, const char* text);
+    static void WriteTextV(Level level, Category category, const char* format, va_list args);
+
+    // Historial para la consola: mantener el lock mientras se recorre
+    static std::mutex& GetHistoryMutex() { return historyMutex; }
+    static const std::deque<Line>& GetHistory() { return history; }
+    // Número de secuencia de history[0]: crece al descartar líneas, así las
+    // vistas filtradas solo procesan lo nuevo
+    static uint64_t GetHistoryBase() { return historyBase; }
+    static void ClearHistory();
+
+    static uint64_t GetDroppedCount() { return droppedCount; }
+    static const char* GetLevelName(Level level);
+    static const char* GetCategoryName(Category category);
+
+private:
+    friend struct LoggerRing;
+
+    enum ArgType : uint8_t { ARG_INT, ARG_UINT, ARG_DOUBLE, ARG_BOOL, ARG_CHAR, ARG_STRING, ARG_POINTER };
+
+    enum RecordFlags : uint8_t
+    {
+        RECORD_PREFORMATTED = 1 << 0,   // payload = texto final
+        RECORD_TRUNCATED = 1 << 1       // algún argumento no cupo
+    };
+
+    // 256 bytes por registro: cabecera + argumentos codificados
+    struct Record
+    {
+        uint64_t timestamp;             // ns desde Init
+        const char* format;
+        uint32_t threadId;
+        Level level;
+        Category category;
+        uint8_t argCount;
+        uint8_t flags;
+        uint16_t payloadSize;
+        char payload[226];
+    };
+
+    static Record* Acquire(uint32_t& position);
+    static void Publish(uint32_t position);
+    static void Begin(Record& record, Level level, Category category, const char* format);
+
+    static bool Reserve(Record& record, size_t& offset, ArgType type, size_t bytes);
+    static void EncodeInt(Record& record, size_t& offset, int64_t value);
+    static void EncodeUInt(Record& record, size_t& offset, uint64_t value);
+    static void EncodeDouble(Record& record, size_t& offset, double value);
+    static void EncodeString(Record& record, size_t& offset, const char* text, size_t length);
+    static void EncodePointer(Record& record, size_t& offset, const void* ptr);
+
+    static void Encode(Record& record, size_t& offset, bool value);
+    static void Encode(Record& record, size_t& offset, char value);
+    static void Encode(Record& record, size_t& offset, const char* value);
+    static void Encode(Record& record, size_t& offset, const std::string& value);
+
+    template <typename T>
+    static typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value>::type
+        Encode(Record& record, size_t& offset, T value) { EncodeInt(record, offset, (int64_t)value); }
+
+    template <typename T>
+    static typename std::enable_if<std::is_integral<T>::value && !std::is_signed<T>::value>::type
+        Encode(Record& record, size_t& offset, T value) { EncodeUInt(record, offset, (uint64_t)value); }
+
+    template <typename T>
+    static typename std::enable_if<std::is_floating_point<T>::value>::type
+        Encode(Record& record, size_t& offset, T value) { EncodeDouble(record, offset, (double)value); }
+
+    template <typename T>
+    static typename std::enable_if<!std::is_same<typename std::remove_cv<T>::type, char>::value>::type
+        Encode(Record& record, size_t& offset, T* value) { EncodePointer(record, offset, value); }
+
+    static void ThreadLoop();
+    static void Drain();
+    static std::string Format(const Record& record);
+
+    static std::atomic<uint64_t> droppedCount;
+    static std::mutex historyMutex;
+    static std::deque<Line> history;
+    static uint64_t historyBase;
+};
+
+#ifndef ENGINE_LOG_LEVEL
+#define ENGINE_LOG_LEVEL 1
+#endif
+
+#define LOG_AT(level, category, ...) Logger::Write(Logger::Level::level, Logger::Category::category, __VA_ARGS__)
+
+#if ENGINE_LOG_LEVEL <= 0
+#define LOG_TRACE(category, ...) LOG_AT(TRACE, category, __VA_ARGS__)
+#else
+#define LOG_TRACE(category, ...) ((void)0)
+#endif
+
+#if ENGINE_LOG_LEVEL <= 1
+#define LOG_DEBUG(category, ...) LOG_AT(DEBUG, category, __VA_ARGS__)
+#else
+#define LOG_DEBUG(category, ...) ((void)0)
+#endif
+
+#if ENGINE_LOG_LEVEL <= 2
+#define LOG_INFO(category, ...) LOG_AT(INFO, category, __VA_ARGS__)
+#else
+#define LOG_INFO(category, ...) ((void)0)
+#endif
+
+#if ENGINE_LOG_LEVEL <= 3
+#define LOG_WARN(category, ...) LOG_AT(WARN, category, __VA_ARGS__)
+#else
+#define LOG_WARN(category, ...) ((void)0)
+#endif
+
+#define LOG_ERROR(category, ...) LOG_AT(ERR, category, __VA_ARGS__)
@@ -0,0 +1,334 @@
+#include "MemoryTracker.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <mutex>
+#include <new>
+#include <unordered_map>
+
+namespace
+{
+    // Cabecera delante de cada bloque; 16 bytes para no romper la alineación de malloc
+    struct BlockHeader
+    {
+        size_t size;
+        uint32_t magic;
+        uint8_t tag;
+        uint8_t hasSite;
+        uint16_t padding;
+    };
+    static_assert(sizeof(BlockHeader) == 16, "BlockHeader must keep malloc alignment");
+
+    const uint32_t BlockMagic = 0x4D454D54;     // "MEMT"
+    const int TagCount = (int)MemoryTracker::Tag::COUNT;
+
+    struct AtomicStats
+    {
+        std::atomic<size_t> currentBytes;
+        std::atomic<size_t> peakBytes;
+        std::atomic<size_t> currentCount;
+        std::atomic<size_t> peakCount;
+        std::atomic<uint64_t> totalAllocations;
+    };
+
+    // Inicialización a cero estática: operator new puede llamarse antes que cualquier constructor
+    AtomicStats tagStats[TagCount];
+    std::atomic<bool> captureSites(false);
+    std::atomic<uint64_t> foreignFrees(0);
+
+    thread_local MemoryTracker::Tag currentTag = MemoryTracker::Tag::UNTAGGED;
+    thread_local const char* currentSite = nullptr;
+    thread_local bool readingSites = false;     // GetLiveSites reserva con siteMutex tomado
+
+    void UpdatePeak(std::atomic<size_t>& peak, size_t value)
+    {
+        size_t previous = peak.load(std::memory_order_relaxed);
+        while (value > previous && !peak.compare_exchange_weak(previous, value, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    // El mapa de sitios reserva con malloc para no volver a entrar en operator new
+    template <typename T>
+    struct MallocAllocator
+    {
+        using value_type = T;
+
+        MallocAllocator() = default;
+        template <typename U>
+        MallocAllocator(const MallocAllocator<U>&) {}
+
+        T* allocate(size_t count)
+        {
+            void* ptr = std::malloc(count * sizeof(T));
+            if (!ptr)
+                throw std::bad_alloc();
+            return static_cast<T*>(ptr);
+        }
+        void deallocate(T* ptr, size_t) { std::free(ptr); }
+
+        template <typename U>
+        bool operator==(const MallocAllocator<U>&) const { return true; }
+        template <typename U>
+        bool operator!=(const MallocAllocator<U>&) const { return false; }
+    };
+
+    struct SiteRecord
+    {
+        const char* site;
+        MemoryTracker::Tag tag;
+        size_t size;
+    };
+
+    using SiteMap = std::unordered_map<const void*, SiteRecord, std::hash<const void*>, std::equal_to<const void*>,
+        MallocAllocator<std::pair<const void* const, SiteRecord>>>;
+
+    std::mutex siteMutex;
+
+    // No se destruye nunca: puede haber deletes después de los destructores estáticos
+    SiteMap& GetSiteMap()
+    {
+        static SiteMap* map = new (std::malloc(sizeof(SiteMap))) SiteMap();
+        return *map;
+    }
+}
+
+void* MemoryTracker::Allocate(size_t size)
+{
+    BlockHeader* header = static_cast<BlockHeader*>(std::malloc(sizeof(BlockHeader) + size));
+    if (!header)
+        return nullptr;
+
+    const Tag tag = currentTag;
+    header->size = size;
+    header->magic = BlockMagic;
+    header->tag = (uint8_t)tag;
+    header->hasSite = 0;
+    header->padding = 0;
+
+    AtomicStats& stats = tagStats[(int)tag];
+    UpdatePeak(stats.peakBytes, stats.currentBytes.fetch_add(size, std::memory_order_relaxed) + size);
+    UpdatePeak(stats.peakCount, stats.currentCount.fetch_add(1, std::memory_order_relaxed) + 1);
+    stats.totalAllocations.fetch_add(1, std::memory_order_relaxed);
+
+    void* ptr = header + 1;
+    if (captureSites.load(std::memory_order_relaxed) && currentSite && !readingSites)
+    {
+        SiteRecord record;
+        record.site = currentSite;
+        record.tag = tag;
+        record.size = size;
+
+        std::lock_guard<std::mutex> lock(siteMutex);
+        GetSiteMap()[ptr] = record;
+        header->hasSite = 1;
+    }
+    return ptr;
+}
+
+void MemoryTracker::Free(void* ptr)
+{
+    if (!ptr)
+        return;
+
+    BlockHeader* header = static_cast<BlockHeader*>(ptr) - 1;
+    if (header->magic != BlockMagic)
+    {
+        // Nada de log aquí: escribir puede reservar y volver a entrar en el allocator
+        foreignFrees.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    AtomicStats& stats = tagStats[header->tag];
+    stats.currentBytes.fetch_sub(header->size, std::memory_order_relaxed);
+    stats.currentCount.fetch_sub(1, std::memory_order_relaxed);
+
+    if (header->hasSite)
+    {
+        std::lock_guard<std::mutex> lock(siteMutex);
+        GetSiteMap().erase(ptr);
+    }
+
+    header->magic = 0;
+    std::free(header);
+}
+
+uint64_t MemoryTracker::GetForeignFreeCount()
+{
+    return foreignFrees.load(std::memory_order_relaxed);
+}
+
+MemoryTracker::TagStats MemoryTracker::GetStats(Tag tag)
+{
+    const AtomicStats& source = tagStats[(int)tag];
+    TagStats stats;
+    stats.currentBytes = source.currentBytes.load(std::memory_order_relaxed);
+    stats.peakBytes = source.peakBytes.load(std::memory_order_relaxed);
+    stats.currentCount = source.currentCount.load(std::memory_order_relaxed);
+    stats.peakCount = source.peakCount.load(std::memory_order_relaxed);
+    stats.totalAllocations = source.totalAllocations.load(std::memory_order_relaxed);
+    return stats;
+}
+
+const char* MemoryTracker::GetTagName(Tag tag)
+{
+    switch (tag)
+    {
+    case Tag::UNTAGGED: return "Untagged";
+    case Tag::SCENE: return "Scene";
+    case Tag::MESH: return "Mesh";
+    case Tag::TEXTURE: return "Texture";
+    case Tag::EDITOR: return "Editor";
+    case Tag::IMPORT: return "Import";
+    default: return "Unknown";
+    }
+}
+
+bool MemoryTracker::IsEnabled()
+{
+#if defined(ENGINE_MEMORY_TRACKING)
+    return true;
+#else
+    return false;
+#endif
+}
+
+void MemoryTracker::SetSiteCapture(bool enabled)
+{
+    captureSites = enabled;
+}
+
+bool MemoryTracker::IsSiteCapture()
+{
+    return captureSites;
+}
+
+std::vector<MemoryTracker::SiteStats> MemoryTracker::GetLiveSites()
+{
+    std::vector<SiteStats> sites;
+    {
+        std::lock_guard<std::mutex> lock(siteMutex);
+        readingSites = true;
+        for (const auto& entry : GetSiteMap())
+        {
+            const SiteRecord& record = entry.second;
+            auto it = std::find_if(sites.begin(), sites.end(), [&](const SiteStats& site)
+                { return site.site == record.site && site.tag == record.tag; });
+            if (it == sites.end())
+            {
+                SiteStats site;
+                site.site = record.site;
+                site.tag = record.tag;
+                sites.push_back(site);
+                it = sites.end() - 1;
+            }
+            it->count++;
+            it->bytes += record.size;
+        }
+        readingSites = false;
+    }
+
+    std::sort(sites.begin(), sites.end(), [](const SiteStats& a, const SiteStats& b) { return a.bytes > b.bytes; });
+    return sites;
+}
+
+void MemoryTracker::ReportLeaks()
+{
+    if (!IsEnabled())
+        return;
+
+    std::cout << "[MemoryTracker] Live allocations at shutdown:" << std::endl;
+    for (int i = 0; i < TagCount; ++i)
+    {
+        TagStats stats = GetStats((Tag)i);
+        if (stats.currentCount == 0)
+            continue;
+        std::cout << "[MemoryTracker]   " << GetTagName((Tag)i) << ": " << stats.currentCount
+            << " blocks, " << stats.currentBytes << " bytes (peak " << stats.peakBytes << ")" << std::endl;
+    }
+    if (GetForeignFreeCount() > 0)
+        std::cout << "[MemoryTracker]   " << GetForeignFreeCount() << " frees of blocks not allocated by the tracker" << std::endl;
+
+    if (!IsSiteCapture())
+        return;
+
+    for (const SiteStats& site : GetLiveSites())
+    {
+        std::cout << "[MemoryTracker]   " << site.site << " [" << GetTagName(site.tag) << "]: "
+            << site.count << " blocks, " << site.bytes << " bytes" << std::endl;
+    }
+}
+
+MemoryTracker::Scope::Scope(Tag tag, const char* site)
+    : previousTag(currentTag), previousSite(currentSite)
+{
+    currentTag = tag;
+    currentSite = site;
+}
+
+MemoryTracker::Scope::~Scope()
+{
+    currentTag = previousTag;
+    currentSite = previousSite;
+}
+
+#if defined(ENGINE_MEMORY_TRACKING)
+
+void* operator new(size_t size)
+{
+    void* ptr = MemoryTracker::Allocate(size);
+    if (!ptr)
+        throw std::bad_alloc();
+    return ptr;
+}
+
+void* operator new[](size_t size)
+{
+    void* ptr = MemoryTracker::Allocate(size);
+    if (!ptr)
+        throw std::bad_alloc();
+    return ptr;
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept
+{
+    return MemoryTracker::Allocate(size);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept
+{
+    return MemoryTracker::Allocate(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    MemoryTracker::Free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    MemoryTracker::Free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept
+{
+    MemoryTracker::Free(ptr);
+}
+
+void operator delete[](void* ptr, size_t) noexcept
+{
+    MemoryTracker::Free(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept
+{
+    MemoryTracker::Free(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept
+{
+    MemoryTracker::Free(ptr);
+}
+
+#endif
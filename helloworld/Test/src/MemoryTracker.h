@@ -0,0 +1,75 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Contabilidad de RAM por subsistema. Con ENGINE_MEMORY_TRACKING se reemplazan
+// los operator new/delete globales: cada bloque lleva una cabecera con su tamaño
+// y la etiqueta activa en el hilo al reservarlo (MEMORY_TAG), así que al liberarlo
+// se descuenta de la misma categoría aunque se haga desde otro sitio u otro hilo.
+// Lo que reservan las DLL por su cuenta (Assimp) no pasa por aquí; DevIL e ImGui
+// sí, porque se les dan Allocate/Free como funciones de memoria.
+class MemoryTracker
+{
+public:
+    enum class Tag : uint8_t { UNTAGGED, SCENE, MESH, TEXTURE, EDITOR, IMPORT, COUNT };
+
+    struct TagStats
+    {
+        size_t currentBytes = 0;
+        size_t peakBytes = 0;
+        size_t currentCount = 0;
+        size_t peakCount = 0;
+        uint64_t totalAllocations = 0;
+    };
+
+    // Reserva con la etiqueta del hilo actual; Free acepta nullptr
+    static void* Allocate(size_t size);
+    static void Free(void* ptr);
+
+    static TagStats GetStats(Tag tag);
+    // Bloques recibidos en Free que no reservó el tracker (se ignoran)
+    static uint64_t GetForeignFreeCount();
+    static const char* GetTagName(Tag tag);
+    static bool IsEnabled();
+
+    // Con la captura activa se apunta el sitio (función del MEMORY_TAG) de cada
+    // reserva nueva, para saber de dónde vienen las que siguen vivas
+    static void SetSiteCapture(bool enabled);
+    static bool IsSiteCapture();
+
+    struct SiteStats
+    {
+        const char* site = nullptr;
+        Tag tag = Tag::UNTAGGED;
+        size_t count = 0;
+        size_t bytes = 0;
+    };
+    // Reservas vivas con sitio, agrupadas y ordenadas por bytes
+    static std::vector<SiteStats> GetLiveSites();
+
+    // Vuelca al log las reservas que siguen vivas (Application::CleanUp)
+    static void ReportLeaks();
+
+    class Scope
+    {
+    public:
+        Scope(Tag tag, const char* site);
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        Tag previousTag;
+        const char* previousSite;
+    };
+};
+
+#if defined(ENGINE_MEMORY_TRACKING)
+#define MEMORY_CONCAT_INNER(a, b) a##b
+#define MEMORY_CONCAT(a, b) MEMORY_CONCAT_INNER(a, b)
+#define MEMORY_TAG(tag) MemoryTracker::Scope MEMORY_CONCAT(memoryScope_, __LINE__)(MemoryTracker::Tag::tag, __FUNCTION__)
+#else
+#define MEMORY_TAG(tag) ((void)0)
+#endif
@@ -34,17 +34,23 @@ public:
     vector<unsigned int> indices;
     vector<MeshTexture>  textures;
     unsigned int VAO;
+    unsigned int indexCount = 0;
    
     glm::mat4 modelMatrix = glm::mat4(1.0f);
 
     // constructor
     Mesh(vector<Vertex> vertices, vector<unsigned int> indices, vector<MeshTexture> textures)
     {
-        this->vertices = vertices;
-        this->indices = indices;
+        this->vertices = std::move(vertices);
+        this->indices = std::move(indices);
         this->textures = textures;
 
         setupMesh();
+
+        // the data lives on the GPU now, drop the CPU copies
+        indexCount = (unsigned int)this->indices.size();
+        vector<Vertex>().swap(this->vertices);
+        vector<unsigned int>().swap(this->indices);
     }
 
     void Mesh::Draw(Shader& shader)
@@ -69,7 +75,7 @@ public:
         }
 
         glBindVertexArray(VAO);
-        glDrawElements(GL_TRIANGLES, indices.size(), GL_UNSIGNED_INT, 0);
+        glDrawElements(GL_TRIANGLES, indexCount, GL_UNSIGNED_INT, 0);
         glBindVertexArray(0);
 
         glActiveTexture(GL_TEXTURE0);
@@ -0,0 +1,492 @@
+#include "MeshCache.h"
+#include "MeshResource.h"
+#include "VirtualFileSystem.h"
+#include "VirtualIOSystem.h"
+#include "FileUtils.h"
+#include <assimp/Importer.hpp>
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+#include <draco/compression/decode.h>
+#include <draco/compression/encode.h>
+#include <draco/mesh/mesh.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+bool MeshCache::enabled = true;
+bool MeshCache::useDraco = false;
+int MeshCache::positionBits = 14;
+int MeshCache::normalBits = 10;
+int MeshCache::texCoordBits = 12;
+int MeshCache::compressionLevel = 7;
+
+std::vector<MeshCache::BenchmarkResult> MeshCache::benchmark;
+
+namespace
+{
+    // Cambiar al modificar el formato o la generación de LODs: invalida las entradas viejas
+    const uint32_t CACHE_VERSION = 1;
+    const uint32_t FLAG_DRACO = 1;
+
+    struct CacheHeader
+    {
+        char magic[4];
+        uint32_t version;
+        uint32_t flags;
+        uint32_t vertexCount;
+        uint32_t indexCount;        // malla completa (LOD 0)
+        uint32_t lodIndexCount;     // resto de LODs
+        uint32_t lodCount;
+    };
+
+    struct CacheLOD
+    {
+        uint32_t indexOffset;
+        uint32_t indexCount;
+        float switchCoverage;
+    };
+
+    // Lo que se guarda de cada vértice sin comprimir (las tangentes no se importan)
+    struct CacheVertex
+    {
+        float position[3];
+        float normal[3];
+        float texCoords[2];
+    };
+
+    void HashBytes(uint64_t& hash, const void* data, size_t size)
+    {
+        // FNV-1a
+        const unsigned char* bytes = (const unsigned char*)data;
+        for (size_t i = 0; i < size; ++i)
+        {
+            hash ^= bytes[i];
+            hash *= 1099511628211ull;
+        }
+    }
+
+    void Append(std::vector<unsigned char>& out, const void* data, size_t size)
+    {
+        const unsigned char* bytes = (const unsigned char*)data;
+        out.insert(out.end(), bytes, bytes + size);
+    }
+
+    const char* ModelExtensions[] = { ".fbx", ".obj", ".gltf", ".glb", ".dae", ".3ds" };
+
+    bool IsModelFile(const std::string& path)
+    {
+        size_t dot = path.find_last_of('.');
+        if (dot == std::string::npos)
+            return false;
+
+        std::string extension = path.substr(dot);
+        std::transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
+        for (const char* candidate : ModelExtensions)
+        {
+            if (extension == candidate)
+                return true;
+        }
+        return false;
+    }
+}
+
+uint64_t MeshCache::Hash(const aiMesh* mesh)
+{
+    uint64_t hash = 14695981039346656037ull;
+
+    // Parámetros que cambian el resultado además del contenido
+    const uint32_t params[] = { CACHE_VERSION, (uint32_t)MeshResource::MAX_LODS, MeshResource::LOD_MIN_TRIANGLES };
+    HashBytes(hash, params, sizeof(params));
+
+    HashBytes(hash, &mesh->mNumVertices, sizeof(mesh->mNumVertices));
+    HashBytes(hash, mesh->mVertices, mesh->mNumVertices * sizeof(aiVector3D));
+    if (mesh->HasNormals())
+        HashBytes(hash, mesh->mNormals, mesh->mNumVertices * sizeof(aiVector3D));
+    if (mesh->mTextureCoords[0])
+        HashBytes(hash, mesh->mTextureCoords[0], mesh->mNumVertices * sizeof(aiVector3D));
+
+    for (unsigned int i = 0; i < mesh->mNumFaces; ++i)
+    {
+        const aiFace& face = mesh->mFaces[i];
+        HashBytes(hash, face.mIndices, face.mNumIndices * sizeof(unsigned int));
+    }
+    return hash;
+}
+
+std::string MeshCache::GetPath(uint64_t hash)
+{
+    char name[32];
+    snprintf(name, sizeof(name), "%016llx", (unsigned long long)hash);
+    return std::string("../Library/Meshes/") + name + ".mesh";
+}
+
+bool MeshCache::Encode(const MeshResource& mesh, bool draco, std::vector<unsigned char>& out)
+{
+    if (mesh.vertices.empty() || mesh.indices.empty())
+        return false;
+
+    out.clear();
+
+    std::vector<unsigned char> payload;
+    if (draco && !EncodeDraco(mesh, payload))
+    {
+        std::cerr << "[MeshCache] Draco encoding failed, storing uncompressed" << std::endl;
+        draco = false;
+    }
+
+    CacheHeader header;
+    std::memcpy(header.magic, "WMSH", 4);
+    header.version = CACHE_VERSION;
+    header.flags = draco ? FLAG_DRACO : 0;
+    header.vertexCount = (uint32_t)mesh.vertices.size();
+    header.indexCount = (uint32_t)mesh.indices.size();
+    header.lodIndexCount = (uint32_t)mesh.lodIndices.size();
+    header.lodCount = (uint32_t)mesh.lods.size();
+    Append(out, &header, sizeof(header));
+
+    for (const MeshLOD& lod : mesh.lods)
+    {
+        CacheLOD entry = { lod.indexOffset, lod.indexCount, lod.switchCoverage };
+        Append(out, &entry, sizeof(entry));
+    }
+
+    if (draco)
+    {
+        Append(out, payload.data(), payload.size());
+        return true;
+    }
+
+    out.reserve(out.size() + mesh.vertices.size() * sizeof(CacheVertex)
+        + (mesh.indices.size() + mesh.lodIndices.size()) * sizeof(unsigned int));
+    for (const MeshVertex& v : mesh.vertices)
+    {
+        CacheVertex packed = {
+            { v.Position.x, v.Position.y, v.Position.z },
+            { v.Normal.x, v.Normal.y, v.Normal.z },
+            { v.TexCoords.x, v.TexCoords.y } };
+        Append(out, &packed, sizeof(packed));
+    }
+    Append(out, mesh.indices.data(), mesh.indices.size() * sizeof(unsigned int));
+    if (!mesh.lodIndices.empty())
+        Append(out, mesh.lodIndices.data(), mesh.lodIndices.size() * sizeof(unsigned int));
+    return true;
+}
+
+bool MeshCache::Decode(const unsigned char* data, size_t size, MeshResource& mesh)
+{
+    CacheHeader header;
+    if (!data || size < sizeof(header))
+        return false;
+
+    std::memcpy(&header, data, sizeof(header));
+    if (std::memcmp(header.magic, "WMSH", 4) != 0 || header.version != CACHE_VERSION
+        || header.lodCount == 0 || header.lodCount > (uint32_t)MeshResource::MAX_LODS)
+        return false;
+
+    size_t offset = sizeof(header);
+    if (size < offset + header.lodCount * sizeof(CacheLOD))
+        return false;
+
+    mesh.lods.clear();
+    for (uint32_t i = 0; i < header.lodCount; ++i)
+    {
+        CacheLOD entry;
+        std::memcpy(&entry, data + offset, sizeof(entry));
+        offset += sizeof(entry);
+
+        MeshLOD lod;
+        lod.indexOffset = entry.indexOffset;
+        lod.indexCount = entry.indexCount;
+        lod.switchCoverage = entry.switchCoverage;
+        mesh.lods.push_back(lod);
+    }
+
+    mesh.vertices.assign(header.vertexCount, MeshVertex());
+    mesh.indices.resize(header.indexCount);
+    mesh.lodIndices.resize(header.lodIndexCount);
+
+    if (header.flags & FLAG_DRACO)
+    {
+        if (!DecodeDraco(data + offset, size - offset, mesh))
+            return false;
+    }
+    else
+    {
+        size_t vertexBytes = (size_t)header.vertexCount * sizeof(CacheVertex);
+        size_t indexBytes = (size_t)header.indexCount * sizeof(unsigned int);
+        size_t lodIndexBytes = (size_t)header.lodIndexCount * sizeof(unsigned int);
+        if (size < offset + vertexBytes + indexBytes + lodIndexBytes)
+            return false;
+
+        for (MeshVertex& v : mesh.vertices)
+        {
+            CacheVertex packed;
+            std::memcpy(&packed, data + offset, sizeof(packed));
+            offset += sizeof(packed);
+
+            v.Position = glm::vec3(packed.position[0], packed.position[1], packed.position[2]);
+            v.Normal = glm::vec3(packed.normal[0], packed.normal[1], packed.normal[2]);
+            v.TexCoords = glm::vec2(packed.texCoords[0], packed.texCoords[1]);
+        }
+        std::memcpy(mesh.indices.data(), data + offset, indexBytes);
+        offset += indexBytes;
+        if (lodIndexBytes > 0)
+            std::memcpy(mesh.lodIndices.data(), data + offset, lodIndexBytes);
+    }
+
+    // Índices o LODs fuera de rango = entrada corrupta
+    for (unsigned int index : mesh.indices)
+    {
+        if (index >= header.vertexCount)
+            return false;
+    }
+    for (unsigned int index : mesh.lodIndices)
+    {
+        if (index >= header.vertexCount)
+            return false;
+    }
+    for (const MeshLOD& lod : mesh.lods)
+    {
+        if ((uint64_t)lod.indexOffset + lod.indexCount > (uint64_t)header.indexCount + header.lodIndexCount)
+            return false;
+    }
+
+    mesh.numVertices = header.vertexCount;
+    mesh.numIndices = header.indexCount;
+    mesh.indexBufferBytes = 0;
+    mesh.BuildCollisionData();
+    return true;
+}
+
+bool MeshCache::EncodeDraco(const MeshResource& mesh, std::vector<unsigned char>& out)
+{
+    const uint32_t vertexCount = (uint32_t)mesh.vertices.size();
+
+    draco::Mesh dracoMesh;
+    dracoMesh.set_num_points(vertexCount);
+
+    auto addAttribute = [&](draco::GeometryAttribute::Type type, int components)
+    {
+        draco::GeometryAttribute attribute;
+        attribute.Init(type, nullptr, (uint8_t)components, draco::DT_FLOAT32, false, sizeof(float) * components, 0);
+        return dracoMesh.attribute(dracoMesh.AddAttribute(attribute, true, vertexCount));
+    };
+    draco::PointAttribute* positions = addAttribute(draco::GeometryAttribute::POSITION, 3);
+    draco::PointAttribute* normals = addAttribute(draco::GeometryAttribute::NORMAL, 3);
+    draco::PointAttribute* texCoords = addAttribute(draco::GeometryAttribute::TEX_COORD, 2);
+
+    for (uint32_t i = 0; i < vertexCount; ++i)
+    {
+        const MeshVertex& v = mesh.vertices[i];
+        positions->SetAttributeValue(draco::AttributeValueIndex(i), &v.Position[0]);
+        normals->SetAttributeValue(draco::AttributeValueIndex(i), &v.Normal[0]);
+        texCoords->SetAttributeValue(draco::AttributeValueIndex(i), &v.TexCoords[0]);
+    }
+
+    // Todos los LODs como una única lista de caras: la tabla de LODs de la
+    // cabecera sigue indicando dónde empieza cada uno
+    const size_t faceCount = (mesh.indices.size() + mesh.lodIndices.size()) / 3;
+    dracoMesh.SetNumFaces(faceCount);
+    for (size_t f = 0; f < faceCount; ++f)
+    {
+        draco::Mesh::Face face;
+        for (int k = 0; k < 3; ++k)
+        {
+            size_t i = f * 3 + k;
+            unsigned int index = i < mesh.indices.size() ? mesh.indices[i] : mesh.lodIndices[i - mesh.indices.size()];
+            face[k] = draco::PointIndex(index);
+        }
+        dracoMesh.SetFace(draco::FaceIndex((uint32_t)f), face);
+    }
+
+    // Codificación secuencial: conserva el orden de vértices y caras (edgebreaker
+    // los reordena y rompería los rangos de LOD y el orden optimizado para la caché)
+    draco::Encoder encoder;
+    encoder.SetEncodingMethod(draco::MESH_SEQUENTIAL_ENCODING);
+    int speed = 10 - std::max(0, std::min(10, compressionLevel));
+    encoder.SetSpeedOptions(speed, speed);
+    encoder.SetAttributeQuantization(draco::GeometryAttribute::POSITION, positionBits);
+    encoder.SetAttributeQuantization(draco::GeometryAttribute::NORMAL, normalBits);
+    encoder.SetAttributeQuantization(draco::GeometryAttribute::TEX_COORD, texCoordBits);
+
+    draco::EncoderBuffer buffer;
+    draco::Status status = encoder.EncodeMeshToBuffer(dracoMesh, &buffer);
+    if (!status.ok())
+    {
+        std::cerr << "[MeshCache] Draco: " << status.error_msg() << std::endl;
+        return false;
+    }
+
+    out.assign(buffer.data(), buffer.data() + buffer.size());
+    return true;
+}
+
+bool MeshCache::DecodeDraco(const unsigned char* data, size_t size, MeshResource& mesh)
+{
+    draco::DecoderBuffer buffer;
+    buffer.Init((const char*)data, size);
+
+    draco::Decoder decoder;
+    draco::StatusOr<std::unique_ptr<draco::Mesh>> result = decoder.DecodeMeshFromBuffer(&buffer);
+    if (!result.ok())
+    {
+        std::cerr << "[MeshCache] Draco: " << result.status().error_msg() << std::endl;
+        return false;
+    }
+    std::unique_ptr<draco::Mesh> dracoMesh = std::move(result).value();
+
+    const size_t totalIndices = mesh.indices.size() + mesh.lodIndices.size();
+    if (dracoMesh->num_points() != mesh.vertices.size() || (size_t)dracoMesh->num_faces() * 3 != totalIndices)
+        return false;
+
+    const draco::PointAttribute* positions = dracoMesh->GetNamedAttribute(draco::GeometryAttribute::POSITION);
+    const draco::PointAttribute* normals = dracoMesh->GetNamedAttribute(draco::GeometryAttribute::NORMAL);
+    const draco::PointAttribute* texCoords = dracoMesh->GetNamedAttribute(draco::GeometryAttribute::TEX_COORD);
+    if (!positions || !normals || !texCoords)
+        return false;
+
+    for (uint32_t i = 0; i < (uint32_t)mesh.vertices.size(); ++i)
+    {
+        MeshVertex& v = mesh.vertices[i];
+        draco::PointIndex point(i);
+        positions->ConvertValue<float, 3>(positions->mapped_index(point), &v.Position[0]);
+        normals->ConvertValue<float, 3>(normals->mapped_index(point), &v.Normal[0]);
+        texCoords->ConvertValue<float, 2>(texCoords->mapped_index(point), &v.TexCoords[0]);
+    }
+
+    for (uint32_t f = 0; f < dracoMesh->num_faces(); ++f)
+    {
+        const draco::Mesh::Face& face = dracoMesh->face(draco::FaceIndex(f));
+        for (int k = 0; k < 3; ++k)
+        {
+            size_t i = (size_t)f * 3 + k;
+            if (i < mesh.indices.size())
+                mesh.indices[i] = face[k].value();
+            else
+                mesh.lodIndices[i - mesh.indices.size()] = face[k].value();
+        }
+    }
+    return true;
+}
+
+bool MeshCache::Save(const std::string& path, const MeshResource& mesh)
+{
+    std::vector<unsigned char> data;
+    if (!Encode(mesh, useDraco, data))
+        return false;
+
+    size_t slash = path.find_last_of("/\\");
+    if (slash != std::string::npos)
+        FileUtils::CreateDirectories(path.substr(0, slash));
+
+    // Los jobs de Preload pueden guardar el mismo hash a la vez: cada uno escribe
+    // su temporal y lo renombra, así nadie lee una entrada a medio escribir
+    std::string tempPath = FileUtils::MakeTempPath(path);
+    {
+        std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+        if (!file || !file.write((const char*)data.data(), data.size()))
+        {
+            std::cerr << "[MeshCache] Could not write " << path << std::endl;
+            file.close();
+            std::remove(tempPath.c_str());
+            return false;
+        }
+    }
+    return FileUtils::RenameOver(tempPath, path);
+}
+
+bool MeshCache::Load(const std::string& path, MeshResource& mesh)
+{
+    VirtualFile file = VirtualFileSystem::Open(path);
+    if (!file.IsOpen())
+        return false;
+
+    if (!Decode(file.Data(), file.Size(), mesh))
+    {
+        std::cerr << "[MeshCache] Invalid cache entry, rebuilding: " << path << std::endl;
+        return false;
+    }
+    return true;
+}
+
+const std::vector<MeshCache::BenchmarkResult>& MeshCache::RunBenchmark(const std::string& directory, int iterations)
+{
+    typedef std::chrono::high_resolution_clock Clock;
+
+    benchmark.clear();
+    iterations = std::max(1, iterations);
+
+    for (const std::string& relative : FileUtils::ListFiles(directory))
+    {
+        if (!IsModelFile(relative))
+            continue;
+
+        const std::string path = directory + "/" + relative;
+        Assimp::Importer importer;
+        importer.SetIOHandler(new VirtualIOSystem());
+        const aiScene* scene = importer.ReadFile(path,
+            aiProcess_Triangulate |
+            aiProcess_FlipUVs |
+            aiProcess_GenNormals |
+            aiProcess_JoinIdenticalVertices);
+        if (!scene || !scene->mRootNode)
+            continue;
+
+        BenchmarkResult result;
+        result.model = relative;
+
+        for (unsigned int m = 0; m < scene->mNumMeshes; ++m)
+        {
+            MeshResource source;
+            source.ImportFromAssimp(scene->mMeshes[m]);
+
+            std::vector<unsigned char> raw, draco;
+            if (!Encode(source, false, raw) || !Encode(source, true, draco))
+                continue;
+
+            result.meshes++;
+            result.vertices += source.GetVertexCount();
+            result.triangles += source.GetIndexCount() / 3;
+            result.rawBytes += raw.size();
+            result.dracoBytes += draco.size();
+
+            // Mismo trabajo que una carga desde caché (incluye los datos de colisión)
+            Clock::time_point start = Clock::now();
+            for (int i = 0; i < iterations; ++i)
+            {
+                MeshResource decoded;
+                Decode(raw.data(), raw.size(), decoded);
+            }
+            Clock::time_point middle = Clock::now();
+            for (int i = 0; i < iterations; ++i)
+            {
+                MeshResource decoded;
+                Decode(draco.data(), draco.size(), decoded);
+            }
+            Clock::time_point end = Clock::now();
+
+            result.rawDecodeMs += std::chrono::duration<double, std::milli>(middle - start).count() / iterations;
+            result.dracoDecodeMs += std::chrono::duration<double, std::milli>(end - middle).count() / iterations;
+        }
+
+        if (result.meshes > 0)
+            benchmark.push_back(result);
+    }
+
+    std::cout << "[MeshCache] Benchmark (" << positionBits << "/" << normalBits << "/" << texCoordBits
+        << " bits, level " << compressionLevel << ", " << iterations << " iterations)" << std::endl;
+    for (const BenchmarkResult& result : benchmark)
+    {
+        std::cout << std::fixed << std::setprecision(2)
+            << "[MeshCache]   " << result.model << ": "
+            << result.rawBytes / 1024.0 << " KB raw / " << result.dracoBytes / 1024.0 << " KB Draco ("
+            << 100.0 * result.dracoBytes / std::max<size_t>(1, result.rawBytes) << "%), decode "
+            << result.rawDecodeMs << " ms raw / " << result.dracoDecodeMs << " ms Draco" << std::endl;
+        std::cout.unsetf(std::ios::floatfield);
+    }
+    return benchmark;
+}
@@ -0,0 +1,57 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class MeshResource;
+struct aiMesh;
+
+// Caché en disco de las mallas ya procesadas (vértices, índices y LODs) en
+// Library/Meshes, indexada por un hash del contenido de la aiMesh: la
+// simplificación de LODs solo se paga la primera vez que se importa un modelo.
+// Cada entrada va sin comprimir o codificada con Draco (cuantizada, más pequeña
+// en disco a cambio de tiempo de decodificación).
+class MeshCache
+{
+public:
+    static bool enabled;
+
+    // Draco: aplica a las entradas que se escriban a partir de ahora
+    static bool useDraco;
+    static int positionBits;
+    static int normalBits;
+    static int texCoordBits;
+    static int compressionLevel;    // 0 (decodifica más rápido) - 10 (más pequeño)
+
+    static uint64_t Hash(const aiMesh* mesh);
+    static std::string GetPath(uint64_t hash);
+
+    // Serializa los datos de CPU de la malla (antes de ReleaseCPUData)
+    static bool Encode(const MeshResource& mesh, bool draco, std::vector<unsigned char>& out);
+    // Rellena vértices, índices, LODs y datos de colisión; no toca la GPU
+    static bool Decode(const unsigned char* data, size_t size, MeshResource& mesh);
+
+    static bool Save(const std::string& path, const MeshResource& mesh);
+    static bool Load(const std::string& path, MeshResource& mesh);
+
+    // Comparativa sin comprimir / Draco para los modelos de un directorio
+    struct BenchmarkResult
+    {
+        std::string model;
+        size_t meshes = 0;
+        size_t vertices = 0;
+        size_t triangles = 0;
+        size_t rawBytes = 0;
+        size_t dracoBytes = 0;
+        double rawDecodeMs = 0.0;
+        double dracoDecodeMs = 0.0;
+    };
+    static const std::vector<BenchmarkResult>& RunBenchmark(const std::string& directory, int iterations = 5);
+    static const std::vector<BenchmarkResult>& GetBenchmark() { return benchmark; }
+
+private:
+    static bool EncodeDraco(const MeshResource& mesh, std::vector<unsigned char>& out);
+    static bool DecodeDraco(const unsigned char* data, size_t size, MeshResource& mesh);
+
+    static std::vector<BenchmarkResult> benchmark;
+};
@@ -0,0 +1,226 @@
+#include "MeshManager.h"
+#include "MeshResource.h"
+#include "MeshCache.h"
+#include "JobSystem.h"
+#include "Profiler.h"
+#include "MemoryTracker.h"
+#include "VirtualIOSystem.h"
+#include "Logger.h"
+#include <assimp/Importer.hpp>
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+
+std::map<MeshManager::Key, std::weak_ptr<MeshResource>> MeshManager::cache;
+unsigned int MeshManager::hits = 0;
+unsigned int MeshManager::misses = 0;
+std::atomic<unsigned int> MeshManager::diskCacheHits(0);
+std::atomic<unsigned int> MeshManager::diskCacheMisses(0);
+double MeshManager::lastPreloadMs = 0.0;
+
+std::string MeshManager::NormalizePath(const std::string& path)
+{
+    // Mismo archivo aunque llegue con otras barras o mayúsculas (rutas de Windows)
+    std::string normalized = path;
+    std::replace(normalized.begin(), normalized.end(), '\\', '/');
+    std::transform(normalized.begin(), normalized.end(), normalized.begin(),
+        [](unsigned char c) { return (char)std::tolower(c); });
+    return normalized;
+}
+
+std::shared_ptr<MeshResource> MeshManager::Load(const std::string& sourcePath, unsigned int meshIndex, const aiMesh* mesh)
+{
+    MEMORY_TAG(MESH);
+    Key key(NormalizePath(sourcePath), meshIndex);
+
+    auto it = cache.find(key);
+    if (it != cache.end())
+    {
+        if (std::shared_ptr<MeshResource> existing = it->second.lock())
+        {
+            hits++;
+            return existing;
+        }
+    }
+
+    if (!mesh)
+    {
+        LOG_ERROR(MESH, "Invalid mesh pointer for {} #{}", sourcePath, meshIndex);
+        return nullptr;
+    }
+
+    std::shared_ptr<MeshResource> resource = std::make_shared<MeshResource>();
+    resource->SetSource(sourcePath, meshIndex);
+    PrepareCPUData(*resource, mesh);
+    resource->UploadToGPU();
+
+    cache[key] = resource;
+    misses++;
+    return resource;
+}
+
+void MeshManager::PrepareCPUData(MeshResource& resource, const aiMesh* mesh)
+{
+    PROFILE_SCOPE("Mesh import");
+    MEMORY_TAG(MESH);
+    // El hash se guarda siempre: las escenas lo usan para encontrar la entrada
+    resource.SetCacheHash(MeshCache::Hash(mesh));
+    if (!MeshCache::enabled)
+    {
+        resource.ImportFromAssimp(mesh);
+        return;
+    }
+
+    std::string cachePath = MeshCache::GetPath(resource.GetCacheHash());
+    if (MeshCache::Load(cachePath, resource))
+    {
+        diskCacheHits++;
+        return;
+    }
+
+    resource.ImportFromAssimp(mesh);
+    MeshCache::Save(cachePath, resource);
+    diskCacheMisses++;
+}
+
+std::vector<std::shared_ptr<MeshResource>> MeshManager::Preload(const std::string& sourcePath, const aiScene* scene)
+{
+    PROFILE_SCOPE("Mesh preload");
+    MEMORY_TAG(MESH);
+    std::vector<std::shared_ptr<MeshResource>> loaded;
+    if (!scene)
+        return loaded;
+
+    std::vector<unsigned int> meshIndices;
+    for (unsigned int i = 0; i < scene->mNumMeshes; ++i)
+    {
+        auto it = cache.find(Key(NormalizePath(sourcePath), i));
+        if ((it == cache.end() || it->second.expired()) && scene->mMeshes[i])
+        {
+            meshIndices.push_back(i);
+            loaded.push_back(std::make_shared<MeshResource>());
+            loaded.back()->SetSource(sourcePath, i);
+        }
+    }
+    if (loaded.empty())
+        return loaded;
+
+    auto start = std::chrono::high_resolution_clock::now();
+    unsigned int hitsBefore = diskCacheHits;
+
+    // Decodificar / importar en los workers; cada job solo toca su recurso
+    JobSystem::ParallelFor(loaded.size(), [&](size_t i)
+    {
+        PrepareCPUData(*loaded[i], scene->mMeshes[meshIndices[i]]);
+    });
+
+    // Subir a GPU en el hilo del contexto
+    for (size_t i = 0; i < loaded.size(); ++i)
+    {
+        loaded[i]->UploadToGPU();
+        cache[Key(NormalizePath(sourcePath), meshIndices[i])] = loaded[i];
+        misses++;
+    }
+
+    lastPreloadMs = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+    LOG_DEBUG(MESH, "Preloaded {} meshes ({} from cache) in {:.2f} ms",
+        loaded.size(), diskCacheHits - hitsBefore, lastPreloadMs);
+    return loaded;
+}
+
+void MeshManager::PurgeExpired()
+{
+    for (auto it = cache.begin(); it != cache.end();)
+    {
+        if (it->second.expired())
+            it = cache.erase(it);
+        else
+            ++it;
+    }
+}
+
+size_t MeshManager::GetLoadedCount()
+{
+    size_t count = 0;
+    for (const auto& entry : cache)
+    {
+        if (!entry.second.expired())
+            count++;
+    }
+    return count;
+}
+
+std::vector<std::shared_ptr<MeshResource>> MeshManager::LoadReferences(const std::vector<Reference>& references)
+{
+    PROFILE_SCOPE("Mesh references");
+    MEMORY_TAG(MESH);
+    std::vector<std::shared_ptr<MeshResource>> result(references.size());
+
+    // Las que ya están en memoria no se tocan
+    std::vector<size_t> pending;
+    for (size_t i = 0; i < references.size(); ++i)
+    {
+        auto it = cache.find(Key(NormalizePath(references[i].sourcePath), references[i].meshIndex));
+        if (it != cache.end() && (result[i] = it->second.lock()))
+        {
+            hits++;
+            continue;
+        }
+
+        result[i] = std::make_shared<MeshResource>();
+        result[i]->SetSource(references[i].sourcePath, references[i].meshIndex);
+        result[i]->SetCacheHash(references[i].cacheHash);
+        pending.push_back(i);
+    }
+
+    // Decodificar las entradas de caché en paralelo
+    std::vector<char> decoded(pending.size(), 0);
+    JobSystem::ParallelFor(pending.size(), [&](size_t p)
+    {
+        const Reference& reference = references[pending[p]];
+        PROFILE_SCOPE("Mesh cache decode");
+        MEMORY_TAG(MESH);
+        if (reference.cacheHash != 0 && MeshCache::Load(MeshCache::GetPath(reference.cacheHash), *result[pending[p]]))
+            decoded[p] = 1;
+    });
+
+    std::map<std::string, std::vector<size_t>> missing;   // archivo de origen -> referencias sin caché
+    for (size_t p = 0; p < pending.size(); ++p)
+    {
+        size_t i = pending[p];
+        if (!decoded[p])
+        {
+            missing[references[i].sourcePath].push_back(i);
+            continue;
+        }
+
+        result[i]->UploadToGPU();
+        cache[Key(NormalizePath(references[i].sourcePath), references[i].meshIndex)] = result[i];
+        diskCacheHits++;
+        misses++;
+    }
+
+    // Sin entrada en Library (borrada o de otra versión): reimportar el modelo una vez
+    for (const auto& entry : missing)
+    {
+        Assimp::Importer importer;
+        importer.SetIOHandler(new VirtualIOSystem());
+        const aiScene* scene = importer.ReadFile(entry.first,
+            aiProcess_Triangulate |
+            aiProcess_FlipUVs |
+            aiProcess_GenNormals |
+            aiProcess_JoinIdenticalVertices);
+
+        std::vector<std::shared_ptr<MeshResource>> preloaded = Preload(entry.first, scene);
+        for (size_t i : entry.second)
+        {
+            auto it = cache.find(Key(NormalizePath(entry.first), references[i].meshIndex));
+            result[i] = it != cache.end() ? it->second.lock() : nullptr;
+            if (!result[i])
+                LOG_WARN(MESH, "Missing mesh {} #{}", entry.first, references[i].meshIndex);
+        }
+    }
+    return result;
+}
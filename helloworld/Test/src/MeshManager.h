@@ -0,0 +1,62 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+class MeshResource;
+struct aiMesh;
+struct aiScene;
+
+// Caché de mallas importadas, indexada por (archivo, índice de aiMesh).
+// Guarda weak_ptr: el recurso se libera cuando deja de usarlo la última ComponentMesh.
+class MeshManager
+{
+public:
+    // Devuelve la malla ya cargada o la importa desde Assimp si no estaba en caché
+    static std::shared_ptr<MeshResource> Load(const std::string& sourcePath, unsigned int meshIndex, const aiMesh* mesh);
+
+    // Prepara en paralelo (JobSystem) las mallas de la escena que aún no están
+    // cargadas: cada una sale de MeshCache o se importa y se guarda en ella.
+    // Las subidas a GPU se hacen después en el hilo principal. El llamador debe
+    // mantener vivos los recursos devueltos hasta que los recojan los Load.
+    static std::vector<std::shared_ptr<MeshResource>> Preload(const std::string& sourcePath, const aiScene* scene);
+
+    // Malla guardada en una escena: se lee de MeshCache por su hash sin abrir
+    // el modelo; solo si falta la entrada se reimporta el archivo de origen
+    struct Reference
+    {
+        std::string sourcePath;
+        unsigned int meshIndex = 0;
+        uint64_t cacheHash = 0;
+    };
+    static std::vector<std::shared_ptr<MeshResource>> LoadReferences(const std::vector<Reference>& references);
+
+    // Elimina las entradas cuyo recurso ya se liberó
+    static void PurgeExpired();
+
+    static size_t GetLoadedCount();
+    static unsigned int GetHits() { return hits; }
+    static unsigned int GetMisses() { return misses; }
+    static unsigned int GetDiskCacheHits() { return diskCacheHits; }
+    static unsigned int GetDiskCacheMisses() { return diskCacheMisses; }
+    static double GetLastPreloadMs() { return lastPreloadMs; }
+
+private:
+    using Key = std::pair<std::string, unsigned int>;
+
+    static std::string NormalizePath(const std::string& path);
+
+    // Parte de CPU de una carga (sin GL, apta para workers)
+    static void PrepareCPUData(MeshResource& resource, const aiMesh* mesh);
+
+    static std::map<Key, std::weak_ptr<MeshResource>> cache;
+    static unsigned int hits;
+    static unsigned int misses;
+    static std::atomic<unsigned int> diskCacheHits;
+    static std::atomic<unsigned int> diskCacheMisses;
+    static double lastPreloadMs;
+};
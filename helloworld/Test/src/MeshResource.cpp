@@ -0,0 +1,687 @@
+#include "MeshResource.h"
+#include "MeshSimplifier.h"
+#include "MeshCache.h"
+#include "VirtualIOSystem.h"
+#include "RenderStats.h"
+#include "Logger.h"
+#include <glad/glad.h>
+#include <assimp/Importer.hpp>
+#include <assimp/postprocess.h>
+#include <glm/gtc/packing.hpp>
+#include <cmath>
+#include <iostream>
+
+bool MeshResource::useCompressedVertices = false;
+bool MeshResource::keepCPUVertexData = false;
+
+namespace
+{
+    // Codificación octaédrica: proyecta la esfera unidad sobre un octaedro y lo
+    // despliega en el cuadrado [-1, 1]^2
+    glm::vec2 OctEncode(glm::vec3 n)
+    {
+        float len = std::abs(n.x) + std::abs(n.y) + std::abs(n.z);
+        if (len <= 0.0f)
+            return glm::vec2(0.0f);
+
+        n /= len;
+        glm::vec2 e(n.x, n.y);
+        if (n.z < 0.0f)
+        {
+            e.x = (1.0f - std::abs(n.y)) * (n.x >= 0.0f ? 1.0f : -1.0f);
+            e.y = (1.0f - std::abs(n.x)) * (n.y >= 0.0f ? 1.0f : -1.0f);
+        }
+        return e;
+    }
+
+    int16_t PackSnorm16(float v)
+    {
+        return (int16_t)std::round(glm::clamp(v, -1.0f, 1.0f) * 32767.0f);
+    }
+
+    uint16_t PackUnorm16(float v)
+    {
+        return (uint16_t)std::round(glm::clamp(v, 0.0f, 1.0f) * 65535.0f);
+    }
+
+    // Inversa de OctEncode (la misma que OctDecode en el vertex shader)
+    glm::vec3 OctDecode(glm::vec2 e)
+    {
+        glm::vec3 n(e.x, e.y, 1.0f - std::abs(e.x) - std::abs(e.y));
+        if (n.z < 0.0f)
+        {
+            n.x = (1.0f - std::abs(e.y)) * (e.x >= 0.0f ? 1.0f : -1.0f);
+            n.y = (1.0f - std::abs(e.x)) * (e.y >= 0.0f ? 1.0f : -1.0f);
+        }
+        return glm::normalize(n);
+    }
+}
+
+MeshResource::MeshResource()
+{
+}
+
+MeshResource::~MeshResource()
+{
+    CleanupBuffers();
+    ResidencyManager::Unregister(residencyHandle);
+}
+
+void MeshResource::LoadMesh(const aiMesh* mesh)
+{
+    if (!mesh)
+    {
+        std::cerr << "[MeshResource] Invalid mesh pointer" << std::endl;
+        return;
+    }
+
+    ImportFromAssimp(mesh);
+    UploadToGPU();
+}
+
+void MeshResource::ImportFromAssimp(const aiMesh* mesh)
+{
+    if (!mesh)
+        return;
+
+    // Limpiar datos anteriores (los buffers GL se recrean en UploadToGPU)
+    vertices.clear();
+    indices.clear();
+    lodIndices.clear();
+    lods.clear();
+    indexBufferBytes = 0;
+
+    // Cargar vértices
+    for (unsigned int i = 0; i < mesh->mNumVertices; i++)
+    {
+        MeshVertex vertex{};
+
+        // Posición
+        vertex.Position.x = mesh->mVertices[i].x;
+        vertex.Position.y = mesh->mVertices[i].y;
+        vertex.Position.z = mesh->mVertices[i].z;
+
+        // Normales
+        if (mesh->HasNormals())
+        {
+            vertex.Normal.x = mesh->mNormals[i].x;
+            vertex.Normal.y = mesh->mNormals[i].y;
+            vertex.Normal.z = mesh->mNormals[i].z;
+        }
+        else
+        {
+           vertex.Normal = glm::vec3(0.0f, 1.0f, 0.0f);
+        }
+
+        // Coordenadas de textura
+        if (mesh->mTextureCoords[0])
+        {
+            vertex.TexCoords.x = mesh->mTextureCoords[0][i].x;
+            vertex.TexCoords.y = mesh->mTextureCoords[0][i].y;
+        }
+        else
+        {
+            vertex.TexCoords = glm::vec2(0.0f, 0.0f);
+        }
+
+        vertices.push_back(vertex);
+    }
+
+    // Cargar índices
+    for (unsigned int i = 0; i < mesh->mNumFaces; i++)
+    {
+        aiFace face = mesh->mFaces[i];
+        for (unsigned int j = 0; j < face.mNumIndices; j++)
+        {
+            indices.push_back(face.mIndices[j]);
+        }
+    }
+
+    numVertices = vertices.size();
+    numIndices = indices.size();
+    BuildCollisionData();
+
+    // Generar la cadena de LODs antes de subir el EBO
+    GenerateLODs();
+}
+
+void MeshResource::UploadToGPU()
+{
+    // Configurar buffers de OpenGL
+    CleanupBuffers();
+    SetupMesh();
+    ReleaseCPUData();
+
+    LOG_DEBUG(MESH, "Loaded mesh: {} vertices, {} indices, {} LODs", numVertices, numIndices, lods.size());
+}
+
+void MeshResource::GenerateLODs()
+{
+    lods.clear();
+    lodIndices.clear();
+
+    MeshLOD base;
+    base.indexOffset = 0;
+    base.indexCount = (unsigned int)indices.size();
+    base.switchCoverage = FLT_MAX;
+    lods.push_back(base);
+
+    if (indices.size() / 3 < LOD_MIN_TRIANGLES)
+        return;
+
+    // Cada LOD tiene la mitad de triángulos que el anterior y se activa cuando
+    // el objeto ocupa menos de la fracción indicada de la media altura de pantalla
+    static const float lodRatios[MAX_LODS - 1] = { 0.5f, 0.25f, 0.125f };
+    static const float lodCoverage[MAX_LODS - 1] = { 0.25f, 0.12f, 0.05f };
+
+    std::vector<unsigned int> source = indices;
+    for (int level = 0; level < MAX_LODS - 1; ++level)
+    {
+        size_t target = (size_t)(indices.size() * lodRatios[level]) / 3 * 3;
+        std::vector<unsigned int> simplified = MeshSimplifier::Simplify(collisionPositions, source, target);
+
+        // Si el simplificador apenas avanza (bordes bloqueados), no merece otro nivel
+        if (simplified.empty() || simplified.size() > source.size() * 9 / 10)
+            break;
+
+        MeshLOD lod;
+        lod.indexOffset = (unsigned int)(indices.size() + lodIndices.size());
+        lod.indexCount = (unsigned int)simplified.size();
+        lod.switchCoverage = lodCoverage[level];
+        lods.push_back(lod);
+
+        lodIndices.insert(lodIndices.end(), simplified.begin(), simplified.end());
+        source.swap(simplified);
+    }
+}
+
+GLenum MeshResource::GetIndexType() const
+{
+    if (lods.empty() || lods[0].ranges.empty())
+        return GL_UNSIGNED_INT;
+
+    // Con clusters puede haber un resto de 32 bits; se informa del tipo dominante
+    return lods[0].ranges.front().type;
+}
+
+void MeshResource::BuildCollisionData()
+{
+    collisionPositions.clear();
+    collisionPositions.reserve(vertices.size());
+    for (const MeshVertex& v : vertices)
+        collisionPositions.push_back(v.Position);
+
+    aabbDirty = true;
+}
+
+void MeshResource::ReleaseCPUData()
+{
+    if (keepCPUVertexData)
+        return;
+
+    // Los atributos completos y los índices de los LODs ya están en la GPU;
+    // para raycast basta con collisionPositions + indices
+    std::vector<MeshVertex>().swap(vertices);
+    std::vector<unsigned int>().swap(lodIndices);
+}
+
+size_t MeshResource::GetCPUMemoryBytes() const
+{
+    return vertices.capacity() * sizeof(MeshVertex)
+        + indices.capacity() * sizeof(unsigned int)
+        + lodIndices.capacity() * sizeof(unsigned int)
+        + collisionPositions.capacity() * sizeof(glm::vec3)
+        + debugNormals.capacity() * sizeof(glm::vec3);
+}
+
+size_t MeshResource::GetGPUMemoryBytes() const
+{
+    if (VBO == 0)
+        return 0;
+    return (size_t)numVertices * GetVertexStride() + indexBufferBytes;
+}
+
+unsigned int MeshResource::GetLODTriangleCount(int lod) const
+{
+    if (lod < 0 || lod >= (int)lods.size())
+        return numIndices / 3;
+    return lods[lod].indexCount / 3;
+}
+
+void MeshResource::SetupMesh()
+{
+    // Generar buffers
+    glGenVertexArrays(1, &VAO);
+    glGenBuffers(1, &VBO);
+    glGenBuffers(1, &EBO);
+
+    glBindVertexArray(VAO);
+
+    // VBO - Vertex Buffer
+    glBindBuffer(GL_ARRAY_BUFFER, VBO);
+    // Al restaurar tras una expulsión se conserva el formato con el que se cargó
+    packedVertices = (evicted ? packedVertices : useCompressedVertices) && !vertices.empty();
+    if (packedVertices)
+        SetupPackedVertices();
+    else
+    {
+        glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(MeshVertex), &vertices[0], GL_STATIC_DRAW);
+        RenderStats::CountBufferUpload(vertices.size() * sizeof(MeshVertex));
+    }
+
+    // Sin LODs generados, el único nivel es la malla completa
+    if (lods.empty())
+    {
+        MeshLOD base;
+        base.indexCount = (unsigned int)indices.size();
+        base.switchCoverage = FLT_MAX;
+        lods.push_back(base);
+    }
+
+    // EBO - Element Buffer (índices): malla original seguida de los LODs, cada
+    // nivel codificado con el tipo de índice más pequeño que admite
+    std::vector<uint8_t> indexData;
+    for (MeshLOD& lod : lods)
+    {
+        const unsigned int* source = lod.indexOffset < indices.size()
+            ? indices.data() + lod.indexOffset
+            : lodIndices.data() + (lod.indexOffset - indices.size());
+        lod.ranges = IndexBuffer::Build(source, lod.indexCount, indexData);
+    }
+    indexBufferBytes = indexData.size();
+
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, indexData.size(), indexData.data(), GL_STATIC_DRAW);
+    RenderStats::CountBufferUpload(indexData.size());
+
+    SetupVertexAttributes();
+
+    glBindVertexArray(0);
+
+    instanceBuffer = 0;
+
+    evicted = false;
+    restoreFailed = false;
+    RegisterResidency();
+}
+
+void MeshResource::SetupVertexAttributes()
+{
+    if (packedVertices)
+    {
+        // Atributo 0: Posición cuantizada (unorm16, se reconstruye con posOffset/posScale)
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(0, 3, GL_UNSIGNED_SHORT, GL_TRUE, sizeof(PackedMeshVertex), (void*)offsetof(PackedMeshVertex, Position));
+
+        // Atributo 1: Normal en octaedro (snorm16)
+        glEnableVertexAttribArray(1);
+        glVertexAttribPointer(1, 2, GL_SHORT, GL_TRUE, sizeof(PackedMeshVertex), (void*)offsetof(PackedMeshVertex, Normal));
+
+        // Atributo 2: Coordenadas de textura (half float)
+        glEnableVertexAttribArray(2);
+        glVertexAttribPointer(2, 2, GL_HALF_FLOAT, GL_FALSE, sizeof(PackedMeshVertex), (void*)offsetof(PackedMeshVertex, TexCoords));
+    }
+    else
+    {
+        // Atributo 0: Posición
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(MeshVertex), (void*)0);
+
+        // Atributo 1: Normales
+        glEnableVertexAttribArray(1);
+        glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(MeshVertex), (void*)offsetof(MeshVertex, Normal));
+
+        // Atributo 2: Coordenadas de textura
+        glEnableVertexAttribArray(2);
+        glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(MeshVertex), (void*)offsetof(MeshVertex, TexCoords));
+    }
+}
+
+void MeshResource::SetupPackedVertices()
+{
+    // Las posiciones se guardan relativas al AABB local; un eje plano usa escala 1
+    // para no dividir por cero (todas sus coordenadas cuantizan a 0)
+    AABB bounds = CalculateLocalAABB();
+    quantizationOffset = bounds.min;
+    quantizationScale = bounds.GetSize();
+    for (int axis = 0; axis < 3; ++axis)
+    {
+        if (quantizationScale[axis] <= 0.0f)
+            quantizationScale[axis] = 1.0f;
+    }
+
+    std::vector<PackedMeshVertex> packed(vertices.size());
+    for (size_t i = 0; i < vertices.size(); ++i)
+    {
+        const MeshVertex& src = vertices[i];
+        PackedMeshVertex& dst = packed[i];
+
+        glm::vec3 rel = (src.Position - quantizationOffset) / quantizationScale;
+        dst.Position[0] = PackUnorm16(rel.x);
+        dst.Position[1] = PackUnorm16(rel.y);
+        dst.Position[2] = PackUnorm16(rel.z);
+        dst.Position[3] = 0;
+
+        glm::vec2 n = OctEncode(src.Normal);
+        dst.Normal[0] = PackSnorm16(n.x);
+        dst.Normal[1] = PackSnorm16(n.y);
+
+        dst.TexCoords[0] = glm::packHalf1x16(src.TexCoords.x);
+        dst.TexCoords[1] = glm::packHalf1x16(src.TexCoords.y);
+    }
+
+    glBufferData(GL_ARRAY_BUFFER, packed.size() * sizeof(PackedMeshVertex), packed.data(), GL_STATIC_DRAW);
+    RenderStats::CountBufferUpload(packed.size() * sizeof(PackedMeshVertex));
+}
+
+void MeshResource::ApplyVertexFormatUniforms(unsigned int programID) const
+{
+    glm::vec3 offset = packedVertices ? quantizationOffset : glm::vec3(0.0f);
+    glm::vec3 scale = packedVertices ? quantizationScale : glm::vec3(1.0f);
+
+    glUniform3fv(glGetUniformLocation(programID, "posOffset"), 1, &offset[0]);
+    glUniform3fv(glGetUniformLocation(programID, "posScale"), 1, &scale[0]);
+    glUniform1i(glGetUniformLocation(programID, "octNormals"), packedVertices ? 1 : 0);
+    RenderStats::CountUniforms(3);
+}
+
+void MeshResource::RegisterResidency()
+{
+    if (residencyHandle != 0)
+    {
+        ResidencyManager::Resize(residencyHandle, GetGPUMemoryBytes());
+        return;
+    }
+
+    std::string owner = sourcePath.empty()
+        ? "Procedural mesh"
+        : sourcePath + "#" + std::to_string(sourceIndex);
+    // Sin hash ni asset de origen (geometría procedural) no se podría restaurar
+    residencyHandle = ResidencyManager::Register(ResidencyManager::Category::MESH, owner, GetGPUMemoryBytes(),
+        CanRestore() ? this : nullptr);
+}
+
+bool MeshResource::EvictFromGPU()
+{
+    if (evicted || VBO == 0 || !CanRestore())
+        return false;
+
+    // Nada que guardar: el contenido se reconstruye desde disco al restaurar
+    CleanupBuffers();
+    evicted = true;
+    ResidencyManager::Resize(residencyHandle, 0);
+    return true;
+}
+
+// Vértices y LODs de la entrada de MeshCache o, si no está, del asset original.
+// Se cargan en un recurso aparte para no dejar este a medias si algo falla
+bool MeshResource::ReloadCPUData()
+{
+    MeshResource restored;
+    if (!MeshCache::Load(MeshCache::GetPath(cacheHash), restored))
+    {
+        Assimp::Importer importer;
+        importer.SetIOHandler(new VirtualIOSystem());
+        const aiScene* scene = importer.ReadFile(sourcePath,
+            aiProcess_Triangulate |
+            aiProcess_FlipUVs |
+            aiProcess_GenNormals |
+            aiProcess_JoinIdenticalVertices);
+
+        // Si el asset ha cambiado en disco ya no es la misma malla
+        const aiMesh* mesh = scene && sourceIndex < scene->mNumMeshes ? scene->mMeshes[sourceIndex] : nullptr;
+        if (!mesh || MeshCache::Hash(mesh) != cacheHash)
+            return false;
+        restored.ImportFromAssimp(mesh);
+    }
+
+    if (restored.numVertices != numVertices || restored.numIndices != numIndices)
+        return false;
+
+    vertices.swap(restored.vertices);
+    lodIndices.swap(restored.lodIndices);
+    lods.swap(restored.lods);
+    return true;
+}
+
+bool MeshResource::RestoreToGPU()
+{
+    if (vertices.empty() && !ReloadCPUData())
+    {
+        restoreFailed = true;
+        LOG_ERROR(MESH, "Could not restore evicted mesh {} #{}, it will not be drawn", sourcePath, sourceIndex);
+        return false;
+    }
+
+    SetupMesh();
+    ReleaseCPUData();
+    return true;
+}
+
+bool MeshResource::PrepareDraw()
+{
+    if (evicted && (restoreFailed || !RestoreToGPU()))
+        return false;
+
+    if (VAO == 0 || numIndices == 0 || lods.empty())
+        return false;
+
+    ResidencyManager::Touch(residencyHandle);
+    return true;
+}
+
+void MeshResource::DrawInstanced(int lod, GLuint instanceVBO, GLsizei count)
+{
+    if (count <= 0 || !PrepareDraw())
+        return;
+
+    lod = glm::clamp(lod, 0, (int)lods.size() - 1);
+    glBindVertexArray(VAO);
+    RenderStats::CountVAOBind();
+
+    // Los atributos por instancia se enlazan una vez al VAO
+    if (instanceBuffer != instanceVBO)
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
+        for (int column = 0; column < 4; ++column)
+        {
+            glEnableVertexAttribArray(4 + column);
+            glVertexAttribPointer(4 + column, 4, GL_FLOAT, GL_FALSE, sizeof(MeshInstanceData),
+                (void*)(offsetof(MeshInstanceData, Model) + sizeof(glm::vec4) * column));
+            glVertexAttribDivisor(4 + column, 1);
+        }
+        glEnableVertexAttribArray(8);
+        glVertexAttribPointer(8, 1, GL_FLOAT, GL_FALSE, sizeof(MeshInstanceData), (void*)offsetof(MeshInstanceData, TextureLayer));
+        glVertexAttribDivisor(8, 1);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        instanceBuffer = instanceVBO;
+    }
+
+    IndexBuffer::DrawInstanced(lods[lod].ranges, count);
+    glBindVertexArray(0);
+}
+
+void MeshResource::Draw(int lod)
+{
+    if (!PrepareDraw())
+        return;
+
+    lod = glm::clamp(lod, 0, (int)lods.size() - 1);
+
+    glBindVertexArray(VAO);
+    RenderStats::CountVAOBind();
+    IndexBuffer::Draw(lods[lod].ranges);
+    glBindVertexArray(0);
+}
+
+// Las posiciones siguen en collisionPositions; las normales solo están en el VBO.
+// Lectura síncrona, pero se hace una sola vez por malla y solo en modo debug
+bool MeshResource::ReadBackNormals()
+{
+    if (VBO == 0 || numVertices == 0 || collisionPositions.size() != numVertices)
+        return false;
+
+    std::vector<char> data((size_t)numVertices * GetVertexStride());
+    glBindBuffer(GL_ARRAY_BUFFER, VBO);
+    glGetBufferSubData(GL_ARRAY_BUFFER, 0, data.size(), data.data());
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    debugNormals.resize(numVertices);
+    for (size_t i = 0; i < numVertices; ++i)
+    {
+        if (packedVertices)
+        {
+            const PackedMeshVertex& v = reinterpret_cast<const PackedMeshVertex*>(data.data())[i];
+            debugNormals[i] = OctDecode(glm::vec2(v.Normal[0], v.Normal[1]) / 32767.0f);
+        }
+        else
+        {
+            debugNormals[i] = reinterpret_cast<const MeshVertex*>(data.data())[i].Normal;
+        }
+    }
+    return true;
+}
+
+// NUEVO: Dibujar normales como líneas. Crea un VBO temporal con pares (pos, pos+normal*length)
+void MeshResource::DrawNormals(const glm::mat4& /*modelMatrix*/, float length)
+{
+    // Importadas con los atributos ya liberados: posiciones de colisión + normales del VBO
+    const bool fromVertices = !vertices.empty();
+    if (!fromVertices && debugNormals.empty() && !ReadBackNormals())
+        return;
+
+    const size_t count = fromVertices ? vertices.size() : debugNormals.size();
+    std::vector<float> lines;
+    lines.reserve(count * 6);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        glm::vec3 p = fromVertices ? vertices[i].Position : collisionPositions[i];
+        glm::vec3 n = fromVertices ? vertices[i].Normal : debugNormals[i];
+        glm::vec3 p2 = p + n * length;
+
+        // P1
+        lines.push_back(p.x);
+        lines.push_back(p.y);
+        lines.push_back(p.z);
+        // P2
+        lines.push_back(p2.x);
+        lines.push_back(p2.y);
+        lines.push_back(p2.z);
+    }
+
+    // Crear buffers temporales
+    GLuint tmpVAO = 0, tmpVBO = 0;
+    glGenVertexArrays(1, &tmpVAO);
+    glGenBuffers(1, &tmpVBO);
+
+    glBindVertexArray(tmpVAO);
+    glBindBuffer(GL_ARRAY_BUFFER, tmpVBO);
+    glBufferData(GL_ARRAY_BUFFER, lines.size() * sizeof(float), lines.data(), GL_STATIC_DRAW);
+
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
+
+    // Usar estado fijo: color blanco para las normales y dibujar líneas
+    glDisable(GL_TEXTURE_2D);
+    glLineWidth(1.0f);
+    // Asumimos que se usa un shader ya activo que respeta la matriz model/view/projection
+    glBindVertexArray(tmpVAO);
+    glDrawArrays(GL_LINES, 0, (GLsizei)(lines.size() / 3));
+    glBindVertexArray(0);
+
+    // Limpiar
+    glDeleteBuffers(1, &tmpVBO);
+    glDeleteVertexArrays(1, &tmpVAO);
+}
+
+void MeshResource::CleanupBuffers()
+{
+    if (EBO != 0)
+    {
+        glDeleteBuffers(1, &EBO);
+        EBO = 0;
+    }
+
+    if (VBO != 0)
+    {
+        glDeleteBuffers(1, &VBO);
+        VBO = 0;
+    }
+
+    if (VAO != 0)
+    {
+        glDeleteVertexArrays(1, &VAO);
+        VAO = 0;
+    }
+}
+
+
+void MeshResource::LoadFromGeometry(MeshGeometry* geom)
+{
+    if (!geom)
+    {
+        std::cerr << "[MeshResource] Invalid geometry pointer" << std::endl;
+        return;
+    }
+
+    // Limpiar datos anteriores
+    CleanupBuffers();
+    vertices.clear();
+    indices.clear();
+    lodIndices.clear();
+    lods.clear();
+    indexBufferBytes = 0;
+
+    // Convertir de MeshGeometry a MeshVertex
+    for (const auto& v : geom->vertices)
+    {
+        MeshVertex vertex{};
+        vertex.Position = v.Position;
+        vertex.Normal = v.Normal;
+        vertex.TexCoords = v.TexCoords;
+        vertex.Tangent = glm::vec3(0.0f);    // O calcular si es necesario
+        vertex.Bitangent = glm::vec3(0.0f);  // O calcular si es necesario
+
+        vertices.push_back(vertex);
+    }
+
+    // Copiar índices
+    indices = geom->indices;
+
+    numVertices = vertices.size();
+    numIndices = indices.size();
+    BuildCollisionData();
+
+    // Configurar buffers de OpenGL
+    SetupMesh();
+    ReleaseCPUData();
+
+    LOG_DEBUG(MESH, "Loaded procedural geometry: {} vertices, {} indices", numVertices, numIndices);
+
+    aabbDirty = true;
+
+}
+
+AABB MeshResource::CalculateLocalAABB() const
+{
+    AABB aabb;
+
+    // Las posiciones de colisión siguen en RAM aunque se liberen los vértices
+    for (const glm::vec3& position : collisionPositions)
+    {
+        aabb.Encapsulate(position);
+    }
+
+    return aabb;
+}
+
+AABB MeshResource::GetLocalAABB()
+{
+    if (aabbDirty)
+    {
+        localAABB = CalculateLocalAABB();
+        aabbDirty = false;
+    }
+    return localAABB;
+}
@@ -0,0 +1,192 @@
+#pragma once
+#include "GeometryGenerator.h"
+#include "AABB.h"
+#include "IndexBuffer.h"
+#include "ResidencyManager.h"
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <assimp/scene.h>
+
+// Estructura de vértice para ComponentMesh
+struct MeshVertex {
+    glm::vec3 Position;
+    glm::vec3 Normal;
+    glm::vec2 TexCoords;
+    glm::vec3 Tangent;
+    glm::vec3 Bitangent;
+};
+
+// Formato compacto opcional para la GPU (16 bytes frente a 56):
+// posición cuantizada a 16 bits dentro del AABB local, normal codificada en
+// octaedro (snorm 16 bits) y UV en half float. Sin tangente: no se importa
+// y ningún shader la lee
+struct PackedMeshVertex {
+    uint16_t Position[4];   // xyz normalizados en el AABB, w de relleno
+    int16_t Normal[2];
+    uint16_t TexCoords[2];
+};
+
+// Atributos por instancia del dibujado agrupado (locations 4-8):
+// matriz de modelo y capa del array de texturas
+struct MeshInstanceData {
+    glm::mat4 Model;
+    float TextureLayer;
+};
+
+// Nivel de detalle: rango dentro del EBO compartido (todos los LODs usan el mismo VBO)
+struct MeshLOD {
+    unsigned int indexOffset = 0;   // posición en indices + lodIndices, no en el EBO
+    unsigned int indexCount = 0;
+    float switchCoverage = 0.0f;    // cobertura de pantalla por debajo de la cual se activa
+    std::vector<IndexRange> ranges; // tramos del EBO (tipo de índice y vértice base)
+};
+
+// Datos de una malla en GPU (VAO/VBO/EBO, LODs y datos de colisión).
+// Varias ComponentMesh pueden compartir el mismo recurso a través de MeshManager;
+// lo que depende de cada instancia (LOD actual) vive en el componente.
+// Sus buffers cuentan para el budget de ResidencyManager: si se expulsan, al
+// volver a dibujarse se reconstruyen desde la entrada de MeshCache o reimportando
+// el asset original, localizados por el hash de contenido.
+class MeshResource : public ResidencyManager::Evictable
+{
+    friend class MeshCache;
+
+private:
+    // Representación estructurada (para OpenGL y uso interno).
+    // Se libera tras subirla a la GPU salvo que keepCPUVertexData esté activo.
+    std::vector<MeshVertex> vertices;
+    std::vector<unsigned int> indices;
+
+    // Copia compacta que se conserva para raycast y AABB (12 bytes por vértice)
+    std::vector<glm::vec3> collisionPositions;
+
+    // Normales leídas del VBO la primera vez que se piden en DrawNormals
+    // cuando ya no están los atributos completos (solo debug)
+    std::vector<glm::vec3> debugNormals;
+
+    GLuint VAO = 0;
+    GLuint VBO = 0;
+    GLuint EBO = 0;
+    GLuint numIndices = 0, numVertices = 0;
+
+    // Formato de vértice subido a la GPU
+    bool packedVertices = false;
+    glm::vec3 quantizationOffset = glm::vec3(0.0f);
+    glm::vec3 quantizationScale = glm::vec3(1.0f);
+
+    // LODs generados al importar (lods[0] es la malla original)
+    std::vector<unsigned int> lodIndices;
+    std::vector<MeshLOD> lods;
+
+    size_t indexBufferBytes = 0;
+
+    AABB localAABB;
+    bool aabbDirty = true;
+
+    // Origen en disco (vacío para geometría procedural)
+    std::string sourcePath;
+    unsigned int sourceIndex = 0;
+    uint64_t cacheHash = 0;     // entrada de MeshCache (0 si no se ha calculado)
+
+    // Residencia en VRAM
+    ResidencyManager::Handle residencyHandle = 0;
+    bool evicted = false;
+    bool restoreFailed = false; // no se reintenta en cada draw
+
+    // Buffer de instancias enlazado al VAO (se pierde si se recrea el VAO)
+    GLuint instanceBuffer = 0;
+
+    void SetupMesh();
+    void SetupVertexAttributes();
+    void RegisterResidency();
+    bool CanRestore() const { return cacheHash != 0 && !sourcePath.empty(); }
+    bool ReloadCPUData();
+    bool RestoreToGPU();
+    bool PrepareDraw();
+    void SetupPackedVertices();
+    void CleanupBuffers();
+    void BuildCollisionData();
+    void ReleaseCPUData();
+    bool ReadBackNormals();
+    void GenerateLODs();
+
+public:
+    MeshResource();
+    ~MeshResource() override;
+
+    MeshResource(const MeshResource&) = delete;
+    MeshResource& operator=(const MeshResource&) = delete;
+
+    // Cargar mesh desde Assimp (para modelos FBX/OBJ)
+    void LoadMesh(const aiMesh* mesh);
+
+    // LoadMesh en dos fases: la primera solo toca memoria de CPU (vértices,
+    // colisión y LODs) y puede ejecutarse en un worker; la segunda sube los
+    // buffers y debe llamarse desde el hilo con el contexto GL
+    void ImportFromAssimp(const aiMesh* mesh);
+    void UploadToGPU();
+
+    // Cargar desde geometría procedural
+    void LoadFromGeometry(MeshGeometry* geom);
+
+    // Renderizar el nivel de detalle indicado
+    void Draw(int lod);
+
+    // Varias copias con un solo draw; instanceVBO ya contiene count MeshInstanceData
+    void DrawInstanced(int lod, GLuint instanceVBO, GLsizei count);
+
+    // Formato compacto: afecta a las mallas que se carguen a partir de ahora
+    static bool useCompressedVertices;
+
+    // Residencia: conservar los atributos completos en RAM (p. ej. para editar la malla)
+    static bool keepCPUVertexData;
+
+    // Sube los uniforms de decuantización que espera el shader principal
+    void ApplyVertexFormatUniforms(unsigned int programID) const;
+    bool HasPackedVertices() const { return packedVertices; }
+    size_t GetVertexStride() const { return packedVertices ? sizeof(PackedMeshVertex) : sizeof(MeshVertex); }
+
+    // Debug: dibujar normales en pantalla. Sin los atributos en RAM se leen una
+    // vez del VBO; si la malla está expulsada de la VRAM no dibuja nada
+    void DrawNormals(const glm::mat4& modelMatrix, float length = 0.1f);
+
+    const std::vector<glm::vec3>& GetCollisionPositions() const { return collisionPositions; }
+    const std::vector<unsigned int>& GetIndices() const { return indices; }
+
+    size_t GetVertexCount() const { return numVertices; }
+    size_t GetIndexCount() const { return numIndices; }
+
+    // Memoria ocupada por la malla
+    size_t GetCPUMemoryBytes() const;
+    size_t GetGPUMemoryBytes() const;
+
+    // ResidencyManager::Evictable
+    bool EvictFromGPU() override;
+    bool IsEvicted() const { return evicted; }
+
+    // Sistema de LOD
+    static constexpr int MAX_LODS = 4;
+    static constexpr unsigned int LOD_MIN_TRIANGLES = 512;
+
+    int GetLODCount() const { return (int)lods.size(); }
+    const MeshLOD& GetLOD(int lod) const { return lods[lod]; }
+    unsigned int GetLODTriangleCount(int lod) const;
+
+    // Formato de índices de la malla completa (LOD 0)
+    GLenum GetIndexType() const;
+    size_t GetIndexRangeCount() const { return lods.empty() ? 0 : lods[0].ranges.size(); }
+    size_t GetIndexBufferBytes() const { return indexBufferBytes; }
+
+    // Sistema de AABB
+    AABB CalculateLocalAABB() const;
+    AABB GetLocalAABB();
+
+    void SetSource(const std::string& path, unsigned int index) { sourcePath = path; sourceIndex = index; }
+    const std::string& GetSourcePath() const { return sourcePath; }
+    unsigned int GetSourceIndex() const { return sourceIndex; }
+    void SetCacheHash(uint64_t hash) { cacheHash = hash; }
+    uint64_t GetCacheHash() const { return cacheHash; }
+};
@@ -0,0 +1,300 @@
+#include "MeshSimplifier.h"
+#include <queue>
+#include <unordered_map>
+#include <algorithm>
+#include <cstdint>
+
+namespace
+{
+    // Matriz 4x4 simétrica guardada como 10 coeficientes
+    struct Quadric
+    {
+        double a00 = 0, a01 = 0, a02 = 0, a03 = 0;
+        double a11 = 0, a12 = 0, a13 = 0;
+        double a22 = 0, a23 = 0;
+        double a33 = 0;
+
+        void AddPlane(const glm::dvec3& n, double d, double weight)
+        {
+            a00 += weight * n.x * n.x; a01 += weight * n.x * n.y; a02 += weight * n.x * n.z; a03 += weight * n.x * d;
+            a11 += weight * n.y * n.y; a12 += weight * n.y * n.z; a13 += weight * n.y * d;
+            a22 += weight * n.z * n.z; a23 += weight * n.z * d;
+            a33 += weight * d * d;
+        }
+
+        void Add(const Quadric& q)
+        {
+            a00 += q.a00; a01 += q.a01; a02 += q.a02; a03 += q.a03;
+            a11 += q.a11; a12 += q.a12; a13 += q.a13;
+            a22 += q.a22; a23 += q.a23;
+            a33 += q.a33;
+        }
+
+        // v^T * Q * v con v = (x, y, z, 1)
+        double Evaluate(const glm::vec3& p) const
+        {
+            double x = p.x, y = p.y, z = p.z;
+            return a00 * x * x + 2.0 * a01 * x * y + 2.0 * a02 * x * z + 2.0 * a03 * x
+                + a11 * y * y + 2.0 * a12 * y * z + 2.0 * a13 * y
+                + a22 * z * z + 2.0 * a23 * z
+                + a33;
+        }
+    };
+
+    struct Collapse
+    {
+        float cost;
+        unsigned int from;
+        unsigned int to;
+        unsigned int fromStamp;
+        unsigned int toStamp;
+
+        bool operator>(const Collapse& other) const { return cost > other.cost; }
+    };
+
+    unsigned int Find(std::vector<unsigned int>& remap, unsigned int v)
+    {
+        unsigned int root = v;
+        while (remap[root] != root)
+            root = remap[root];
+
+        // Compresión de camino
+        while (remap[v] != root)
+        {
+            unsigned int next = remap[v];
+            remap[v] = root;
+            v = next;
+        }
+        return root;
+    }
+}
+
+std::vector<unsigned int> MeshSimplifier::Simplify(
+    const std::vector<glm::vec3>& positions,
+    const std::vector<unsigned int>& indices,
+    size_t targetIndexCount,
+    float* outError)
+{
+    const size_t vertexCount = positions.size();
+    const size_t triangleCount = indices.size() / 3;
+
+    if (outError)
+        *outError = 0.0f;
+
+    if (triangleCount == 0 || targetIndexCount >= indices.size())
+        return indices;
+
+    // 1. Cuádricas por vértice (planos de los triángulos adyacentes, ponderados por área)
+    std::vector<Quadric> quadrics(vertexCount);
+    std::vector<std::vector<unsigned int>> vertexTriangles(vertexCount);
+
+    for (size_t t = 0; t < triangleCount; ++t)
+    {
+        unsigned int i0 = indices[t * 3 + 0];
+        unsigned int i1 = indices[t * 3 + 1];
+        unsigned int i2 = indices[t * 3 + 2];
+
+        glm::dvec3 p0 = positions[i0];
+        glm::dvec3 p1 = positions[i1];
+        glm::dvec3 p2 = positions[i2];
+
+        glm::dvec3 normal = glm::cross(p1 - p0, p2 - p0);
+        double area = glm::length(normal);
+        if (area > 0.0)
+        {
+            normal /= area;
+            double d = -glm::dot(normal, p0);
+            quadrics[i0].AddPlane(normal, d, area);
+            quadrics[i1].AddPlane(normal, d, area);
+            quadrics[i2].AddPlane(normal, d, area);
+        }
+
+        vertexTriangles[i0].push_back((unsigned int)t);
+        vertexTriangles[i1].push_back((unsigned int)t);
+        vertexTriangles[i2].push_back((unsigned int)t);
+    }
+
+    // 2. Bordes: aristas usadas por un solo triángulo. Sus vértices no se mueven.
+    std::unordered_map<uint64_t, int> edgeUse;
+    edgeUse.reserve(indices.size());
+    auto edgeKey = [](unsigned int a, unsigned int b) -> uint64_t
+    {
+        if (a > b) std::swap(a, b);
+        return (uint64_t(a) << 32) | b;
+    };
+
+    for (size_t t = 0; t < triangleCount; ++t)
+    {
+        for (int e = 0; e < 3; ++e)
+        {
+            unsigned int a = indices[t * 3 + e];
+            unsigned int b = indices[t * 3 + (e + 1) % 3];
+            edgeUse[edgeKey(a, b)]++;
+        }
+    }
+
+    std::vector<bool> locked(vertexCount, false);
+    for (size_t t = 0; t < triangleCount; ++t)
+    {
+        for (int e = 0; e < 3; ++e)
+        {
+            unsigned int a = indices[t * 3 + e];
+            unsigned int b = indices[t * 3 + (e + 1) % 3];
+            if (edgeUse[edgeKey(a, b)] == 1)
+            {
+                locked[a] = true;
+                locked[b] = true;
+            }
+        }
+    }
+
+    // 3. Cola de colapsos candidatos (con invalidación perezosa por sellos)
+    std::vector<unsigned int> remap(vertexCount);
+    for (size_t v = 0; v < vertexCount; ++v)
+        remap[v] = (unsigned int)v;
+
+    std::vector<unsigned int> stamp(vertexCount, 0);
+    std::vector<bool> deadTriangle(triangleCount, false);
+    size_t liveTriangles = triangleCount;
+
+    std::priority_queue<Collapse, std::vector<Collapse>, std::greater<Collapse>> heap;
+
+    auto pushCandidate = [&](unsigned int from, unsigned int to)
+    {
+        if (from == to || locked[from])
+            return;
+
+        Quadric q = quadrics[from];
+        q.Add(quadrics[to]);
+        float cost = (float)std::max(0.0, q.Evaluate(positions[to]));
+        heap.push({ cost, from, to, stamp[from], stamp[to] });
+    };
+
+    for (size_t t = 0; t < triangleCount; ++t)
+    {
+        for (int e = 0; e < 3; ++e)
+        {
+            unsigned int a = indices[t * 3 + e];
+            unsigned int b = indices[t * 3 + (e + 1) % 3];
+            pushCandidate(a, b);
+            pushCandidate(b, a);
+        }
+    }
+
+    auto corner = [&](size_t t, int c) { return Find(remap, indices[t * 3 + c]); };
+
+    float maxError = 0.0f;
+    const size_t targetTriangles = targetIndexCount / 3;
+
+    while (liveTriangles > targetTriangles && !heap.empty())
+    {
+        Collapse c = heap.top();
+        heap.pop();
+
+        // El origen ya se colapsó en otro vértice
+        if (remap[c.from] != c.from)
+            continue;
+
+        unsigned int to = Find(remap, c.to);
+        if (to == c.from)
+            continue;
+
+        // Las cuádricas cambiaron desde que se calculó el coste: recalcular
+        if (to != c.to || stamp[c.from] != c.fromStamp || stamp[to] != c.toStamp)
+        {
+            pushCandidate(c.from, to);
+            continue;
+        }
+
+        // Rechazar colapsos que den la vuelta a algún triángulo
+        const glm::vec3& target = positions[to];
+        bool flips = false;
+        for (unsigned int t : vertexTriangles[c.from])
+        {
+            if (deadTriangle[t])
+                continue;
+
+            unsigned int v[3] = { corner(t, 0), corner(t, 1), corner(t, 2) };
+            if (v[0] == to || v[1] == to || v[2] == to)
+                continue; // Este triángulo desaparece
+
+            glm::vec3 p[3] = { positions[v[0]], positions[v[1]], positions[v[2]] };
+            glm::vec3 before = glm::cross(p[1] - p[0], p[2] - p[0]);
+
+            for (int k = 0; k < 3; ++k)
+                if (v[k] == c.from) p[k] = target;
+
+            glm::vec3 after = glm::cross(p[1] - p[0], p[2] - p[0]);
+            if (glm::dot(before, after) <= 0.0f)
+            {
+                flips = true;
+                break;
+            }
+        }
+
+        if (flips)
+            continue;
+
+        // Aplicar colapso
+        remap[c.from] = to;
+        quadrics[to].Add(quadrics[c.from]);
+        stamp[to]++;
+        maxError = std::max(maxError, c.cost);
+
+        for (unsigned int t : vertexTriangles[c.from])
+        {
+            if (deadTriangle[t])
+                continue;
+
+            unsigned int v0 = corner(t, 0), v1 = corner(t, 1), v2 = corner(t, 2);
+            if (v0 == v1 || v1 == v2 || v0 == v2)
+            {
+                deadTriangle[t] = true;
+                liveTriangles--;
+            }
+            else
+            {
+                vertexTriangles[to].push_back(t);
+            }
+        }
+        vertexTriangles[c.from].clear();
+
+        // Nuevas aristas alrededor del vértice superviviente
+        for (unsigned int t : vertexTriangles[to])
+        {
+            if (deadTriangle[t])
+                continue;
+
+            for (int k = 0; k < 3; ++k)
+            {
+                unsigned int w = corner(t, k);
+                if (w == to)
+                    continue;
+                pushCandidate(to, w);
+                pushCandidate(w, to);
+            }
+        }
+    }
+
+    // 4. Reconstruir lista de índices con los triángulos supervivientes
+    std::vector<unsigned int> result;
+    result.reserve(liveTriangles * 3);
+    for (size_t t = 0; t < triangleCount; ++t)
+    {
+        if (deadTriangle[t])
+            continue;
+
+        unsigned int v0 = corner(t, 0), v1 = corner(t, 1), v2 = corner(t, 2);
+        if (v0 == v1 || v1 == v2 || v0 == v2)
+            continue;
+
+        result.push_back(v0);
+        result.push_back(v1);
+        result.push_back(v2);
+    }
+
+    if (outError)
+        *outError = maxError;
+
+    return result;
+}
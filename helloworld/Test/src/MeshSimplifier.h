@@ -0,0 +1,20 @@
+#pragma once
+#include <glm/glm.hpp>
+#include <vector>
+
+// Simplificación de mallas por error cuadrático (Garland-Heckbert).
+// Cada colapso mueve un vértice sobre uno de sus vecinos (half-edge collapse),
+// así que no se crean vértices nuevos: todos los LODs de una malla comparten
+// el mismo vertex buffer y solo cambia la lista de índices.
+class MeshSimplifier
+{
+public:
+    // Reduce la malla hasta ~targetIndexCount índices (o hasta que no haya más
+    // colapsos válidos). Los vértices de borde quedan fijos para no abrir huecos
+    // en costuras de UV. outError recibe el error cuadrático máximo aceptado.
+    static std::vector<unsigned int> Simplify(
+        const std::vector<glm::vec3>& positions,
+        const std::vector<unsigned int>& indices,
+        size_t targetIndexCount,
+        float* outError = nullptr);
+};
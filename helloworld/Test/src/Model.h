@@ -12,6 +12,8 @@
 
 #include "Mesh.h"
 #include "Shader.h"
+#include "VirtualFileSystem.h"
+#include "VirtualIOSystem.h"
 
 #include <string>
 #include <fstream>
@@ -62,6 +64,7 @@ private:
     void loadModel(string const& path)
     {
         Assimp::Importer importer;
+        importer.SetIOHandler(new VirtualIOSystem());
         const aiScene* scene = importer.ReadFile(path,
             aiProcess_Triangulate |
             aiProcess_GenSmoothNormals |
@@ -232,44 +235,23 @@ private:
 // Inline texture loading function using DevIL
 inline unsigned int TextureFromFile(const char* path, const string& directory, bool gamma)
 {
-    string filename = string(path);
-    vector<string> pathsToTry;
-
-    pathsToTry.push_back(directory + '/' + filename);
-
-    size_t lastSlash = filename.find_last_of("/\\");
-    string filenameOnly = (lastSlash != string::npos) ? filename.substr(lastSlash + 1) : filename;
-    pathsToTry.push_back(directory + '/' + filenameOnly);
-    pathsToTry.push_back(directory + "/../Textures/" + filenameOnly);
-    pathsToTry.push_back(directory + "/Textures/" + filenameOnly);
-    pathsToTry.push_back("../Assets/Textures/" + filenameOnly);
+    // One lookup in the VFS index instead of probing directories on disk
+    string loadedPath = VirtualFileSystem::Locate(path, directory);
+    if (loadedPath.empty())
+        loadedPath = directory + '/' + path;
+    VirtualFile file = VirtualFileSystem::Open(loadedPath);
 
     ILuint imgID;
     ilGenImages(1, &imgID);
     ilBindImage(imgID);
 
-    bool loaded = false;
-    string loadedPath;
-
-    // Try multiple fallback paths for texture
-    for (const auto& tryPath : pathsToTry)
-    {
-        cout << "[TEXTURE] Trying: " << tryPath << endl;
-        if (ilLoadImage(tryPath.c_str()))
-        {
-            loaded = true;
-            loadedPath = tryPath;
-            cout << "  -> Found and loaded successfully!" << endl;
-            break;
-        }
-    }
+    bool loaded = file.IsOpen() && ilLoadL(IL_TYPE_UNKNOWN, file.Data(), (ILuint)file.Size());
 
     // If texture failed to load, create a placeholder (magenta)
     if (!loaded)
     {
         ILenum error = ilGetError();
-        cout << "[ERROR] Texture could not be loaded from any location." << endl;
-        for (auto& p : pathsToTry) cout << "  - " << p << endl;
+        cout << "[ERROR] Texture could not be loaded: " << path << " (from " << directory << ")" << endl;
         cout << "  DevIL Error: " << error << " -> " << iluErrorString(error) << endl;
         ilDeleteImages(1, &imgID);
 
@@ -33,6 +33,12 @@ public:
         return true;
     }
 
+    // Called zero or more times per loop iteration with a fixed step (FrameTimer)
+    virtual bool FixedUpdate(float /*fixedDeltaTime*/)
+    {
+        return true;
+    }
+
     // Called each loop iteration
     virtual bool Update()
     {
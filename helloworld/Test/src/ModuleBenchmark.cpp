@@ -0,0 +1,501 @@
+#include "ModuleBenchmark.h"
+#include "Application.h"
+#include "GameObject.h"
+#include "ComponentMesh.h"
+#include "FileUtils.h"
+#include "VirtualFileSystem.h"
+#include "TextureManager.h"
+#include "FrameTimer.h"
+#include "GpuProfiler.h"
+#include "RenderStats.h"
+#include "MemoryTracker.h"
+#include "Profiler.h"
+#include "Logger.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <glm/gtc/constants.hpp>
+
+namespace
+{
+    // Tope de frames extra esperando a que terminen las cargas de texturas
+    const int MaxLoadFrames = 1200;
+
+    bool ParseInt(const char* text, int minValue, int& value)
+    {
+        char* end = nullptr;
+        long parsed = strtol(text, &end, 10);
+        if (end == text || *end != '\0' || parsed < minValue)
+            return false;
+        value = (int)parsed;
+        return true;
+    }
+
+    void WriteEscaped(std::ostream& out, const char* text)
+    {
+        for (const char* c = text; *c; ++c)
+        {
+            if (*c == '"' || *c == '\\')
+                out << '\\';
+            out << *c;
+        }
+    }
+
+    // "Draw calls" -> "draw_calls"
+    std::string ToKey(const char* name)
+    {
+        std::string key;
+        for (const char* c = name; *c; ++c)
+            key += *c == ' ' ? '_' : (char)tolower((unsigned char)*c);
+        return key;
+    }
+
+    void WriteDistribution(std::ostream& out, const std::vector<float>& samples)
+    {
+        char buffer[256];
+        if (samples.empty())
+        {
+            out << "{\"count\":0}";
+            return;
+        }
+
+        std::vector<float> sorted = samples;
+        std::sort(sorted.begin(), sorted.end());
+        auto percentile = [&sorted](float fraction)
+        {
+            return sorted[std::min((size_t)(fraction * sorted.size()), sorted.size() - 1)];
+        };
+
+        double sum = 0.0;
+        for (float sample : sorted)
+            sum += sample;
+        const double mean = sum / sorted.size();
+        double variance = 0.0;
+        for (float sample : sorted)
+            variance += (sample - mean) * (sample - mean);
+        variance /= sorted.size();
+
+        snprintf(buffer, sizeof(buffer),
+            "{\"count\":%zu,\"mean\":%.4f,\"stddev\":%.4f,\"min\":%.4f,\"p50\":%.4f,\"p95\":%.4f,\"p99\":%.4f,\"max\":%.4f}",
+            sorted.size(), mean, std::sqrt(variance), sorted.front(), percentile(0.50f), percentile(0.95f),
+            percentile(0.99f), sorted.back());
+        out << buffer;
+    }
+}
+
+bool ModuleBenchmark::ParseArgs(int argc, char* argv[], Options& options)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string arg = argv[i];
+        const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+        bool valid = true;
+
+        if (arg == "--benchmark")
+        {
+            options.enabled = true;
+            continue;
+        }
+        if (arg == "--help" || arg == "-h")
+            return false;
+
+        if (!value)
+        {
+            std::cerr << "[Benchmark] Missing value for " << arg << std::endl;
+            return false;
+        }
+
+        if (arg == "--scene")
+            options.scenePath = value;
+        else if (arg == "--model")
+            options.models.push_back(value);
+        else if (arg == "--frames")
+            valid = ParseInt(value, 1, options.frames);
+        else if (arg == "--warmup")
+            valid = ParseInt(value, 0, options.warmupFrames);
+        else if (arg == "--output")
+            options.outputPath = value;
+        else if (arg == "--size")
+            valid = sscanf(value, "%dx%d", &options.width, &options.height) == 2 && options.width > 0 && options.height > 0;
+        else if (arg == "--path")
+        {
+            if (strcmp(value, "orbit") == 0)
+                options.path = CameraPath::ORBIT;
+            else if (strcmp(value, "flythrough") == 0)
+                options.path = CameraPath::FLYTHROUGH;
+            else if (strcmp(value, "static") == 0)
+                options.path = CameraPath::STATIC;
+            else
+                valid = false;
+        }
+        else
+        {
+            std::cerr << "[Benchmark] Unknown argument " << arg << std::endl;
+            return false;
+        }
+
+        if (!valid)
+        {
+            std::cerr << "[Benchmark] Invalid value for " << arg << ": " << value << std::endl;
+            return false;
+        }
+        ++i;
+    }
+    return true;
+}
+
+void ModuleBenchmark::PrintUsage()
+{
+    std::cout <<
+        "Usage: Engine [--benchmark [options]]\n"
+        "  --benchmark             Run headless, measure and exit\n"
+        "  --scene <file>          Scene (.wscene) to load instead of the default one\n"
+        "  --model <file>          Model to add to the scene (repeatable)\n"
+        "  --frames <n>            Measured frames (default 600)\n"
+        "  --warmup <n>            Frames before measuring (default 60)\n"
+        "  --path <name>           Camera path: orbit, flythrough or static (default orbit)\n"
+        "  --size <w>x<h>          Framebuffer size (default 1280x720)\n"
+        "  --output <file>         JSON results (default ../Library/Benchmark/benchmark.json)\n"
+        << std::endl;
+}
+
+const char* ModuleBenchmark::GetPathName(CameraPath path)
+{
+    switch (path)
+    {
+    case CameraPath::ORBIT: return "orbit";
+    case CameraPath::FLYTHROUGH: return "flythrough";
+    case CameraPath::STATIC: return "static";
+    default: return "unknown";
+    }
+}
+
+ModuleBenchmark::ModuleBenchmark(const Options& options) : options(options)
+{
+}
+
+ModuleBenchmark::~ModuleBenchmark()
+{
+}
+
+bool ModuleBenchmark::Start()
+{
+    Application& app = Application::GetInstance();
+
+    // Se dibuja y se mide cada frame, sin esperas de ningún tipo
+    app.opengl->renderOnDemand = false;
+    FrameTimer::SetTargetFps(0);
+
+    // El reemplazo de new/delete no se puede quitar en ejecución: al menos que conste
+    if (MemoryTracker::IsEnabled())
+        LOG_WARN(ENGINE, "Benchmark: built with ENGINE_MEMORY_TRACKING, allocation times include the tracker");
+
+    if (!LoadContent() || !CreateFramebuffer())
+        return false;
+
+    app.camera->setProjection(45.0f, (float)options.width / (float)options.height, 0.1f, 1000.0f);
+    counterTotals.assign(RenderStats::COUNTER_COUNT, 0.0);
+    frameTimes.reserve(options.frames);
+
+    const char* renderer = (const char*)glGetString(GL_RENDERER);
+    LOG_INFO(ENGINE, "Benchmark: {} frames ({} warmup), path {}, {}x{} on {}", options.frames, options.warmupFrames,
+        GetPathName(options.path), options.width, options.height, renderer ? renderer : "unknown renderer");
+    return true;
+}
+
+bool ModuleBenchmark::LoadContent()
+{
+    Application& app = Application::GetInstance();
+
+    if (!options.scenePath.empty() && !app.moduleScene->LoadScene(options.scenePath.c_str()))
+    {
+        LOG_ERROR(ENGINE, "Benchmark: could not load scene {}", options.scenePath);
+        return false;
+    }
+
+    for (const std::string& model : options.models)
+    {
+        if (!VirtualFileSystem::Exists(model) && !FileUtils::Exists(model))
+        {
+            LOG_ERROR(ENGINE, "Benchmark: model not found {}", model);
+            return false;
+        }
+        app.moduleScene->LoadModel(model.c_str());
+    }
+
+    // Una escena elegida a mano no debe arrastrar la selección de la escena por defecto
+    app.moduleScene->SetSelectedGameObject(nullptr);
+    return true;
+}
+
+bool ModuleBenchmark::CreateFramebuffer()
+{
+    glGenFramebuffers(1, &framebuffer);
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+
+    glGenTextures(1, &colorTexture);
+    glBindTexture(GL_TEXTURE_2D, colorTexture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, options.width, options.height, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, colorTexture, 0);
+
+    glGenRenderbuffers(1, &depthBuffer);
+    glBindRenderbuffer(GL_RENDERBUFFER, depthBuffer);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, options.width, options.height);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, depthBuffer);
+
+    const bool complete = glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE;
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+    if (!complete)
+        LOG_ERROR(RENDER, "Benchmark: framebuffer {}x{} not complete", options.width, options.height);
+    return complete;
+}
+
+bool ModuleBenchmark::Update()
+{
+    PROFILE_FUNCTION();
+
+    // FrameTimer y RenderStats ya han cerrado el frame anterior: si se midió, se anota
+    if (measureStart >= 0 && frameIndex > measureStart)
+        RecordFrame();
+
+    if ((int)frameTimes.size() >= options.frames)
+    {
+        succeeded = WriteResults();
+        return false;
+    }
+
+    if (measureStart < 0)
+    {
+        // Calentamiento; si aún hay texturas cargándose se espera a que acaben
+        UpdateSceneBounds();
+        const bool loading = TextureManager::GetPendingCount() > 0 && frameIndex < options.warmupFrames + MaxLoadFrames;
+        if (frameIndex >= options.warmupFrames && !loading)
+        {
+            measureStart = frameIndex;
+            LOG_INFO(ENGINE, "Benchmark: measuring from frame {}", frameIndex);
+        }
+    }
+
+    PlaceCamera(measureStart < 0 ? 0.0f : (float)(frameIndex - measureStart) / (float)options.frames);
+    RenderFrame();
+
+    frameIndex++;
+    return true;
+}
+
+void ModuleBenchmark::UpdateSceneBounds()
+{
+    Application& app = Application::GetInstance();
+    app.moduleScene->UpdateAllAABBs();
+
+    sceneBounds.Reset();
+    for (GameObject* gameObject : app.moduleScene->GetAllGameObjects())
+    {
+        if (gameObject && gameObject->GetComponent<ComponentMesh>() && gameObject->GetAABB().IsValid())
+            sceneBounds.Encapsulate(gameObject->GetAABB());
+    }
+
+    if (!sceneBounds.IsValid())
+        sceneBounds = AABB(glm::vec3(-1.0f), glm::vec3(1.0f));
+}
+
+void ModuleBenchmark::PlaceCamera(float t)
+{
+    const glm::vec3 center = sceneBounds.GetCenter();
+    const float radius = std::max(sceneBounds.GetRadius(), 0.5f);
+    const float distance = radius * 2.5f;
+
+    glm::vec3 eye;
+    glm::vec3 target = center;
+    switch (options.path)
+    {
+    case CameraPath::ORBIT:
+    {
+        // Una vuelta completa durante la medida
+        const float angle = t * glm::two_pi<float>();
+        eye = center + glm::vec3(std::cos(angle) * distance, distance * 0.35f, std::sin(angle) * distance);
+        break;
+    }
+    case CameraPath::FLYTHROUGH:
+    {
+        // Atraviesa la escena de +Z a -Z mirando al frente: entra y sale del frustum
+        eye = center + glm::vec3(0.0f, radius * 0.25f, glm::mix(distance, -distance, t));
+        target = eye + glm::vec3(0.0f, 0.0f, -1.0f);
+        break;
+    }
+    case CameraPath::STATIC:
+    default:
+        eye = center + glm::vec3(0.0f, distance * 0.35f, distance);
+        break;
+    }
+
+    Application::GetInstance().camera->lookAt(eye, target);
+}
+
+void ModuleBenchmark::RenderFrame()
+{
+    Application& app = Application::GetInstance();
+
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    glViewport(0, 0, options.width, options.height);
+    glClearColor(0.1f, 0.1f, 0.1f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+    // Sin render bajo demanda siempre hay que dibujar; la llamada fija el tamaño de la escena
+    app.opengl->NeedsSceneRedraw(options.width, options.height);
+    app.moduleScene->RenderScene();
+
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+    // La ventana oculta no frena a la CPU: sin esto los frames se encolarían en
+    // el driver y el tiempo medido no incluiría el trabajo de la GPU
+    glFinish();
+
+    if (measureStart >= 0)
+    {
+        lodTrianglesDrawn += app.opengl->lodStats.trianglesDrawn;
+        lodTrianglesFullDetail += app.opengl->lodStats.trianglesFullDetail;
+        lodMeshesReduced += app.opengl->lodStats.meshesReduced;
+        batchDraws += app.opengl->batchStats.draws;
+        batchInstances += app.opengl->batchStats.instances;
+    }
+}
+
+void ModuleBenchmark::RecordFrame()
+{
+    frameTimes.push_back(FrameTimer::GetLastFrameMs());
+
+    for (int i = 0; i < RenderStats::COUNTER_COUNT; ++i)
+        counterTotals[i] += (double)RenderStats::GetLast((RenderStats::Counter)i);
+
+    // Con FrameLatency frames de retraso, pero la media sobre la ruta es la misma
+    const double gpuMs = GpuProfiler::GetLastFrameMs();
+    if (gpuMs > 0.0)
+        gpuTimes.push_back((float)gpuMs);
+}
+
+bool ModuleBenchmark::WriteResults() const
+{
+    Application& app = Application::GetInstance();
+
+    size_t slash = options.outputPath.find_last_of("/\\");
+    if (slash != std::string::npos)
+        FileUtils::CreateDirectories(options.outputPath.substr(0, slash));
+
+    std::ofstream file(options.outputPath, std::ios::trunc);
+    if (!file)
+    {
+        LOG_ERROR(ENGINE, "Benchmark: could not write {}", options.outputPath);
+        return false;
+    }
+
+    const double frames = (double)frameTimes.size();
+    const char* renderer = (const char*)glGetString(GL_RENDERER);
+    const char* version = (const char*)glGetString(GL_VERSION);
+    char number[64];
+
+    file << "{\n\"config\":{\"scene\":\"";
+    WriteEscaped(file, options.scenePath.c_str());
+    file << "\",\"models\":[";
+    for (size_t i = 0; i < options.models.size(); ++i)
+    {
+        file << (i ? ",\"" : "\"");
+        WriteEscaped(file, options.models[i].c_str());
+        file << "\"";
+    }
+    file << "],\"path\":\"" << GetPathName(options.path) << "\",\"frames\":" << options.frames
+        << ",\"warmup_frames\":" << options.warmupFrames << ",\"load_frames\":" << (measureStart - options.warmupFrames)
+        << ",\"width\":" << options.width << ",\"height\":" << options.height << ",\"profiler\":"
+#if defined(ENGINE_PROFILER)
+        << "true"
+#else
+        << "false"
+#endif
+        << ",\"memory_tracking\":" << (MemoryTracker::IsEnabled() ? "true" : "false")
+        << ",\"gl_renderer\":\"";
+    WriteEscaped(file, renderer ? renderer : "");
+    file << "\",\"gl_version\":\"";
+    WriteEscaped(file, version ? version : "");
+    file << "\"},\n";
+
+    file << "\"scene\":{\"game_objects\":" << app.moduleScene->GetAllGameObjects().size();
+    snprintf(number, sizeof(number), "%.4f", sceneBounds.GetRadius());
+    file << ",\"bounds_radius\":" << number << "},\n";
+
+    file << "\"frame_ms\":";
+    WriteDistribution(file, frameTimes);
+    file << ",\n\"gpu_ms\":";
+    WriteDistribution(file, gpuTimes);
+
+    // Medias por frame
+    file << ",\n\"counters\":{";
+    for (int i = 0; i < RenderStats::COUNTER_COUNT; ++i)
+    {
+        snprintf(number, sizeof(number), "%.2f", counterTotals[i] / frames);
+        file << (i ? "," : "") << "\"" << ToKey(RenderStats::GetName((RenderStats::Counter)i)) << "\":" << number;
+    }
+    file << "},\n\"lod\":{";
+    snprintf(number, sizeof(number), "%.2f", lodTrianglesDrawn / frames);
+    file << "\"triangles_drawn\":" << number;
+    snprintf(number, sizeof(number), "%.2f", lodTrianglesFullDetail / frames);
+    file << ",\"triangles_full_detail\":" << number;
+    snprintf(number, sizeof(number), "%.2f", lodMeshesReduced / frames);
+    file << ",\"meshes_reduced\":" << number << "},\n\"batching\":{";
+    snprintf(number, sizeof(number), "%.2f", batchDraws / frames);
+    file << "\"draws\":" << number;
+    snprintf(number, sizeof(number), "%.2f", batchInstances / frames);
+    file << ",\"instances\":" << number << "},\n";
+
+    file << "\"memory\":{";
+    if (MemoryTracker::IsEnabled())
+    {
+        for (int i = 0; i < (int)MemoryTracker::Tag::COUNT; ++i)
+        {
+            MemoryTracker::TagStats stats = MemoryTracker::GetStats((MemoryTracker::Tag)i);
+            file << (i ? "," : "") << "\"" << ToKey(MemoryTracker::GetTagName((MemoryTracker::Tag)i))
+                << "\":{\"current_bytes\":" << stats.currentBytes << ",\"peak_bytes\":" << stats.peakBytes << "}";
+        }
+    }
+    file << "},\n";
+
+    // Serie completa para comparar builds frame a frame
+    file << "\"frame_times_ms\":[";
+    for (size_t i = 0; i < frameTimes.size(); ++i)
+    {
+        snprintf(number, sizeof(number), "%.4f", frameTimes[i]);
+        file << (i ? "," : "") << number;
+    }
+    file << "]\n}\n";
+
+    if (!file)
+    {
+        LOG_ERROR(ENGINE, "Benchmark: could not write {}", options.outputPath);
+        return false;
+    }
+
+    double total = 0.0;
+    for (float ms : frameTimes)
+        total += ms;
+    LOG_INFO(ENGINE, "Benchmark: {} frames written to {} (mean {:.3f} ms)", frameTimes.size(), options.outputPath,
+        total / frames);
+    return true;
+}
+
+bool ModuleBenchmark::CleanUp()
+{
+    if (depthBuffer)
+        glDeleteRenderbuffers(1, &depthBuffer);
+    if (colorTexture)
+        glDeleteTextures(1, &colorTexture);
+    if (framebuffer)
+        glDeleteFramebuffers(1, &framebuffer);
+    depthBuffer = colorTexture = framebuffer = 0;
+    return true;
+}
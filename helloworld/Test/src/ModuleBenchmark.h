@@ -0,0 +1,81 @@
+#pragma once
+#include "Module.h"
+#include "AABB.h"
+#include <glad/glad.h>
+#include <string>
+#include <vector>
+
+// Benchmark sin pantalla para comparar builds en CI. Sustituye al editor: carga
+// una escena o una lista de modelos, mueve la cámara por una ruta fija que solo
+// depende del número de frame (el resultado no cambia con la velocidad de la
+// máquina) y dibuja la escena en su propio framebuffer. Tras el calentamiento y
+// las cargas de texturas mide N frames y escribe en JSON los tiempos de frame y
+// los contadores del render.
+//
+//     Engine --benchmark --scene ../Assets/Scenes/City.wscene --frames 1000 --output out.json
+class ModuleBenchmark : public Module
+{
+public:
+    enum class CameraPath { ORBIT, FLYTHROUGH, STATIC };
+
+    struct Options
+    {
+        bool enabled = false;
+        std::string scenePath;                  // .wscene; vacía = escena por defecto
+        std::vector<std::string> models;        // se añaden a la escena
+        CameraPath path = CameraPath::ORBIT;
+        int frames = 600;
+        int warmupFrames = 60;
+        int width = 1280;
+        int height = 720;
+        std::string outputPath = "../Library/Benchmark/benchmark.json";
+    };
+
+    // false si algún argumento no es válido (ya se ha explicado por stderr)
+    static bool ParseArgs(int argc, char* argv[], Options& options);
+    static void PrintUsage();
+
+    explicit ModuleBenchmark(const Options& options);
+    ~ModuleBenchmark();
+
+    bool Start() override;
+    bool Update() override;         // false al terminar la medida
+    bool CleanUp() override;
+
+    // Se midieron todos los frames y se escribió el JSON
+    bool Succeeded() const { return succeeded; }
+
+private:
+    bool LoadContent();
+    bool CreateFramebuffer();
+    void UpdateSceneBounds();
+    void PlaceCamera(float t);
+    void RenderFrame();
+    void RecordFrame();
+    bool WriteResults() const;
+
+    static const char* GetPathName(CameraPath path);
+
+    Options options;
+
+    GLuint framebuffer = 0;
+    GLuint colorTexture = 0;
+    GLuint depthBuffer = 0;
+
+    AABB sceneBounds;
+    int frameIndex = 0;
+    int measureStart = -1;          // frame en el que empieza la medida
+    bool succeeded = false;
+
+    // Un valor por frame medido
+    std::vector<float> frameTimes;  // ms
+    std::vector<float> gpuTimes;    // ms, solo frames con resultados del GpuProfiler
+
+    // Sumas de los frames medidos (RenderStats y estadísticas de OpenGL)
+    std::vector<double> counterTotals;
+    double lodTrianglesDrawn = 0.0;
+    double lodTrianglesFullDetail = 0.0;
+    double lodMeshesReduced = 0.0;
+    double batchDraws = 0.0;
+    double batchInstances = 0.0;
+};
@@ -5,8 +5,11 @@
 #include "imgui_impl_opengl3.h"
 #include <SDL3/SDL.h>
 #include <algorithm>
+#include <cctype>
+#include <cmath>
 #include <sstream>
 #include <cstdarg>
+#include <cstring>
 #include "ImGuizmo.h"
 #include "ComponentTransform.h"
 #include <glm/gtc/type_ptr.hpp>
@@ -19,6 +22,21 @@
 #include "ComponentMaterial.h"
 #include "ModuleScene.h"
 #include "Texture.h"
+#include "TextureManager.h"
+#include "TextureResource.h"
+#include "TextureImporter.h"
+#include "TextureStreamer.h"
+#include "ResidencyManager.h"
+#include "TextureArrayPool.h"
+#include "VirtualFileSystem.h"
+#include "MeshCache.h"
+#include "MeshManager.h"
+#include "SceneSerializer.h"
+#include "Profiler.h"
+#include "GpuProfiler.h"
+#include "RenderStats.h"
+#include "FileUtils.h"
+#include "FrameTimer.h"
 
 // Enable experimental GLM extensions used (quaternion utilities)
 #define GLM_ENABLE_EXPERIMENTAL
@@ -28,29 +46,21 @@
 
 
 // Engine console storage definitions
-std::vector<std::string> ModuleEditor::engine_log;
-std::mutex ModuleEditor::engine_log_mutex;
-size_t ModuleEditor::engine_log_max_messages = 8192;
 bool ModuleEditor::engine_log_auto_scroll = true;
 
 static GameObject* editor_selected_gameobject = nullptr;
 
 void ModuleEditor::PushEngineLog(const std::string& msg)
 {
-    std::lock_guard<std::mutex> lock(engine_log_mutex);
-    engine_log.push_back(msg);
-    if (engine_log.size() > engine_log_max_messages)
-        engine_log.erase(engine_log.begin(), engine_log.begin() + (engine_log.size() - engine_log_max_messages));
+    Logger::WriteText(Logger::Level::INFO, Logger::Category::ENGINE, msg.c_str());
 }
 
 void ModuleEditor::PushEnginePrintf(const char* fmt, ...)
 {
-    char buffer[4096];
     va_list args;
     va_start(args, fmt);
-    vsnprintf(buffer, sizeof(buffer), fmt, args);
+    Logger::WriteTextV(Logger::Level::INFO, Logger::Category::ENGINE, fmt, args);
     va_end(args);
-    PushEngineLog(std::string(buffer));
 }
 
 // ============================================
@@ -139,6 +149,16 @@ ModuleEditor::~ModuleEditor()
 bool ModuleEditor::Start()
 {
     IMGUI_CHECKVERSION();
+#if defined(ENGINE_MEMORY_TRACKING)
+    // Lo que reserva ImGui cuenta como memoria del editor
+    ImGui::SetAllocatorFunctions(
+        [](size_t size, void*)
+        {
+            MemoryTracker::Scope scope(MemoryTracker::Tag::EDITOR, "ImGui");
+            return MemoryTracker::Allocate(size);
+        },
+        [](void* ptr, void*) { MemoryTracker::Free(ptr); });
+#endif
     ImGui::CreateContext();
     ImGuiIO& io = ImGui::GetIO();
     io.ConfigFlags |= ImGuiConfigFlags_NavEnableKeyboard;
@@ -217,6 +237,7 @@ bool ModuleEditor::PreUpdate()
 
 bool ModuleEditor::Update()
 {
+    MEMORY_TAG(EDITOR);
     float current_fps = ImGui::GetIO().Framerate;
     fps_history[fps_pos] = current_fps;
     fps_pos = (fps_pos + 1) % FPS_HISTORY_SIZE;
@@ -227,6 +248,18 @@ bool ModuleEditor::Update()
     {
         if (ImGui::BeginMenu("File"))
         {
+            auto& app = Application::GetInstance();
+            if (ImGui::MenuItem("Save Scene") && app.moduleScene)
+            {
+                bool saved = app.moduleScene->SaveScene(SceneSerializer::DefaultPath);
+                PushEnginePrintf(saved ? "Scene saved to %s" : "Could not save scene to %s", SceneSerializer::DefaultPath);
+            }
+            if (ImGui::MenuItem("Load Scene") && app.moduleScene)
+            {
+                bool loaded = app.moduleScene->LoadScene(SceneSerializer::DefaultPath);
+                PushEnginePrintf(loaded ? "Scene loaded from %s" : "Could not load scene from %s", SceneSerializer::DefaultPath);
+            }
+            ImGui::Separator();
             if (ImGui::MenuItem("Exit"))
             {
                 SDL_Event evt;
@@ -307,6 +340,10 @@ bool ModuleEditor::Update()
                 ImGui::MenuItem("Performance", NULL, &show_config_performance);
                 ImGui::MenuItem("Modules", NULL, &show_config_modules);
                 ImGui::MenuItem("System", NULL, &show_config_system);
+                ImGui::MenuItem("GPU Memory", NULL, &show_gpu_memory);
+                ImGui::MenuItem("Memory", NULL, &show_memory);
+                ImGui::MenuItem("Profiler", NULL, &show_profiler);
+                ImGui::MenuItem("Render Stats Overlay", NULL, &show_render_stats_overlay);
                 ImGui::EndMenu();
             }
 
@@ -472,7 +509,10 @@ bool ModuleEditor::Update()
     }
 
     // ===== RENDERIZAR ESCENA AL FRAMEBUFFER =====
-    if (sceneFramebuffer != 0 && Application::GetInstance().moduleScene)
+    // Con render bajo demanda el FBO conserva la imagen anterior si nada ha cambiado
+    auto& renderApp = Application::GetInstance();
+    if (sceneFramebuffer != 0 && renderApp.moduleScene && renderApp.opengl &&
+        renderApp.opengl->NeedsSceneRedraw(sceneFBWidth, sceneFBHeight))
     {
         glBindFramebuffer(GL_FRAMEBUFFER, sceneFramebuffer);
         glViewport(0, 0, sceneFBWidth, sceneFBHeight);
@@ -518,6 +558,7 @@ bool ModuleEditor::Update()
 
     ImGui::SetCursorPos(imagePos);
     ImGui::Image((ImTextureID)(intptr_t)sceneTexture, imageSize, ImVec2(0, 1), ImVec2(1, 0));
+    ImVec2 imageMin = ImGui::GetItemRectMin();
 
     // CRÍTICO: Hacer la imagen "clickeable" para mouse picking
     bool imageHovered = ImGui::IsItemHovered();
@@ -532,6 +573,9 @@ bool ModuleEditor::Update()
     // ===== DIBUJAR GIZMO DENTRO DEL VIEWPORT =====
     HandleGizmo();
 
+    if (show_render_stats_overlay)
+        DrawRenderStatsOverlay(imageMin);
+
     // ===== MOUSE PICKING (dentro del viewport) =====
     if (imageClicked && !ImGuizmo::IsUsing() && !ImGuizmo::IsOver())
     {
@@ -585,52 +629,7 @@ bool ModuleEditor::Update()
 
     // Hierarchy window
     if (show_hierarchy_window)
-    {
-        ImGuiViewport* viewport = ImGui::GetMainViewport();
-        ImVec2 hierPos = ImVec2(viewport->WorkPos.x + 10.0f, viewport->WorkPos.y + 10.0f);
-        ImGui::SetNextWindowPos(hierPos, ImGuiCond_Always);
-        ImGui::SetNextWindowSize(ImVec2(250, 400), ImGuiCond_FirstUseEver);
-        ImGuiWindowFlags hierFlags = ImGuiWindowFlags_NoMove | ImGuiWindowFlags_NoCollapse;
-
-        ImGui::Begin("Hierarchy", NULL, hierFlags);
-
-        auto& app = Application::GetInstance();
-        if (app.moduleScene)
-        {
-            const std::vector<GameObject*>& all = app.moduleScene->GetAllGameObjects();
-
-            for (GameObject* go : all)
-            {
-                if (!go) continue;
-
-                ImGuiTreeNodeFlags node_flags = ImGuiTreeNodeFlags_Leaf;
-                if (go == editor_selected_gameobject || go == app.moduleScene->GetSelectedGameObject())
-                {
-                    node_flags |= ImGuiTreeNodeFlags_Selected;
-                }
-
-                bool node_open = ImGui::TreeNodeEx((void*)go, node_flags, "%s", go->GetName());
-
-                if (ImGui::IsItemClicked())
-                {
-                    editor_selected_gameobject = go;
-                    app.moduleScene->SetSelectedGameObject(go);
-                    PushEnginePrintf("Selected GameObject: %s", go->GetName());
-                }
-
-                if (node_open)
-                {
-                    ImGui::TreePop();
-                }
-            }
-        }
-        else
-        {
-            ImGui::Text("ModuleScene not available");
-        }
-
-        ImGui::End();
-    }
+        DrawHierarchyWindow();
 
     // Inspector window
     if (show_inspector_window)
@@ -769,6 +768,16 @@ bool ModuleEditor::Update()
                     ImGui::Text("Vertices: %d", (int)mesh->GetVertexCount());
                     ImGui::Text("Indices: %d", (int)mesh->GetIndexCount());
                     ImGui::Text("Triangles: %d", (int)mesh->GetIndexCount() / 3);
+                    ImGui::Text("LOD: %d / %d (%u triangles)", mesh->GetCurrentLOD(), mesh->GetLODCount(),
+                        mesh->GetLODTriangleCount(mesh->GetCurrentLOD()));
+                    ImGui::Text("Vertex format: %s (%d bytes)", mesh->HasPackedVertices() ? "Compressed" : "Float",
+                        (int)mesh->GetVertexStride());
+                    ImGui::Text("Index format: %s, %d range(s), %.1f KB", IndexBuffer::TypeName(mesh->GetIndexType()),
+                        (int)mesh->GetIndexRangeCount(), mesh->GetIndexBufferBytes() / 1024.0f);
+                    ImGui::Text("Memory: %.1f KB CPU / %.1f KB GPU", mesh->GetCPUMemoryBytes() / 1024.0f,
+                        mesh->GetGPUMemoryBytes() / 1024.0f);
+                    if (mesh->GetResourceUseCount() > 1)
+                        ImGui::Text("Shared by %ld instances", mesh->GetResourceUseCount());
 
                     ImGui::Checkbox("Show Normals", &show_normals);
 
@@ -795,6 +804,18 @@ bool ModuleEditor::Update()
 
                     ImGui::Text("Path: %s", path ? path : "(none)");
                     ImGui::Text("Size: %dx%d", w, h);
+                    if (mat->GetTexture())
+                    {
+                        ImGui::Text("Format: %s", TextureImporter::GetFormatName(mat->GetTexture()->GetFormat()));
+                        int residentMip = TextureStreamer::GetResidentMip(mat->GetTexture().get());
+                        if (residentMip >= 0)
+                            ImGui::Text("Resident from mip %d (%dx%d)", residentMip, std::max(1, w >> residentMip), std::max(1, h >> residentMip));
+                        ImGui::Text("References: %ld", mat->GetTexture().use_count());
+                        if (!mat->GetTexture()->IsReady())
+                            ImGui::TextDisabled("(loading...)");
+                        else if (mat->GetTexture()->HasFailed())
+                            ImGui::TextColored(ImVec4(1.0f, 0.4f, 0.4f, 1.0f), "Failed to load, showing default");
+                    }
 
                     bool old = inspector_show_checkerboard;
                     ImGui::Checkbox("Use default checkerboard in scene", &inspector_show_checkerboard);
@@ -803,12 +824,7 @@ bool ModuleEditor::Update()
                     {
                         if (inspector_show_checkerboard)
                         {
-                            if (inspectorCheckerTex == 0)
-                            {
-                                inspectorCheckerTex = Texture::CreateCheckerboardTexture(512, 512, 32);
-                            }
-
-                            mat->SetOverrideTexture(inspectorCheckerTex, false);
+                            mat->SetOverrideTexture(TextureManager::GetDefault()->GetID(), false);
                             inspectorOverrideTarget = (void*)selected;
                         }
                         else
@@ -833,38 +849,7 @@ bool ModuleEditor::Update()
 
     // Console window
     if (show_console_window)
-    {
-        // Calcular posición de la consola (parte inferior de la ventana)
-        ImGuiViewport* viewport = ImGui::GetMainViewport();
-        float consoleHeight = 200.0f;
-        ImVec2 consolePos = ImVec2(viewport->WorkPos.x, viewport->WorkPos.y + viewport->WorkSize.y - consoleHeight);
-        ImVec2 consoleSize = ImVec2(viewport->WorkSize.x, consoleHeight);
-
-        ImGui::SetNextWindowPos(consolePos, ImGuiCond_Always);
-        ImGui::SetNextWindowSize(consoleSize, ImGuiCond_Always);
-
-        ImGuiWindowFlags consoleFlags = ImGuiWindowFlags_NoMove | ImGuiWindowFlags_NoResize;
-
-        ImGui::Begin("Console", &show_console_window, consoleFlags);
-
-        ImGui::Checkbox("Auto-scroll", &engine_log_auto_scroll);
-
-        ImGui::Separator();
-
-        ImGui::BeginChild("ConsoleRegion", ImVec2(0, 0), false, ImGuiWindowFlags_HorizontalScrollbar);
-        {
-            std::lock_guard<std::mutex> lock(engine_log_mutex);
-            for (const auto& line : engine_log)
-            {
-                ImGui::TextUnformatted(line.c_str());
-            }
-            if (engine_log_auto_scroll)
-                ImGui::SetScrollHereY(1.0f);
-        }
-        ImGui::EndChild();
-
-        ImGui::End();
-    }
+        DrawConsoleWindow();
 
     // Config: Performance
     if (show_config_performance)
@@ -884,6 +869,67 @@ bool ModuleEditor::Update()
             ImGui::PlotLines("FPS", temp, count, 0, NULL, 0.0f, 240.0f, ImVec2(0, 80));
         }
         ImGui::Text("Current: %.1f FPS", fps_history[(fps_pos + FPS_HISTORY_SIZE - 1) % FPS_HISTORY_SIZE]);
+
+        auto& app = Application::GetInstance();
+
+        ImGui::Separator();
+        ImGui::Text("Frame Timing");
+        {
+            float p50, p95, p99;
+            FrameTimer::GetPercentiles(p50, p95, p99);
+            ImGui::Text("p50 %.2f ms   p95 %.2f ms   p99 %.2f ms  (last %d frames)",
+                p50, p95, p99, FrameTimer::GetHistoryCount());
+
+            char overlay[32];
+            snprintf(overlay, sizeof(overlay), "%.2f ms", FrameTimer::GetDeltaTime() * 1000.0f);
+            ImGui::PlotLines("Frame time", FrameTimer::GetHistory(), FrameTimer::GetHistoryCount(),
+                FrameTimer::GetHistoryOffset(), overlay, 0.0f, std::max(p99 * 1.5f, 1.0f), ImVec2(0, 60));
+
+            int targetFps = FrameTimer::GetTargetFps();
+            if (ImGui::SliderInt("FPS limit (0 = off)", &targetFps, 0, 360))
+                FrameTimer::SetTargetFps(targetFps);
+            if (targetFps > 0 && app.window && app.window->vsync)
+                ImGui::TextDisabled("The limit only applies with VSync off");
+
+            int fixedRate = (int)std::lround(1.0f / FrameTimer::GetFixedDeltaTime());
+            if (ImGui::SliderInt("Fixed update (Hz)", &fixedRate, 10, 240))
+                FrameTimer::SetFixedDeltaTime(1.0f / fixedRate);
+        }
+        if (app.opengl)
+        {
+            ImGui::Separator();
+            ImGui::Text("Level of Detail");
+            ImGui::Checkbox("Enable LOD", &app.opengl->enableLOD);
+            ImGui::SliderFloat("Hysteresis", &app.opengl->lodHysteresis, 0.0f, 0.5f);
+
+            const OpenGL::LODStats& stats = app.opengl->lodStats;
+            unsigned int saved = stats.trianglesFullDetail - stats.trianglesDrawn;
+            float savedPct = stats.trianglesFullDetail > 0 ? 100.0f * saved / stats.trianglesFullDetail : 0.0f;
+            ImGui::Text("Triangles drawn: %u / %u", stats.trianglesDrawn, stats.trianglesFullDetail);
+            ImGui::Text("Triangles saved: %u (%.1f%%)", saved, savedPct);
+            ImGui::Text("Meshes at reduced LOD: %u", stats.meshesReduced);
+
+            ImGui::Separator();
+            ImGui::Text("Batching");
+            ImGui::Checkbox("Texture arrays + instancing", &TextureArrayPool::enabled);
+            ImGui::Text("Arrays: %d, layers in use: %d",
+                (int)TextureArrayPool::GetArrayCount(), (int)TextureArrayPool::GetUsedLayerCount());
+            ImGui::Text("Batched draws: %u (%u objects)", app.opengl->batchStats.draws, app.opengl->batchStats.instances);
+
+            ImGui::Separator();
+            ImGui::Text("GPU Passes");
+            ImGui::Checkbox("GPU timer queries", &GpuProfiler::enabled);
+            DrawGpuPassTable();
+
+            ImGui::Separator();
+            ImGui::Text("Renderer");
+            ImGui::Checkbox("Frustum culling", &app.opengl->enableFrustumCulling);
+            ImGui::Checkbox("Render on demand", &app.opengl->renderOnDemand);
+            if (ImGui::IsItemHovered())
+                ImGui::SetTooltip("Redraw the viewport only when the camera, scene, selection or size change;\nthe editor sleeps until the next event while idle");
+            ImGui::Checkbox("Viewport overlay", &show_render_stats_overlay);
+            DrawRenderStatsHistory();
+        }
         ImGui::End();
     }
 
@@ -917,6 +963,16 @@ bool ModuleEditor::Update()
         ImGui::Text("Renderer");
         ImGui::Indent();
         ImGui::TextWrapped("The Renderer module handles drawing the scene using OpenGL.\nIt controls rendering modes (wireframe/fill), clear color, culling and depth testing. Use the Scene/Renderer configuration or debug options in the main UI to toggle wireframe or other renderer-specific debug views.");
+        if (ImGui::Checkbox("Compressed vertex format", &MeshResource::useCompressedVertices))
+        {
+            PushEnginePrintf("Compressed vertex format %s (applies to meshes loaded from now on)",
+                MeshResource::useCompressedVertices ? "enabled" : "disabled");
+        }
+        if (ImGui::Checkbox("Keep CPU vertex data", &MeshResource::keepCPUVertexData))
+        {
+            PushEnginePrintf("CPU vertex data %s after upload (applies to meshes loaded from now on)",
+                MeshResource::keepCPUVertexData ? "kept" : "released");
+        }
         ImGui::Unindent();
 
         ImGui::Separator();
@@ -931,6 +987,108 @@ bool ModuleEditor::Update()
         ImGui::Text("Textures");
         ImGui::Indent();
         ImGui::TextWrapped("The Textures module is responsible for texture loading and sampling.\nFiltering (Nearest/Linear), mipmap generation and GPU upload behavior are controlled by the renderer/resource manager. Use the material/texture inspector to preview textures and change sampler settings where available.");
+        ImGui::Text("Loaded textures: %d (cache hits: %u)", (int)TextureManager::GetLoadedCount(), TextureManager::GetHits());
+        ImGui::Text("Pending uploads: %d", (int)TextureManager::GetPendingCount());
+        ImGui::Checkbox("Compress on import (BC1/BC3/BC5)", &TextureImporter::compressOnImport);
+
+        ImGui::Checkbox("Mip streaming", &TextureStreamer::enabled);
+        int vramBudgetMB = (int)(TextureStreamer::vramBudgetBytes / (1024 * 1024));
+        if (ImGui::SliderInt("Streaming VRAM budget (MB)", &vramBudgetMB, 16, 2048))
+            TextureStreamer::vramBudgetBytes = (size_t)vramBudgetMB * 1024 * 1024;
+        ImGui::Text("Streamed textures: %d, resident %.1f MB of %.1f MB",
+            (int)TextureStreamer::GetStreamedCount(),
+            TextureStreamer::GetResidentBytes() / (1024.0f * 1024.0f),
+            TextureStreamer::GetFullBytes() / (1024.0f * 1024.0f));
+        int uploadBudgetMB = (int)(TextureManager::uploadBudgetBytes / (1024 * 1024));
+        if (ImGui::SliderInt("Upload budget (MB/frame)", &uploadBudgetMB, 1, 64))
+            TextureManager::uploadBudgetBytes = (size_t)uploadBudgetMB * 1024 * 1024;
+        ImGui::Unindent();
+
+        ImGui::Separator();
+
+        ImGui::Text("Mesh Cache");
+        ImGui::Indent();
+        ImGui::Checkbox("Cache processed meshes (Library/Meshes)", &MeshCache::enabled);
+        ImGui::Text("Cache hits: %u, misses: %u, last model: %.1f ms",
+            MeshManager::GetDiskCacheHits(), MeshManager::GetDiskCacheMisses(), MeshManager::GetLastPreloadMs());
+        ImGui::Checkbox("Draco compression (new entries)", &MeshCache::useDraco);
+        ImGui::SliderInt("Position bits", &MeshCache::positionBits, 8, 20);
+        ImGui::SliderInt("Normal bits", &MeshCache::normalBits, 6, 16);
+        ImGui::SliderInt("UV bits", &MeshCache::texCoordBits, 8, 16);
+        ImGui::SliderInt("Compression level", &MeshCache::compressionLevel, 0, 10);
+        if (ImGui::Button("Benchmark raw vs Draco"))
+        {
+            MeshCache::RunBenchmark("../Assets/Models");
+            PushEnginePrintf("Mesh cache benchmark: %d models", (int)MeshCache::GetBenchmark().size());
+        }
+        if (!MeshCache::GetBenchmark().empty() && ImGui::BeginTable("MeshCacheBenchmark", 5, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg))
+        {
+            ImGui::TableSetupColumn("Model");
+            ImGui::TableSetupColumn("Raw (KB)");
+            ImGui::TableSetupColumn("Draco (KB)");
+            ImGui::TableSetupColumn("Raw decode (ms)");
+            ImGui::TableSetupColumn("Draco decode (ms)");
+            ImGui::TableHeadersRow();
+            for (const MeshCache::BenchmarkResult& result : MeshCache::GetBenchmark())
+            {
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn(); ImGui::Text("%s", result.model.c_str());
+                ImGui::TableNextColumn(); ImGui::Text("%.1f", result.rawBytes / 1024.0f);
+                ImGui::TableNextColumn(); ImGui::Text("%.1f (%.0f%%)", result.dracoBytes / 1024.0f,
+                    100.0f * result.dracoBytes / std::max<size_t>(1, result.rawBytes));
+                ImGui::TableNextColumn(); ImGui::Text("%.2f", result.rawDecodeMs);
+                ImGui::TableNextColumn(); ImGui::Text("%.2f", result.dracoDecodeMs);
+            }
+            ImGui::EndTable();
+        }
+        ImGui::Unindent();
+
+        ImGui::Separator();
+
+        ImGui::Text("Scene Serialization");
+        ImGui::Indent();
+        const SceneSerializer::Timings& timings = SceneSerializer::GetLastTimings();
+        if (timings.nodes > 0)
+        {
+            ImGui::Text("Last: %d nodes, %.1f KB", (int)timings.nodes, timings.fileBytes / 1024.0f);
+            ImGui::Text("Save %.2f ms, read %.2f ms, build %.2f ms", timings.saveMs, timings.readMs, timings.buildMs);
+        }
+        if (ImGui::Button("Benchmark 100k nodes"))
+        {
+            auto& app = Application::GetInstance();
+            if (app.moduleScene)
+            {
+                SceneSerializer::Timings result = SceneSerializer::RunBenchmark(*app.moduleScene, 100000);
+                PushEnginePrintf("Scene benchmark: %d nodes, load %.1f ms (read %.1f + build %.1f), save %.1f ms",
+                    (int)result.nodes, result.readMs + result.buildMs, result.readMs, result.buildMs, result.saveMs);
+            }
+        }
+        ImGui::Unindent();
+
+        ImGui::Separator();
+
+        ImGui::Text("File System");
+        ImGui::Indent();
+        ImGui::Text("Indexed files: %d", (int)VirtualFileSystem::GetFileCount());
+        for (const VirtualFileSystem::MountInfo& mount : VirtualFileSystem::GetMounts())
+        {
+            if (mount.isPack)
+                ImGui::BulletText("%s <- %s (pack, %d files, %.1f MB)", mount.mountPoint.c_str(), mount.source.c_str(),
+                    (int)mount.fileCount, mount.bytes / (1024.0f * 1024.0f));
+            else
+                ImGui::BulletText("%s <- %s (%d files)", mount.mountPoint.c_str(), mount.source.c_str(), (int)mount.fileCount);
+        }
+        if (ImGui::Button("Build Assets.pak"))
+        {
+            // El paquete montado está proyectado y no se puede reemplazar: se desmonta todo primero
+            VirtualFileSystem::UnmountAll();
+            bool built = VirtualFileSystem::BuildPack("../Assets", "../Assets.pak");
+            if (FileUtils::IsDirectory("../Assets"))
+                VirtualFileSystem::Mount("../Assets", "../Assets");
+            if (FileUtils::Exists("../Assets.pak"))
+                VirtualFileSystem::Mount("../Assets", "../Assets.pak");
+            PushEnginePrintf(built ? "Assets.pak built and mounted" : "Could not build Assets.pak");
+        }
         ImGui::Unindent();
 
         ImGui::End();
@@ -959,6 +1117,257 @@ bool ModuleEditor::Update()
         ImGui::End();
     }
 
+    // Profiler: flame graph del último frame (una franja por hilo) y traza de Chrome
+    if (show_profiler)
+    {
+        ImGui::Begin("Profiler", &show_profiler);
+
+        bool profilerEnabled = Profiler::enabled;
+        if (ImGui::Checkbox("Enabled", &profilerEnabled))
+            Profiler::enabled = profilerEnabled;
+        ImGui::SameLine();
+        ImGui::Checkbox("Pause", &profiler_paused);
+        ImGui::SameLine();
+        if (!Profiler::IsCapturing())
+        {
+            if (ImGui::Button("Start capture"))
+                Profiler::StartCapture();
+        }
+        else if (ImGui::Button("Stop capture"))
+        {
+            Profiler::StopCapture();
+        }
+        ImGui::SameLine();
+        if (ImGui::Button("Export Chrome trace"))
+        {
+            const char* tracePath = "../Library/Profiler/trace.json";
+            bool exported = Profiler::ExportChromeTrace(tracePath);
+            PushEnginePrintf(exported ? "Trace exported to %s (open in chrome://tracing or Perfetto)" : "Could not export trace to %s", tracePath);
+        }
+        ImGui::Text("Captured events: %d%s, dropped: %d", (int)Profiler::GetCapturedEventCount(),
+            Profiler::IsCapturing() ? " (capturing)" : "", (int)Profiler::GetDroppedEvents());
+
+        if (!profiler_paused)
+        {
+            profiler_frame = Profiler::GetLastFrame();
+            profiler_frame_start = Profiler::GetLastFrameStart();
+            profiler_frame_end = Profiler::GetLastFrameEnd();
+        }
+
+        const double frameNs = (double)std::max<uint64_t>(1, profiler_frame_end - profiler_frame_start);
+        ImGui::Text("Frame: %.3f ms", frameNs / 1000000.0);
+        ImGui::Separator();
+
+        static const ImU32 palette[] = {
+            IM_COL32(230, 126, 34, 255), IM_COL32(52, 152, 219, 255), IM_COL32(46, 204, 113, 255),
+            IM_COL32(155, 89, 182, 255), IM_COL32(241, 196, 15, 255), IM_COL32(231, 76, 60, 255),
+            IM_COL32(26, 188, 156, 255), IM_COL32(149, 165, 166, 255) };
+
+        ImDrawList* drawList = ImGui::GetWindowDrawList();
+        const float rowHeight = ImGui::GetFontSize() + 4.0f;
+        const float width = std::max(100.0f, ImGui::GetContentRegionAvail().x);
+        const double pixelsPerNs = width / frameNs;
+
+        for (const Profiler::ThreadEvents& thread : profiler_frame)
+        {
+            if (thread.events.empty())
+                continue;
+
+            uint32_t maxDepth = 0;
+            for (const Profiler::Event& event : thread.events)
+                maxDepth = std::max(maxDepth, event.depth);
+
+            ImGui::Text("%s", thread.threadName.c_str());
+            ImVec2 origin = ImGui::GetCursorScreenPos();
+            ImVec2 size(width, (maxDepth + 1) * rowHeight);
+            ImGui::InvisibleButton(thread.threadName.c_str(), size);
+
+            drawList->PushClipRect(origin, ImVec2(origin.x + size.x, origin.y + size.y), true);
+            for (const Profiler::Event& event : thread.events)
+            {
+                // Los jobs pueden empezar en un frame anterior
+                double start = (double)event.start - (double)profiler_frame_start;
+                double end = (double)event.end - (double)profiler_frame_start;
+                if (end < 0.0 || start > frameNs)
+                    continue;
+
+                float x0 = origin.x + (float)(std::max(0.0, start) * pixelsPerNs);
+                float x1 = std::max(x0 + 1.0f, origin.x + (float)(std::min(frameNs, end) * pixelsPerNs));
+                float y0 = origin.y + event.depth * rowHeight;
+                ImVec2 min(x0, y0);
+                ImVec2 max(x1, y0 + rowHeight - 1.0f);
+
+                // Mismo color para el mismo nombre en todos los frames
+                uint32_t hash = 2166136261u;
+                for (const char* c = event.name; *c; ++c)
+                    hash = (hash ^ (unsigned char)*c) * 16777619u;
+                drawList->AddRectFilled(min, max, palette[hash % (sizeof(palette) / sizeof(palette[0]))]);
+                if (ImGui::CalcTextSize(event.name).x + 4.0f < x1 - x0)
+                    drawList->AddText(ImVec2(x0 + 2.0f, y0 + 2.0f), IM_COL32(0, 0, 0, 255), event.name);
+
+                if (ImGui::IsMouseHoveringRect(min, max))
+                    ImGui::SetTooltip("%s\n%.3f ms", event.name, (event.end - event.start) / 1000000.0);
+            }
+            drawList->PopClipRect();
+        }
+
+        ImGui::End();
+    }
+
+    // GPU Memory: lo que ResidencyManager tiene registrado en VRAM
+    if (show_gpu_memory)
+    {
+        ImGui::Begin("GPU Memory", &show_gpu_memory);
+
+        const float MB = 1024.0f * 1024.0f;
+        size_t total = ResidencyManager::GetTotalBytes();
+        ImGui::Text("Total: %.1f MB of %.1f MB", total / MB, ResidencyManager::budgetBytes / MB);
+        ImGui::ProgressBar(ResidencyManager::budgetBytes > 0 ? std::min(1.0f, (float)total / ResidencyManager::budgetBytes) : 0.0f);
+        for (int i = 0; i < (int)ResidencyManager::Category::COUNT; ++i)
+        {
+            ResidencyManager::Category category = (ResidencyManager::Category)i;
+            ImGui::BulletText("%s: %.1f MB", ResidencyManager::GetCategoryName(category),
+                ResidencyManager::GetCategoryBytes(category) / MB);
+        }
+        ImGui::Text("Evictions: %u", ResidencyManager::GetEvictionCount());
+
+        ImGui::Checkbox("Enforce budget", &ResidencyManager::enforceBudget);
+        int budgetMB = (int)(ResidencyManager::budgetBytes / (1024 * 1024));
+        if (ImGui::SliderInt("Budget (MB)", &budgetMB, 16, 8192))
+            ResidencyManager::budgetBytes = (size_t)budgetMB * 1024 * 1024;
+        int idleFrames = (int)ResidencyManager::minIdleFrames;
+        if (ImGui::SliderInt("Min idle frames", &idleFrames, 1, 600))
+            ResidencyManager::minIdleFrames = (unsigned int)idleFrames;
+
+        ImGui::Separator();
+        if (ImGui::BeginTable("Allocations", 5, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_ScrollY | ImGuiTableFlags_Resizable))
+        {
+            ImGui::TableSetupColumn("Owner", ImGuiTableColumnFlags_WidthStretch);
+            ImGui::TableSetupColumn("Type", ImGuiTableColumnFlags_WidthFixed);
+            ImGui::TableSetupColumn("KB", ImGuiTableColumnFlags_WidthFixed);
+            ImGui::TableSetupColumn("Idle frames", ImGuiTableColumnFlags_WidthFixed);
+            ImGui::TableSetupColumn("Evictions", ImGuiTableColumnFlags_WidthFixed);
+            ImGui::TableHeadersRow();
+
+            uint64_t frame = ResidencyManager::GetFrame();
+            for (const auto& pair : ResidencyManager::GetAllocations())
+            {
+                const ResidencyManager::Allocation& allocation = pair.second;
+                ImGui::TableNextRow();
+                ImGui::TableSetColumnIndex(0);
+                ImGui::TextUnformatted(allocation.owner.c_str());
+                ImGui::TableSetColumnIndex(1);
+                ImGui::TextUnformatted(ResidencyManager::GetCategoryName(allocation.category));
+                ImGui::TableSetColumnIndex(2);
+                if (allocation.bytes > 0)
+                    ImGui::Text("%.1f", allocation.bytes / 1024.0f);
+                else
+                    ImGui::TextDisabled("evicted");
+                ImGui::TableSetColumnIndex(3);
+                ImGui::Text("%llu", (unsigned long long)(frame - allocation.lastUsedFrame));
+                ImGui::TableSetColumnIndex(4);
+                ImGui::Text("%u", allocation.evictions);
+            }
+            ImGui::EndTable();
+        }
+
+        ImGui::End();
+    }
+
+    // Memory: RAM por subsistema según MemoryTracker
+    if (show_memory)
+    {
+        ImGui::Begin("Memory", &show_memory);
+
+        if (!MemoryTracker::IsEnabled())
+        {
+            ImGui::TextDisabled("Built without ENGINE_MEMORY_TRACKING");
+        }
+        else
+        {
+            const float MB = 1024.0f * 1024.0f;
+            if (ImGui::BeginTable("MemoryTags", 6, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg))
+            {
+                ImGui::TableSetupColumn("Category");
+                ImGui::TableSetupColumn("Current MB");
+                ImGui::TableSetupColumn("Peak MB");
+                ImGui::TableSetupColumn("Blocks");
+                ImGui::TableSetupColumn("Peak blocks");
+                ImGui::TableSetupColumn("Allocations");
+                ImGui::TableHeadersRow();
+
+                MemoryTracker::TagStats total;
+                for (int i = 0; i < (int)MemoryTracker::Tag::COUNT; ++i)
+                {
+                    MemoryTracker::Tag tag = (MemoryTracker::Tag)i;
+                    MemoryTracker::TagStats stats = MemoryTracker::GetStats(tag);
+                    total.currentBytes += stats.currentBytes;
+                    total.currentCount += stats.currentCount;
+                    total.totalAllocations += stats.totalAllocations;
+
+                    ImGui::TableNextRow();
+                    ImGui::TableNextColumn(); ImGui::TextUnformatted(MemoryTracker::GetTagName(tag));
+                    ImGui::TableNextColumn(); ImGui::Text("%.2f", stats.currentBytes / MB);
+                    ImGui::TableNextColumn(); ImGui::Text("%.2f", stats.peakBytes / MB);
+                    ImGui::TableNextColumn(); ImGui::Text("%llu", (unsigned long long)stats.currentCount);
+                    ImGui::TableNextColumn(); ImGui::Text("%llu", (unsigned long long)stats.peakCount);
+                    ImGui::TableNextColumn(); ImGui::Text("%llu", (unsigned long long)stats.totalAllocations);
+                }
+
+                // Los picos de cada categoría no coinciden en el tiempo: no se suman
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn(); ImGui::TextUnformatted("Total");
+                ImGui::TableNextColumn(); ImGui::Text("%.2f", total.currentBytes / MB);
+                ImGui::TableNextColumn(); ImGui::TextDisabled("-");
+                ImGui::TableNextColumn(); ImGui::Text("%llu", (unsigned long long)total.currentCount);
+                ImGui::TableNextColumn(); ImGui::TextDisabled("-");
+                ImGui::TableNextColumn(); ImGui::Text("%llu", (unsigned long long)total.totalAllocations);
+                ImGui::EndTable();
+            }
+            if (MemoryTracker::GetForeignFreeCount() > 0)
+                ImGui::TextDisabled("%llu frees of blocks not allocated by the tracker (ignored)",
+                    (unsigned long long)MemoryTracker::GetForeignFreeCount());
+
+            {
+                std::lock_guard<std::mutex> lock(Logger::GetHistoryMutex());
+                ImGui::Text("Console log: %d / %d lines", (int)Logger::GetHistory().size(), (int)Logger::HistoryCapacity);
+            }
+
+            ImGui::Separator();
+            bool captureSites = MemoryTracker::IsSiteCapture();
+            if (ImGui::Checkbox("Capture allocation sites", &captureSites))
+            {
+                MemoryTracker::SetSiteCapture(captureSites);
+                PushEnginePrintf("Allocation site capture %s", captureSites ? "enabled" : "disabled");
+            }
+            ImGui::SameLine();
+            if (ImGui::Button("Refresh"))
+                memory_sites = MemoryTracker::GetLiveSites();
+
+            if (!memory_sites.empty() && ImGui::BeginTable("MemorySites", 4,
+                ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_ScrollY | ImGuiTableFlags_Resizable))
+            {
+                ImGui::TableSetupColumn("Site", ImGuiTableColumnFlags_WidthStretch);
+                ImGui::TableSetupColumn("Category", ImGuiTableColumnFlags_WidthFixed);
+                ImGui::TableSetupColumn("Blocks", ImGuiTableColumnFlags_WidthFixed);
+                ImGui::TableSetupColumn("KB", ImGuiTableColumnFlags_WidthFixed);
+                ImGui::TableHeadersRow();
+
+                for (const MemoryTracker::SiteStats& site : memory_sites)
+                {
+                    ImGui::TableNextRow();
+                    ImGui::TableNextColumn(); ImGui::TextUnformatted(site.site);
+                    ImGui::TableNextColumn(); ImGui::TextUnformatted(MemoryTracker::GetTagName(site.tag));
+                    ImGui::TableNextColumn(); ImGui::Text("%llu", (unsigned long long)site.count);
+                    ImGui::TableNextColumn(); ImGui::Text("%.1f", site.bytes / 1024.0f);
+                }
+                ImGui::EndTable();
+            }
+        }
+
+        ImGui::End();
+    }
+
     // About window
     if (show_about_window)
     {
@@ -983,6 +1392,11 @@ bool ModuleEditor::Update()
         }
     }
 
+    // Lo que se cambie desde la UI (checkboxes, sliders, menús) se ve en el frame siguiente
+    if (ImGui::IsAnyItemActive() || ImGui::IsMouseReleased(ImGuiMouseButton_Left) ||
+        ImGui::IsMouseReleased(ImGuiMouseButton_Right))
+        OpenGL::RequestRedraw();
+
     return true;
 }
 
@@ -991,6 +1405,7 @@ bool ModuleEditor::PostUpdate()
     // IMPORTANTE: Solo renderizar ImGui, NO la escena 3D
     // La escena ya se renderizó en Update() al framebuffer
 
+    PROFILE_SCOPE("ImGui render");
     ImGui::Render();
 
     // Limpiar el backbuffer principal (para ImGui)
@@ -1005,7 +1420,10 @@ bool ModuleEditor::PostUpdate()
     glEnable(GL_BLEND);
     glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 
-    ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+    {
+        PROFILE_GPU_SCOPE("ImGui");
+        ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+    }
 
     // Restaurar estado para próximo frame
     glEnable(GL_DEPTH_TEST);
@@ -1014,13 +1432,473 @@ bool ModuleEditor::PostUpdate()
     return true;
 }
 
+// Tiempo de GPU de cada pasada junto al de CPU del scope con el mismo nombre en el
+// hilo principal. Las pasadas que se repiten en el frame (Grid, Scene objects...) se suman.
+void ModuleEditor::DrawGpuPassTable()
+{
+    struct PassRow
+    {
+        const char* name;
+        double gpuMs;
+        double cpuMs;
+    };
+    std::vector<PassRow> rows;
+
+    for (const GpuProfiler::PassTiming& timing : GpuProfiler::GetLastResults())
+    {
+        auto it = std::find_if(rows.begin(), rows.end(), [&](const PassRow& row)
+            { return strcmp(row.name, timing.name) == 0; });
+        if (it == rows.end())
+            rows.push_back({ timing.name, timing.ms, 0.0 });
+        else
+            it->gpuMs += timing.ms;
+    }
+
+    for (const Profiler::ThreadEvents& thread : Profiler::GetLastFrame())
+    {
+        if (thread.threadName != "Main")
+            continue;
+        for (const Profiler::Event& event : thread.events)
+        {
+            for (PassRow& row : rows)
+            {
+                if (strcmp(row.name, event.name) == 0)
+                    row.cpuMs += (event.end - event.start) / 1000000.0;
+            }
+        }
+    }
+
+    if (rows.empty())
+    {
+        ImGui::TextDisabled(GpuProfiler::enabled ? "Waiting for GPU results..." : "GPU timer queries disabled");
+        return;
+    }
+
+    if (ImGui::BeginTable("GpuPasses", 3, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg))
+    {
+        ImGui::TableSetupColumn("Pass");
+        ImGui::TableSetupColumn("GPU ms");
+        ImGui::TableSetupColumn("CPU ms");
+        ImGui::TableHeadersRow();
+
+        for (const PassRow& row : rows)
+        {
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn(); ImGui::TextUnformatted(row.name);
+            ImGui::TableNextColumn(); ImGui::Text("%.3f", row.gpuMs);
+            ImGui::TableNextColumn(); ImGui::Text("%.3f", row.cpuMs);
+        }
+        ImGui::EndTable();
+    }
+
+    ImGui::Text("GPU frame: %.3f ms", GpuProfiler::GetLastFrameMs());
+    if (GpuProfiler::GetDroppedFrames() > 0)
+        ImGui::TextDisabled("%u frames dropped (results not ready in time)", GpuProfiler::GetDroppedFrames());
+}
+
+namespace
+{
+    void FormatRenderStat(char* buffer, size_t size, RenderStats::Counter counter, uint64_t value)
+    {
+        if (counter == RenderStats::BUFFER_BYTES)
+            snprintf(buffer, size, "%.1f KB", value / 1024.0);
+        else
+            snprintf(buffer, size, "%llu", (unsigned long long)value);
+    }
+}
+
+void ModuleEditor::DrawRenderStatsOverlay(const ImVec2& origin)
+{
+    char text[512];
+    int length = 0;
+    for (int i = 0; i < RenderStats::COUNTER_COUNT; ++i)
+    {
+        RenderStats::Counter counter = (RenderStats::Counter)i;
+        char value[32];
+        FormatRenderStat(value, sizeof(value), counter, RenderStats::GetLast(counter));
+        length += snprintf(text + length, sizeof(text) - length, "%s%s: %s",
+            i > 0 ? "\n" : "", RenderStats::GetName(counter), value);
+    }
+
+    ImDrawList* drawList = ImGui::GetWindowDrawList();
+    ImVec2 textSize = ImGui::CalcTextSize(text);
+    ImVec2 boxMin(origin.x + 8.0f, origin.y + 8.0f);
+    ImVec2 boxMax(boxMin.x + textSize.x + 12.0f, boxMin.y + textSize.y + 8.0f);
+    drawList->AddRectFilled(boxMin, boxMax, IM_COL32(0, 0, 0, 160), 4.0f);
+    drawList->AddText(ImVec2(boxMin.x + 6.0f, boxMin.y + 4.0f), IM_COL32(255, 255, 255, 230), text);
+}
+
+void ModuleEditor::DrawRenderStatsHistory()
+{
+    for (int i = 0; i < RenderStats::COUNTER_COUNT; ++i)
+    {
+        RenderStats::Counter counter = (RenderStats::Counter)i;
+        char value[32];
+        FormatRenderStat(value, sizeof(value), counter, RenderStats::GetLast(counter));
+
+        ImGui::PlotLines(RenderStats::GetName(counter), RenderStats::GetHistory(counter), RenderStats::HistorySize,
+            RenderStats::GetHistoryOffset(), value, 0.0f, RenderStats::GetHistoryMax(counter) * 1.1f, ImVec2(0, 40));
+    }
+}
+
+namespace
+{
+    std::string ToLower(const char* text)
+    {
+        std::string lower(text);
+        for (char& c : lower)
+            c = (char)tolower((unsigned char)c);
+        return lower;
+    }
+
+    // query ya en minúsculas
+    bool ContainsIgnoreCase(const std::string& text, const std::string& query)
+    {
+        auto it = std::search(text.begin(), text.end(), query.begin(), query.end(),
+            [](char a, char b) { return (char)tolower((unsigned char)a) == b; });
+        return it != text.end();
+    }
+}
+
+void ModuleEditor::DrawConsoleWindow()
+{
+    // Calcular posición de la consola (parte inferior de la ventana)
+    ImGuiViewport* viewport = ImGui::GetMainViewport();
+    float consoleHeight = 200.0f;
+    ImVec2 consolePos = ImVec2(viewport->WorkPos.x, viewport->WorkPos.y + viewport->WorkSize.y - consoleHeight);
+    ImVec2 consoleSize = ImVec2(viewport->WorkSize.x, consoleHeight);
+
+    ImGui::SetNextWindowPos(consolePos, ImGuiCond_Always);
+    ImGui::SetNextWindowSize(consoleSize, ImGuiCond_Always);
+
+    ImGuiWindowFlags consoleFlags = ImGuiWindowFlags_NoMove | ImGuiWindowFlags_NoResize;
+
+    ImGui::Begin("Console", &show_console_window, consoleFlags);
+
+    ImGui::Checkbox("Auto-scroll", &engine_log_auto_scroll);
+    ImGui::SameLine();
+    const char* levels[] = { "Trace", "Debug", "Info", "Warning", "Error" };
+    ImGui::SetNextItemWidth(100.0f);
+    ImGui::Combo("Level", &console_min_level, levels, (int)Logger::Level::COUNT);
+    ImGui::SameLine();
+    ImGui::SetNextItemWidth(200.0f);
+    ImGui::InputTextWithHint("##ConsoleSearch", "Filter", console_search, sizeof(console_search));
+    ImGui::SameLine();
+    if (ImGui::Button("Clear"))
+        Logger::ClearHistory();
+
+    ImGui::SameLine();
+    ImGui::TextDisabled("%d lines", (int)console_lines.size());
+    if (Logger::GetDroppedCount() > 0)
+    {
+        ImGui::SameLine();
+        ImGui::TextDisabled("(%llu dropped)", (unsigned long long)Logger::GetDroppedCount());
+    }
+
+    ImGui::Separator();
+
+    const std::string query = ToLower(console_search);
+
+    ImGui::BeginChild("ConsoleRegion", ImVec2(0, 0), false, ImGuiWindowFlags_HorizontalScrollbar);
+    {
+        std::lock_guard<std::mutex> lock(Logger::GetHistoryMutex());
+        const std::deque<Logger::Line>& history = Logger::GetHistory();
+        const uint64_t base = Logger::GetHistoryBase();
+        const uint64_t end = base + history.size();
+
+        // Con otro filtro hay que volver a recorrer todo el historial
+        if (console_min_level != console_filtered_level || query != console_query)
+        {
+            console_lines.clear();
+            console_scanned = base;
+            console_filtered_level = console_min_level;
+            console_query = query;
+        }
+
+        // Las que el logger ha descartado (o Clear) salen de la vista
+        while (!console_lines.empty() && console_lines.front() < base)
+            console_lines.pop_front();
+        if (console_scanned < base)
+            console_scanned = base;
+
+        for (; console_scanned < end; ++console_scanned)
+        {
+            const Logger::Line& line = history[(size_t)(console_scanned - base)];
+            if ((int)line.level < console_min_level)
+                continue;
+            if (!query.empty() && !ContainsIgnoreCase(line.text, query))
+                continue;
+            console_lines.push_back(console_scanned);
+        }
+
+        ImGuiListClipper clipper;
+        clipper.Begin((int)console_lines.size());
+        while (clipper.Step())
+        {
+            for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; ++i)
+            {
+                const Logger::Line& line = history[(size_t)(console_lines[i] - base)];
+
+                if (line.level >= Logger::Level::ERR)
+                    ImGui::TextColored(ImVec4(1.0f, 0.4f, 0.4f, 1.0f), "%s", line.text.c_str());
+                else if (line.level == Logger::Level::WARN)
+                    ImGui::TextColored(ImVec4(1.0f, 0.8f, 0.3f, 1.0f), "%s", line.text.c_str());
+                else if (line.level <= Logger::Level::DEBUG)
+                    ImGui::TextDisabled("%s", line.text.c_str());
+                else
+                    ImGui::TextUnformatted(line.text.c_str());
+            }
+        }
+        clipper.End();
+
+        if (engine_log_auto_scroll)
+            ImGui::SetScrollHereY(1.0f);
+    }
+    ImGui::EndChild();
+
+    ImGui::End();
+}
+
+void ModuleEditor::RebuildHierarchyRows()
+{
+    hierarchy_rows.clear();
+
+    // Recorrido en profundidad con pila propia: las jerarquías muy profundas no
+    // agotan la pila. Los hijos se apilan al revés para salir en orden.
+    std::vector<HierarchyRow> stack;
+    stack.push_back({ hierarchy_root, 0 });
+    while (!stack.empty())
+    {
+        HierarchyRow row = stack.back();
+        stack.pop_back();
+        hierarchy_rows.push_back(row);
+
+        if (hierarchy_expanded.count(row.gameObject) == 0)
+            continue;
+
+        const std::vector<GameObject*>& children = row.gameObject->GetChildren();
+        for (auto it = children.rbegin(); it != children.rend(); ++it)
+        {
+            if (*it)
+                stack.push_back({ *it, row.depth + 1 });
+        }
+    }
+
+    hierarchy_rows_version = GameObject::GetHierarchyVersion();
+    hierarchy_rows_dirty = false;
+}
+
+void ModuleEditor::DrawHierarchyWindow()
+{
+    ImGuiViewport* viewport = ImGui::GetMainViewport();
+    ImVec2 hierPos = ImVec2(viewport->WorkPos.x + 10.0f, viewport->WorkPos.y + 10.0f);
+    ImGui::SetNextWindowPos(hierPos, ImGuiCond_Always);
+    ImGui::SetNextWindowSize(ImVec2(250, 400), ImGuiCond_FirstUseEver);
+    ImGuiWindowFlags hierFlags = ImGuiWindowFlags_NoMove | ImGuiWindowFlags_NoCollapse;
+
+    ImGui::Begin("Hierarchy", NULL, hierFlags);
+
+    auto& app = Application::GetInstance();
+    if (!app.moduleScene || !app.moduleScene->GetRoot())
+    {
+        ImGui::Text("ModuleScene not available");
+        ImGui::End();
+        return;
+    }
+
+    // Escena nueva (ClearScene, LoadScene): se olvida lo desplegado y la raíz empieza abierta
+    GameObject* root = app.moduleScene->GetRoot();
+    if (root != hierarchy_root)
+    {
+        hierarchy_root = root;
+        hierarchy_expanded.clear();
+        hierarchy_expanded.insert(root);
+        hierarchy_rows_dirty = true;
+    }
+
+    // Selección hecha fuera (picking en el viewport): desplegar sus padres y llevarla a la vista
+    GameObject* selected = app.moduleScene->GetSelectedGameObject();
+    if (selected != hierarchy_last_selected)
+    {
+        hierarchy_last_selected = selected;
+        if (selected)
+        {
+            for (GameObject* parent = selected->GetParent(); parent; parent = parent->GetParent())
+            {
+                if (hierarchy_expanded.insert(parent).second)
+                    hierarchy_rows_dirty = true;
+            }
+            hierarchy_scroll_to_selected = true;
+        }
+    }
+
+    ImGui::SetNextItemWidth(-1.0f);
+    ImGui::InputTextWithHint("##HierarchySearch", "Search", hierarchy_search, sizeof(hierarchy_search));
+    const std::string query = ToLower(hierarchy_search);
+
+    ImGui::BeginChild("HierarchyRows");
+
+    if (!query.empty())
+    {
+        DrawHierarchySearch(query);
+        ImGui::EndChild();
+        ImGui::End();
+        return;
+    }
+
+    if (hierarchy_rows_dirty || hierarchy_rows_version != GameObject::GetHierarchyVersion())
+        RebuildHierarchyRows();
+
+    if (hierarchy_scroll_to_selected)
+    {
+        hierarchy_scroll_to_selected = false;
+        for (size_t i = 0; i < hierarchy_rows.size(); ++i)
+        {
+            if (hierarchy_rows[i].gameObject == selected)
+            {
+                const float rowHeight = ImGui::GetTextLineHeightWithSpacing();
+                ImGui::SetScrollY(std::max(0.0f, i * rowHeight - ImGui::GetContentRegionAvail().y * 0.5f));
+                break;
+            }
+        }
+    }
+
+    const float indentSpacing = ImGui::GetStyle().IndentSpacing;
+
+    ImGuiListClipper clipper;
+    clipper.Begin((int)hierarchy_rows.size());
+    while (clipper.Step())
+    {
+        for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; ++i)
+        {
+            GameObject* go = hierarchy_rows[i].gameObject;
+            const float indent = hierarchy_rows[i].depth * indentSpacing;
+
+            // Sin TreePush: la profundidad la pone la fila, no la pila de ImGui
+            ImGuiTreeNodeFlags node_flags = ImGuiTreeNodeFlags_OpenOnArrow | ImGuiTreeNodeFlags_OpenOnDoubleClick |
+                ImGuiTreeNodeFlags_SpanAvailWidth | ImGuiTreeNodeFlags_NoTreePushOnOpen;
+            if (go->GetChildren().empty())
+                node_flags |= ImGuiTreeNodeFlags_Leaf;
+            if (go == editor_selected_gameobject || go == selected)
+                node_flags |= ImGuiTreeNodeFlags_Selected;
+
+            const bool expanded = hierarchy_expanded.count(go) > 0;
+
+            if (indent > 0.0f)
+                ImGui::Indent(indent);
+            ImGui::SetNextItemOpen(expanded);
+            const bool open = ImGui::TreeNodeEx((void*)go, node_flags, "%s", go->GetName());
+
+            if (ImGui::IsItemClicked() && !ImGui::IsItemToggledOpen())
+            {
+                editor_selected_gameobject = go;
+                hierarchy_last_selected = go;
+                app.moduleScene->SetSelectedGameObject(go);
+                PushEnginePrintf("Selected GameObject: %s", go->GetName());
+            }
+
+            if (open != expanded)
+            {
+                if (open)
+                    hierarchy_expanded.insert(go);
+                else
+                    hierarchy_expanded.erase(go);
+                hierarchy_rows_dirty = true;
+            }
+            if (indent > 0.0f)
+                ImGui::Unindent(indent);
+        }
+    }
+    clipper.End();
+
+    ImGui::EndChild();
+    ImGui::End();
+}
+
+void ModuleEditor::DrawHierarchySearch(const std::string& query)
+{
+    // El índice se rehace solo si la escena ha cambiado desde la última búsqueda
+    if (!hierarchy_index_valid || hierarchy_index_version != GameObject::GetHierarchyVersion())
+    {
+        hierarchy_index_names.clear();
+        hierarchy_index_objects.clear();
+
+        std::vector<GameObject*> stack(1, hierarchy_root);
+        while (!stack.empty())
+        {
+            GameObject* go = stack.back();
+            stack.pop_back();
+            hierarchy_index_names.push_back(ToLower(go->GetName()));
+            hierarchy_index_objects.push_back(go);
+
+            const std::vector<GameObject*>& children = go->GetChildren();
+            for (auto it = children.rbegin(); it != children.rend(); ++it)
+            {
+                if (*it)
+                    stack.push_back(*it);
+            }
+        }
+
+        hierarchy_index_version = GameObject::GetHierarchyVersion();
+        hierarchy_index_valid = true;
+        hierarchy_query.clear();
+    }
+
+    if (query != hierarchy_query)
+    {
+        // Todo lo que contiene la consulta nueva contiene la anterior: basta con
+        // filtrar los resultados que ya había
+        const bool narrowing = !hierarchy_query.empty() && query.find(hierarchy_query) != std::string::npos;
+        if (narrowing)
+        {
+            hierarchy_matches.erase(std::remove_if(hierarchy_matches.begin(), hierarchy_matches.end(),
+                [&](uint32_t index) { return hierarchy_index_names[index].find(query) == std::string::npos; }),
+                hierarchy_matches.end());
+        }
+        else
+        {
+            hierarchy_matches.clear();
+            for (uint32_t i = 0; i < (uint32_t)hierarchy_index_names.size(); ++i)
+            {
+                if (hierarchy_index_names[i].find(query) != std::string::npos)
+                    hierarchy_matches.push_back(i);
+            }
+        }
+        hierarchy_query = query;
+    }
+
+    ImGui::TextDisabled("%d matches", (int)hierarchy_matches.size());
+
+    auto& app = Application::GetInstance();
+    GameObject* selected = app.moduleScene->GetSelectedGameObject();
+
+    ImGuiListClipper clipper;
+    clipper.Begin((int)hierarchy_matches.size());
+    while (clipper.Step())
+    {
+        for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; ++i)
+        {
+            GameObject* go = hierarchy_index_objects[hierarchy_matches[i]];
+
+            ImGui::PushID((void*)go);
+            if (ImGui::Selectable(go->GetName(), go == selected))
+            {
+                editor_selected_gameobject = go;
+                app.moduleScene->SetSelectedGameObject(go);
+                PushEnginePrintf("Selected GameObject: %s", go->GetName());
+            }
+            ImGui::PopID();
+        }
+    }
+    clipper.End();
+}
+
 bool ModuleEditor::CleanUp()
 {
     // Limpiar framebuffer
     if (sceneFramebuffer) glDeleteFramebuffers(1, &sceneFramebuffer);
     if (sceneTexture) glDeleteTextures(1, &sceneTexture);
     if (sceneRBO) glDeleteRenderbuffers(1, &sceneRBO);
-    if (inspectorCheckerTex) glDeleteTextures(1, &inspectorCheckerTex);
 
     ImGui_ImplOpenGL3_Shutdown();
     ImGui_ImplSDL3_Shutdown();
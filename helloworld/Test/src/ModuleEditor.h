@@ -1,13 +1,20 @@
 #pragma once
 #include "Module.h"
 #include "imgui.h"
+#include "Profiler.h"
+#include "MemoryTracker.h"
+#include "Logger.h"
 #include <glad/glad.h>  // <-- NECESARIO para GLuint
+#include <cstdint>
+#include <deque>
 #include <string>
+#include <unordered_set>
 #include <vector>
 #include <mutex>
 
 // Forward declaration for SDL
 union SDL_Event;
+class GameObject;
 
 class ModuleEditor : public Module
 {
@@ -26,6 +33,7 @@ public:
     void HandleGizmo();
 
     // API for engine modules to report messages to the editor console
+    // (texto ya formateado; para el resto, LOG_INFO y demás de Logger.h)
     static void PushEngineLog(const std::string& msg);
     static void PushEnginePrintf(const char* fmt, ...);
 
@@ -46,7 +54,6 @@ private:
 
     // Inspector checkerboard override state
     bool inspector_show_checkerboard = false;
-    unsigned int inspectorCheckerTex = 0;
     void* inspectorOverrideTarget = nullptr;
 
     // Geometry loading menu helper
@@ -56,6 +63,26 @@ private:
     bool show_config_performance = false;
     bool show_config_modules = false;
     bool show_config_system = false;
+    bool show_gpu_memory = false;
+    bool show_memory = false;
+    bool show_profiler = false;
+
+    // Profiler: copia del frame que se muestra (congelada mientras está en pausa)
+    bool profiler_paused = false;
+    std::vector<Profiler::ThreadEvents> profiler_frame;
+    uint64_t profiler_frame_start = 0;
+    uint64_t profiler_frame_end = 0;
+
+    // Tabla de pasadas GPU/CPU de la ventana Performance
+    void DrawGpuPassTable();
+
+    // Contadores del render sobre el 3D Viewport y su historial en Performance
+    bool show_render_stats_overlay = true;
+    void DrawRenderStatsOverlay(const ImVec2& origin);
+    void DrawRenderStatsHistory();
+
+    // Memory: reservas vivas por sitio, se recalculan al pulsar Refresh
+    std::vector<MemoryTracker::SiteStats> memory_sites;
 
     // FPS history for graph
     static constexpr int FPS_HISTORY_SIZE = 120;
@@ -103,9 +130,44 @@ private:
         int texture_filter = 0; // 0 = Nearest, 1 = Linear
     } settings;
 
-    // Engine console storage (thread-safe)
-    static std::vector<std::string> engine_log;
-    static std::mutex engine_log_mutex;
-    static size_t engine_log_max_messages;
+    // Engine console: las líneas las guarda Logger
     static bool engine_log_auto_scroll;
+    int console_min_level = (int)Logger::Level::DEBUG;
+
+    // Consola: secuencias (Logger::GetHistoryBase) de las líneas que pasan los
+    // filtros; cada frame solo se examinan las líneas nuevas y se dibujan las visibles
+    char console_search[128] = "";
+    std::string console_query;
+    int console_filtered_level = -1;
+    std::deque<uint64_t> console_lines;
+    uint64_t console_scanned = 0;
+    void DrawConsoleWindow();
+
+    // Jerarquía: filas del árbol con solo los nodos desplegados. Se rehacen al
+    // cambiar la escena (GameObject::GetHierarchyVersion) o abrir/cerrar un nodo
+    struct HierarchyRow
+    {
+        GameObject* gameObject;
+        int depth;
+    };
+    std::vector<HierarchyRow> hierarchy_rows;
+    std::unordered_set<GameObject*> hierarchy_expanded;
+    GameObject* hierarchy_root = nullptr;
+    GameObject* hierarchy_last_selected = nullptr;
+    uint32_t hierarchy_rows_version = 0;
+    bool hierarchy_rows_dirty = true;
+    bool hierarchy_scroll_to_selected = false;
+    void DrawHierarchyWindow();
+    void RebuildHierarchyRows();
+
+    // Búsqueda en la jerarquía: nombres en minúsculas indexados una vez por
+    // versión; si la consulta amplía la anterior se filtran solo los resultados previos
+    char hierarchy_search[128] = "";
+    std::string hierarchy_query;
+    std::vector<std::string> hierarchy_index_names;
+    std::vector<GameObject*> hierarchy_index_objects;
+    std::vector<uint32_t> hierarchy_matches;
+    uint32_t hierarchy_index_version = 0;
+    bool hierarchy_index_valid = false;
+    void DrawHierarchySearch(const std::string& query);
 };
\ No newline at end of file
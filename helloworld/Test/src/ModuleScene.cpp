@@ -5,12 +5,22 @@
 #include "ComponentTransform.h"
 #include "ComponentMesh.h"
 #include "ComponentMaterial.h"
+#include "MeshManager.h"
+#include "MeshResource.h"
 #include "Texture.h"
 #include "OpenGL.h"
+#include "VirtualFileSystem.h"
+#include "VirtualIOSystem.h"
+#include "SceneSerializer.h"
+#include "Profiler.h"
+#include "MemoryTracker.h"
+#include "Logger.h"
 #include <assimp/Importer.hpp>
 #include <assimp/scene.h>
 #include <assimp/postprocess.h>
+#include <algorithm>
 #include <iostream>
+#include <unordered_set>
 
 
 ModuleScene::ModuleScene()
@@ -67,14 +77,8 @@ void ModuleScene::RenderScene()
     if (!app.opengl)
         return;
 
-    // 1. Dibujar el GRID primero
-    app.opengl->DrawGrid();
-
-    // 2. Dibujar todos los GameObjects con AABBs
-    if (root)
-    {
-        app.opengl->DrawGameObjectsWithAABB(root);
-    }
+    // Grid, GameObjects (con sus AABBs) y los lotes instanciados que queden en cola
+    app.opengl->DrawScene(root);
 }
 
 bool ModuleScene::CleanUp()
@@ -88,6 +92,7 @@ bool ModuleScene::CleanUp()
 
 GameObject* ModuleScene::CreateGameObject(const char* name, GameObject* parent)
 {
+    MEMORY_TAG(SCENE);
     GameObject* newGO = new GameObject(name);
 
     // Si no se especifica padre, usar el root
@@ -103,7 +108,7 @@ GameObject* ModuleScene::CreateGameObject(const char* name, GameObject* parent)
     // Aadir a la lista global
     allGameObjects.push_back(newGO);
 
-    std::cout << "[ModuleScene] Created GameObject: " << name << std::endl;
+    LOG_DEBUG(SCENE, "Created GameObject: {}", name);
 
     return newGO;
 }
@@ -113,12 +118,21 @@ void ModuleScene::DestroyGameObject(GameObject* gameObject)
     if (!gameObject || gameObject == root)
         return;
 
-    // Eliminar de la lista global
-    auto it = std::find(allGameObjects.begin(), allGameObjects.end(), gameObject);
-    if (it != allGameObjects.end())
+    // Eliminar de la lista global el objeto y todos sus descendientes
+    std::unordered_set<GameObject*> removed;
+    std::vector<GameObject*> pending(1, gameObject);
+    while (!pending.empty())
     {
-        allGameObjects.erase(it);
+        GameObject* current = pending.back();
+        pending.pop_back();
+        removed.insert(current);
+        pending.insert(pending.end(), current->GetChildren().begin(), current->GetChildren().end());
     }
+    allGameObjects.erase(std::remove_if(allGameObjects.begin(), allGameObjects.end(),
+        [&](GameObject* go) { return removed.count(go) > 0; }), allGameObjects.end());
+
+    if (removed.count(selectedGameObject) > 0)
+        selectedGameObject = nullptr;
 
     // Eliminar de su padre
     if (gameObject->GetParent())
@@ -145,6 +159,29 @@ void ModuleScene::RecursiveDelete(GameObject* go)
     delete go;
 }
 
+bool ModuleScene::SaveScene(const char* path)
+{
+    if (!root)
+        return false;
+
+    return SceneSerializer::Save(path, root);
+}
+
+bool ModuleScene::LoadScene(const char* path)
+{
+    if (!VirtualFileSystem::Exists(path))
+    {
+        LOG_ERROR(SCENE, "Scene not found: {}", path);
+        return false;
+    }
+
+    ClearScene();
+    root = new GameObject("Scene Root");
+    allGameObjects.push_back(root);
+
+    return SceneSerializer::Load(path, *this, root);
+}
+
 void ModuleScene::ClearScene()
 {
     if (selectedGameObject)
@@ -167,12 +204,15 @@ void ModuleScene::ClearScene()
     }
 
     allGameObjects.clear();
+    MeshManager::PurgeExpired();
 
     std::cout << "[ModuleScene] Scene cleared" << std::endl;
 }
 
 void ModuleScene::LoadModel(const char* path)
 {
+    PROFILE_SCOPE("Import model");
+    MEMORY_TAG(IMPORT);
     std::cout << "[ModuleScene] Loading model: " << path << std::endl;
 
     // NO borrar nada previamente: cada modelo se aade al root
@@ -185,6 +225,9 @@ void ModuleScene::LoadModel(const char* path)
     // Crear Assimp importer
     Assimp::Importer* importer = new Assimp::Importer();
 
+    // Lecturas a travs del VFS (el importer se queda con el IOSystem)
+    importer->SetIOHandler(new VirtualIOSystem());
+
     const aiScene* scene = importer->ReadFile(path,
         aiProcess_Triangulate |
         aiProcess_FlipUVs |
@@ -201,10 +244,20 @@ void ModuleScene::LoadModel(const char* path)
     std::string pathStr(path);
     std::string basePath = pathStr.substr(0, pathStr.find_last_of("/\\"));
 
+    // Mallas en paralelo (cach de Library o importacin) antes de recorrer los nodos;
+    // preloaded las mantiene vivas hasta que las recojan las ComponentMesh
+    std::vector<std::shared_ptr<MeshResource>> preloaded = MeshManager::Preload(pathStr, scene);
+
     // Cada modelo se aade al root, como nuevo GameObject
-    LoadFromAssimp(scene, scene->mRootNode, root, basePath);
+    unsigned int hitsBefore = MeshManager::GetHits();
+    LoadFromAssimp(scene, scene->mRootNode, root, basePath, pathStr);
 
-    std::cout << "[ModuleScene] Model hierarchy loaded" << std::endl;
+    // La primera referencia a una malla precargada tambin cuenta como hit
+    size_t hits = MeshManager::GetHits() - hitsBefore;
+    size_t shared = hits > preloaded.size() ? hits - preloaded.size() : 0;
+    std::cout << "[ModuleScene] Model hierarchy loaded ("
+        << scene->mNumMeshes << " unique meshes, "
+        << shared << " shared instances)" << std::endl;
 
     // IMPORTANTE: no destruir el importer hasta que termines de usar la escena
     // (o usar Assimp::Importer como variable local, no puntero)
@@ -212,8 +265,9 @@ void ModuleScene::LoadModel(const char* path)
 }
 
 
-void ModuleScene::LoadFromAssimp(const aiScene* scene, const aiNode* node, GameObject* parent, const std::string& basePath)
+void ModuleScene::LoadFromAssimp(const aiScene* scene, const aiNode* node, GameObject* parent, const std::string& basePath, const std::string& sourcePath)
 {
+    MEMORY_TAG(SCENE);
     // Crear GameObject para este nodo
     GameObject* gameObject = CreateGameObject(node->mName.C_Str(), parent);
 
@@ -234,16 +288,13 @@ void ModuleScene::LoadFromAssimp(const aiScene* scene, const aiNode* node, GameO
     transform->SetScale(scale);
     transform->SetRotation(rot);
 
-    std::cout << "[ModuleScene] Created GameObject: " << node->mName.C_Str()
-        << " with transform" << std::endl;
-
     // COMPONENTES MESH Y MATERIAL (si el nodo tiene meshes)
     for (unsigned int i = 0; i < node->mNumMeshes; i++)
     {
         unsigned int meshIndex = node->mMeshes[i];
         const aiMesh* mesh = scene->mMeshes[meshIndex];
 
-        std::cout << "[ModuleScene] - Processing mesh " << i << ": " << mesh->mName.C_Str() << std::endl;
+        LOG_DEBUG(IMPORT, "Processing mesh {}: {}", i, mesh->mName.C_Str());
 
         // Si hay mltiples meshes en un nodo, crear un hijo por cada uno
         GameObject* meshGameObject = gameObject;
@@ -259,13 +310,11 @@ void ModuleScene::LoadFromAssimp(const aiScene* scene, const aiNode* node, GameO
             subTransform->SetRotation(glm::quat(1.0f, 0.0f, 0.0f, 0.0f));
         }
 
-        // COMPONENTE MESH
+        // COMPONENTE MESH (los nodos que referencian la misma aiMesh comparten recurso)
         ComponentMesh* compMesh = (ComponentMesh*)meshGameObject->CreateComponent(ComponentType::MESH);
-        compMesh->LoadMesh(mesh);
+        compMesh->LoadMesh(mesh, sourcePath, meshIndex);
 
-        std::cout << "[ModuleScene]   - Loaded mesh with "
-            << mesh->mNumVertices << " vertices and "
-            << mesh->mNumFaces << " faces" << std::endl;
+        LOG_DEBUG(IMPORT, "  Loaded mesh with {} vertices and {} faces", mesh->mNumVertices, mesh->mNumFaces);
 
         // COMPONENTE MATERIAL (textura)
         ComponentMaterial* compMaterial = (ComponentMaterial*)meshGameObject->CreateComponent(ComponentType::MATERIAL);
@@ -284,40 +333,32 @@ void ModuleScene::LoadFromAssimp(const aiScene* scene, const aiNode* node, GameO
                 aiString texPath;
                 if (material->GetTexture(aiTextureType_DIFFUSE, 0, &texPath) == AI_SUCCESS)
                 {
-                    // Construir path completo
-                    std::string fullPath = basePath + "/" + std::string(texPath.C_Str());
+                    // Relativa al modelo o, si no, el archivo con ese nombre ms cercano en el ndice del VFS
+                    std::string fullPath = VirtualFileSystem::Locate(texPath.C_Str(), basePath);
+                    if (fullPath.empty())
+                        fullPath = basePath + "/" + std::string(texPath.C_Str());
 
-                    std::cout << "[ModuleScene]   - Loading texture: " << fullPath << std::endl;
+                    LOG_DEBUG(IMPORT, "  Loading texture: {}", fullPath);
                     compMaterial->LoadTexture(fullPath.c_str());
-
-                    // Path alternativo (solo el nombre del archivo, por si est en otra carpeta)
-                    std::string fileName = texPath.C_Str();
-                    size_t lastSlash = fileName.find_last_of("/\\");
-                    if (lastSlash != std::string::npos)
-                    {
-                        fileName = fileName.substr(lastSlash + 1);
-                        std::string altPath = basePath + "/" + fileName;
-                        std::cout << "[ModuleScene]   - Alternative path: " << altPath << std::endl;
-                    }
                 }
             }
             else
             {
-                std::cout << "[ModuleScene]   - No texture found, using checkerboard" << std::endl;
+                LOG_DEBUG(IMPORT, "  No texture found, using checkerboard");
             }
             
             
         }
         else
         {
-            std::cout << "[ModuleScene]   - Invalid material index, using checkerboard" << std::endl;
+            LOG_WARN(IMPORT, "  Invalid material index, using checkerboard");
         }
     }
 
     // RECURSIN: Procesar todos los hijos del nodo
     for (unsigned int i = 0; i < node->mNumChildren; i++)
     {
-        LoadFromAssimp(scene, node->mChildren[i], gameObject, basePath);
+        LoadFromAssimp(scene, node->mChildren[i], gameObject, basePath, sourcePath);
     }
 }
 
@@ -10,6 +10,8 @@ struct aiNode;
 
 class ModuleScene : public Module
 {
+    friend class SceneSerializer;
+
 private:
     GameObject* root;
     GameObject* selectedGameObject; // Para el inspector
@@ -36,6 +38,10 @@ public:
     // Carga desde Assimp (modelo 3D)
     void LoadModel(const char* path);
 
+    // Escena binaria (SceneSerializer): LoadScene reemplaza la escena actual
+    bool SaveScene(const char* path);
+    bool LoadScene(const char* path);
+
     // Limpia toda la escena
     void ClearScene();
 
@@ -53,7 +59,7 @@ public:
     void UpdateAllAABBs();
 
 private:
-    void LoadFromAssimp(const aiScene* scene, const aiNode* node, GameObject* parent, const std::string& basePath);
+    void LoadFromAssimp(const aiScene* scene, const aiNode* node, GameObject* parent, const std::string& basePath, const std::string& sourcePath);
     void RecursiveDelete(GameObject* go);
     void CollectRaycastCandidates(GameObject* go, const Ray& ray, std::vector<RayHit>& candidates);
 };
\ No newline at end of file
@@ -8,9 +8,19 @@
 #include "ComponentTransform.h"
 #include "ComponentMesh.h"
 #include "ComponentMaterial.h"
+#include "TextureManager.h"
+#include "TextureResource.h"
+#include "TextureStreamer.h"
+#include "ResidencyManager.h"
+#include "TextureArrayPool.h"
+#include "MeshResource.h"
+#include "Profiler.h"
+#include "GpuProfiler.h"
+#include "RenderStats.h"
+#include "MemoryTracker.h"
+#include "Logger.h"
 #include <SDL3/SDL.h>
 #include <glad/glad.h>
-#include <iostream>
 #include <IL/il.h>
 #include <IL/ilu.h>
 #include <glm/glm.hpp>
@@ -18,10 +28,28 @@
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/quaternion.hpp>
 #include <vector>
-#include <set>
+#include <algorithm>
+
+#if defined(ENGINE_MEMORY_TRACKING)
+namespace
+{
+    void* ILAPIENTRY DevILAllocate(const ILsizei size)
+    {
+        MemoryTracker::Scope scope(MemoryTracker::Tag::TEXTURE, "DevIL");
+        return MemoryTracker::Allocate((size_t)size);
+    }
+
+    void ILAPIENTRY DevILFree(const void* CONST_RESTRICT ptr)
+    {
+        MemoryTracker::Free(const_cast<void*>(ptr));
+    }
+}
+#endif
+
+std::atomic<bool> OpenGL::redrawRequested(true);
 
 OpenGL::OpenGL()
-    : glContext(nullptr), shader(nullptr), debugShader(nullptr), gridShader(nullptr),
+    : glContext(nullptr), shader(nullptr), debugShader(nullptr), batchShader(nullptr), gridShader(nullptr),
     fbxModel(nullptr), rotationAngle(0.0f), texture(0),
     gridVAO(0), gridVBO(0), gridLineCount(0), showGrid(true),
     currentGeometry(nullptr), isGeometryActive(false) {
@@ -31,6 +59,7 @@ OpenGL::~OpenGL()
 {
     if (shader) delete shader;
     if (debugShader) delete debugShader;
+    if (batchShader) delete batchShader;
     if (gridShader) delete gridShader;
     if (fbxModel) delete fbxModel;
     if (currentGeometry) {
@@ -77,7 +106,7 @@ void OpenGL::CreateGrid(int size)
 
     glBindVertexArray(0);
 
-    std::cout << "Grid created with " << (size * 2 + 1) * 2 << " lines" << std::endl;
+    LOG_DEBUG(RENDER, "Grid created with {} lines", (size * 2 + 1) * 2);
 }
 
 void OpenGL::DrawGrid()
@@ -98,9 +127,12 @@ void OpenGL::DrawGrid()
 
     glm::vec3 gridColor(0.5f, 0.5f, 0.5f);
     glUniform3fv(glGetUniformLocation(gridShader->ID, "gridColor"), 1, glm::value_ptr(gridColor));
+    RenderStats::CountUniforms(4);
 
     glBindVertexArray(gridVAO);
     glDrawArrays(GL_LINES, 0, gridLineCount);
+    RenderStats::CountVAOBind();
+    RenderStats::CountDraw(GL_LINES, gridLineCount);
     glBindVertexArray(0);
 }
 
@@ -145,6 +177,9 @@ void OpenGL::DrawGameObjects(GameObject* go)
             glBindTexture(GL_TEXTURE_2D, texture);
         }
 
+        ApplyLOD(mesh, modelMatrix, projection);
+        RequestTextureMips(material, mesh, modelMatrix, projection);
+        mesh->ApplyVertexFormatUniforms(shader->ID);
         mesh->Draw();
 
         if (app.moduleScene && app.moduleScene->GetDebugShowNormals())
@@ -199,14 +234,13 @@ void OpenGL::LoadGeometry(const std::string& type) {
         *currentGeometry = GeometryGenerator::CreatePlane(5.0f, 5.0f);
     }
 
+    currentGeometry->SetupMesh();
     isGeometryActive = true;
 
-    if (texture) {
-        glDeleteTextures(1, &texture);
-    }
-    texture = Texture::CreateCheckerboardTexture(512, 512, 32);
+    // Checkerboard compartido del gestor (no se borra aqu)
+    texture = TextureManager::GetDefault()->GetID();
 
-    std::cout << "Loaded geometry: " << type << std::endl;
+    LOG_DEBUG(RENDER, "Loaded geometry: {}", type);
 }
 
 bool OpenGL::Start()
@@ -216,7 +250,7 @@ bool OpenGL::Start()
 
     if (!gladLoadGLLoader((GLADloadproc)SDL_GL_GetProcAddress))
     {
-        std::cerr << "Failed to initialize GLAD" << std::endl;
+        LOG_ERROR(RENDER, "Failed to initialize GLAD");
         return false;
     }
 
@@ -225,26 +259,13 @@ bool OpenGL::Start()
     glCullFace(GL_BACK);
     glFrontFace(GL_CCW);
 
+#if defined(ENGINE_MEMORY_TRACKING)
+    // DevIL reserva con malloc dentro de su DLL: se le pasa el tracker para que las imgenes cuenten como texturas
+    ilSetMemory(DevILAllocate, DevILFree);
+#endif
     ilInit();
     iluInit();
 
-    glGenFramebuffers(1, &sceneFBO);
-    glBindFramebuffer(GL_FRAMEBUFFER, sceneFBO);
-
-    glGenTextures(1, &sceneTexture);
-    glBindTexture(GL_TEXTURE_2D, sceneTexture);
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, sceneWidth, sceneHeight, 0, GL_RGB, GL_UNSIGNED_BYTE, NULL);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-
-    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, sceneTexture, 0);
-
-    glGenRenderbuffers(1, &sceneRBO);
-    glBindRenderbuffer(GL_RENDERBUFFER, sceneRBO);
-    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, sceneWidth, sceneHeight);
-    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, sceneRBO);
-
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
 
 
     const char* vertexShaderSource = R"(
@@ -258,10 +279,22 @@ bool OpenGL::Start()
         uniform mat4 model;
         uniform mat4 view;
         uniform mat4 projection;
+        uniform vec3 posOffset;
+        uniform vec3 posScale;
+        uniform bool octNormals;
+        vec3 OctDecode(vec2 e)
+        {
+            vec3 n = vec3(e, 1.0 - abs(e.x) - abs(e.y));
+            if (n.z < 0.0)
+                n.xy = (1.0 - abs(n.yx)) * vec2(n.x >= 0.0 ? 1.0 : -1.0, n.y >= 0.0 ? 1.0 : -1.0);
+            return normalize(n);
+        }
         void main()
         {
-            FragPos = vec3(model * vec4(aPos, 1.0));
-            Normal = mat3(transpose(inverse(model))) * aNormal;
+            vec3 pos = posOffset + aPos * posScale;
+            vec3 nrm = octNormals ? OctDecode(aNormal.xy) : aNormal;
+            FragPos = vec3(model * vec4(pos, 1.0));
+            Normal = mat3(transpose(inverse(model))) * nrm;
             TexCoord = aTexCoord;
             gl_Position = projection * view * vec4(FragPos, 1.0);
         }
@@ -299,6 +332,12 @@ bool OpenGL::Start()
 
     shader = new Shader(vertexShaderSource, fragmentShaderSource);
 
+    // Valores por defecto del formato de vrtice: floats sin cuantizar
+    shader->use();
+    glUniform3f(glGetUniformLocation(shader->ID, "posOffset"), 0.0f, 0.0f, 0.0f);
+    glUniform3f(glGetUniformLocation(shader->ID, "posScale"), 1.0f, 1.0f, 1.0f);
+    glUniform1i(glGetUniformLocation(shader->ID, "octNormals"), 0);
+
     const char* debugVert = R"(
         #version 330 core
         layout(location = 0) in vec3 aPos;
@@ -319,6 +358,72 @@ bool OpenGL::Start()
     )";
     debugShader = new Shader(debugVert, debugFrag);
 
+    // Mismo sombreado que el principal, con modelo y capa del array por instancia
+    const char* batchVert = R"(
+        #version 330 core
+        layout (location = 0) in vec3 aPos;
+        layout (location = 1) in vec3 aNormal;
+        layout (location = 2) in vec2 aTexCoord;
+        layout (location = 4) in mat4 aModel;
+        layout (location = 8) in float aLayer;
+        out vec3 TexCoord;
+        out vec3 Normal;
+        out vec3 FragPos;
+        uniform mat4 view;
+        uniform mat4 projection;
+        uniform vec3 posOffset;
+        uniform vec3 posScale;
+        uniform bool octNormals;
+        vec3 OctDecode(vec2 e)
+        {
+            vec3 n = vec3(e, 1.0 - abs(e.x) - abs(e.y));
+            if (n.z < 0.0)
+                n.xy = (1.0 - abs(n.yx)) * vec2(n.x >= 0.0 ? 1.0 : -1.0, n.y >= 0.0 ? 1.0 : -1.0);
+            return normalize(n);
+        }
+        void main()
+        {
+            vec3 pos = posOffset + aPos * posScale;
+            vec3 nrm = octNormals ? OctDecode(aNormal.xy) : aNormal;
+            FragPos = vec3(aModel * vec4(pos, 1.0));
+            Normal = mat3(transpose(inverse(aModel))) * nrm;
+            TexCoord = vec3(aTexCoord, aLayer);
+            gl_Position = projection * view * vec4(FragPos, 1.0);
+        }
+    )";
+    const char* batchFrag = R"(
+        #version 330 core
+        out vec4 FragColor;
+        in vec3 TexCoord;
+        in vec3 Normal;
+        in vec3 FragPos;
+        uniform sampler2DArray texture_array;
+        uniform vec3 lightPos;
+        uniform vec3 viewPos;
+        uniform vec3 lightColor;
+        void main()
+        {
+            float ambientStrength = 0.3;
+            vec3 ambient = ambientStrength * lightColor;
+            vec3 norm = normalize(Normal);
+            vec3 lightDir = normalize(lightPos - FragPos);
+            float diff = max(dot(norm, lightDir), 0.0);
+            vec3 diffuse = diff * lightColor;
+            float specularStrength = 0.5;
+            vec3 viewDir = normalize(viewPos - FragPos);
+            vec3 reflectDir = reflect(-lightDir, norm);
+            float spec = pow(max(dot(viewDir, reflectDir), 0.0), 32);
+            vec3 specular = specularStrength * spec * lightColor;
+            vec4 texColor = texture(texture_array, TexCoord);
+            if(texColor.a < 0.1) texColor = vec4(1.0);
+            vec3 result = (ambient + diffuse + specular) * vec3(texColor);
+            FragColor = vec4(result, 1.0);
+        }
+    )";
+    batchShader = new Shader(batchVert, batchFrag);
+    batchShader->use();
+    glUniform1i(glGetUniformLocation(batchShader->ID, "texture_array"), 0);
+
     const char* gridVert = R"(
         #version 330 core
         layout(location = 0) in vec3 aPos;
@@ -348,7 +453,7 @@ bool OpenGL::Start()
         GameObject* root = app.moduleScene->GetRoot();
         if (!root)
         {
-            std::cerr << "ERROR: Root GameObject is null!" << std::endl;
+            LOG_ERROR(SCENE, "Root GameObject is null");
             return false;
         }
 
@@ -366,11 +471,8 @@ bool OpenGL::Start()
 
             }
             // Cargar textura y aplicarla
-            GLuint bakerTexture = Texture::LoadTexture("../Assets/Textures/Baker_house.png");
-            if (!bakerTexture)
-                bakerTexture = Texture::CreateCheckerboardTexture(512, 512, 32);
-
-            ApplyTextureToGameObjects(bakerHouse, bakerTexture, "../Assets/Textures/Baker_house.png");
+            std::shared_ptr<TextureResource> bakerTexture = TextureManager::LoadAsync("../Assets/Textures/Baker_house.png");
+            ApplyTextureToGameObjects(bakerHouse, bakerTexture);
 
             // Seleccionar el GameObject
             app.moduleScene->SetSelectedGameObject(bakerHouse);
@@ -395,32 +497,196 @@ bool OpenGL::Start()
 
 bool OpenGL::PreUpdate()
 {
+    // Los frames en reposo no cuentan: estadsticas y tiempos de GPU se quedan con
+    // los del ltimo frame que dibuj la escena
+    if (sceneDrawnThisFrame)
+        RenderStats::NextFrame();
+    else
+        RenderStats::DiscardFrame();
+    sceneDrawnLastFrame = sceneDrawnThisFrame;
+    sceneDrawnThisFrame = false;
+
+    // Recoge las queries de GPU de hace unos frames y prepara las de este
+    GpuProfiler::BeginFrame();
+
+    // Sube por PBO la parte que toque de las texturas que se estn cargando
+    {
+        PROFILE_SCOPE("Texture uploads");
+        TextureManager::Update();
+    }
+
+    // Streaming y residencia cuentan frames desde el ltimo uso: solo avanzan en los
+    // frames que han dibujado la escena, o en reposo lo visible acabara expulsado
+    if (sceneDrawnLastFrame)
+    {
+        {
+            PROFILE_SCOPE("Texture streaming");
+            TextureStreamer::Update();
+        }
+
+        // Si la VRAM registrada pasa del budget, expulsar lo que lleva ms tiempo sin dibujarse
+        PROFILE_SCOPE("Residency");
+        ResidencyManager::Update();
+    }
+
     glClearColor(0.1f, 0.1f, 0.15f, 1.0f);
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
     return true;
 }
 
-// Funcin auxiliar para recolectar todas las texturas en uso
-void OpenGL::CollectTexturesInUse(GameObject* go, std::set<GLuint>& texturesInUse)
+// Planos del frustum sacados de las filas de la matriz view-projection (Gribb-Hartmann):
+// el AABB queda fuera si su esquina ms adelantada respecto a algn plano est detrs de l
+bool OpenGL::IsInFrustum(const AABB& worldAABB, const glm::mat4& viewProjection) const
 {
-    if (!go) return;
+    if (!worldAABB.IsValid())
+        return true;
+
+    glm::mat4 rows = glm::transpose(viewProjection);
+    const glm::vec4 planes[6] = {
+        rows[3] + rows[0], rows[3] - rows[0],   // izquierda, derecha
+        rows[3] + rows[1], rows[3] - rows[1],   // abajo, arriba
+        rows[3] + rows[2], rows[3] - rows[2]    // cerca, lejos
+    };
 
-    ComponentMaterial* material = go->GetComponent<ComponentMaterial>();
-    if (material)
+    for (const glm::vec4& plane : planes)
     {
-        GLuint texID = material->GetTextureID();
-        if (texID != 0)
-        {
-            texturesInUse.insert(texID);
-        }
+        glm::vec3 corner(
+            plane.x >= 0.0f ? worldAABB.max.x : worldAABB.min.x,
+            plane.y >= 0.0f ? worldAABB.max.y : worldAABB.min.y,
+            plane.z >= 0.0f ? worldAABB.max.z : worldAABB.min.z);
+
+        if (glm::dot(glm::vec3(plane), corner) + plane.w < 0.0f)
+            return false;
     }
+    return true;
+}
 
-    for (GameObject* child : go->GetChildren())
+// Fraccin de la media altura de pantalla que ocupa la esfera envolvente del AABB
+float OpenGL::ComputeScreenCoverage(const AABB& worldAABB, const glm::mat4& projection) const
+{
+    if (!worldAABB.IsValid())
+        return 1.0f;
+
+    glm::vec3 cameraPos = Application::GetInstance().camera->getPosition();
+    float radius = worldAABB.GetRadius();
+    float distance = glm::length(worldAABB.GetCenter() - cameraPos);
+
+    // Cmara dentro de la esfera: detalle mximo
+    if (distance <= radius)
+        return 1.0f;
+
+    // projection[1][1] = 1 / tan(fov / 2)
+    return radius * projection[1][1] / distance;
+}
+
+void OpenGL::ApplyLOD(ComponentMesh* mesh, const glm::mat4& modelMatrix, const glm::mat4& projection)
+{
+    if (!mesh)
+        return;
+
+    if (enableLOD && mesh->GetLODCount() > 1)
+    {
+        AABB worldAABB = mesh->GetLocalAABB().Transform(modelMatrix);
+        mesh->SelectLOD(ComputeScreenCoverage(worldAABB, projection), lodHysteresis);
+    }
+    else
     {
-        CollectTexturesInUse(child, texturesInUse);
+        mesh->SetCurrentLOD(0);
     }
+
+    int lod = mesh->GetCurrentLOD();
+    lodStats.trianglesDrawn += mesh->GetLODTriangleCount(lod);
+    lodStats.trianglesFullDetail += mesh->GetLODTriangleCount(0);
+    if (lod > 0)
+        lodStats.meshesReduced++;
+}
+
+// Tamao en pantalla del objeto -> mip que necesita su textura
+void OpenGL::RequestTextureMips(ComponentMaterial* material, ComponentMesh* mesh, const glm::mat4& modelMatrix, const glm::mat4& projection)
+{
+    if (!material || !mesh || !TextureStreamer::enabled || !material->GetTexture())
+        return;
+
+    // La cobertura es respecto a media pantalla: el dimetro en pxeles es coverage * alto
+    AABB worldAABB = mesh->GetLocalAABB().Transform(modelMatrix);
+    float pixels = ComputeScreenCoverage(worldAABB, projection) * (float)sceneHeight;
+    TextureStreamer::RequestSize(material->GetTexture().get(), pixels);
 }
 
+void OpenGL::FlushBatches()
+{
+    PROFILE_GPU_SCOPE("Batches");
+    if (batchQueue.empty() || !batchShader)
+    {
+        batchQueue.clear();
+        return;
+    }
+
+    // Juntar las instancias que comparten array, malla y LOD
+    std::sort(batchQueue.begin(), batchQueue.end(), [](const BatchItem& a, const BatchItem& b)
+    {
+        if (a.textureArray != b.textureArray)
+            return a.textureArray < b.textureArray;
+        if (a.mesh != b.mesh)
+            return a.mesh < b.mesh;
+        return a.lod < b.lod;
+    });
+
+    batchShader->use();
+    UploadPassUniforms(batchShader);
+
+    if (instanceVBO == 0)
+        glGenBuffers(1, &instanceVBO);
+
+    glActiveTexture(GL_TEXTURE0);
+    std::vector<MeshInstanceData> instances;
+    size_t start = 0;
+    while (start < batchQueue.size())
+    {
+        const BatchItem& first = batchQueue[start];
+        size_t end = start;
+        instances.clear();
+        while (end < batchQueue.size() && batchQueue[end].textureArray == first.textureArray
+            && batchQueue[end].mesh == first.mesh && batchQueue[end].lod == first.lod)
+        {
+            MeshInstanceData instance;
+            instance.Model = batchQueue[end].model;
+            instance.TextureLayer = batchQueue[end].layer;
+            instances.push_back(instance);
+            end++;
+        }
+
+        // Buffer hurfano en cada grupo: no hay que esperar a que la GPU acabe con el anterior
+        glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
+        glBufferData(GL_ARRAY_BUFFER, instances.size() * sizeof(MeshInstanceData), instances.data(), GL_STREAM_DRAW);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        RenderStats::CountBufferUpload(instances.size() * sizeof(MeshInstanceData));
+
+        glBindTexture(GL_TEXTURE_2D_ARRAY, first.textureArray);
+        RenderStats::CountTextureBind();
+        first.mesh->ApplyVertexFormatUniforms(batchShader->ID);
+        first.mesh->DrawInstanced(first.lod, instanceVBO, (GLsizei)instances.size());
+
+        batchStats.draws++;
+        batchStats.instances += (unsigned int)instances.size();
+        start = end;
+    }
+
+    glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+    batchQueue.clear();
+}
+
+void OpenGL::UploadPassUniforms(Shader* program)
+{
+    glUniformMatrix4fv(glGetUniformLocation(program->ID, "view"), 1, GL_FALSE, glm::value_ptr(passUniforms.view));
+    glUniformMatrix4fv(glGetUniformLocation(program->ID, "projection"), 1, GL_FALSE, glm::value_ptr(passUniforms.projection));
+    glUniform3fv(glGetUniformLocation(program->ID, "lightPos"), 1, glm::value_ptr(passUniforms.lightPos));
+    glUniform3fv(glGetUniformLocation(program->ID, "viewPos"), 1, glm::value_ptr(passUniforms.viewPos));
+    glUniform3fv(glGetUniformLocation(program->ID, "lightColor"), 1, glm::value_ptr(passUniforms.lightColor));
+    RenderStats::CountUniforms(5);
+}
+
+
 bool OpenGL::Update()
 {
     Application& app = Application::GetInstance();
@@ -428,6 +694,7 @@ bool OpenGL::Update()
     // Manejo de drag & drop
     if (!app.input->droppedFiles.empty())
     {
+        PROFILE_SCOPE("Dropped files");
         for (const std::string& filePath : app.input->droppedFiles)
         {
             std::string ext = filePath.substr(filePath.find_last_of('.') + 1);
@@ -437,11 +704,11 @@ bool OpenGL::Update()
             {
                 try
                 {
-                    ModuleEditor::PushEnginePrintf("=== LOADING MODEL: ");
+                    LOG_INFO(IMPORT, "Loading dropped model: {}", filePath);
 
                     if (!app.moduleScene)
                     {
-                        std::cerr << "ERROR: moduleScene is null!" << std::endl;
+                        LOG_ERROR(SCENE, "Dropped model ignored: no scene module");
                         continue;
                     }
 
@@ -450,14 +717,14 @@ bool OpenGL::Update()
                     GameObject* root = app.moduleScene->GetRoot();
                     if (!root || root->GetChildren().empty())
                     {
-                        std::cerr << "ERROR: Failed to get root or no children after loading!" << std::endl;
+                        LOG_ERROR(IMPORT, "Dropped model produced no objects: {}", filePath);
                         continue;
                     }
 
                     GameObject* newModel = root->GetChildren().back();
                     if (!newModel)
                     {
-                        std::cerr << "ERROR: newModel is null!" << std::endl;
+                        LOG_ERROR(IMPORT, "Dropped model produced a null object: {}", filePath);
                         continue;
                     }
 
@@ -465,202 +732,194 @@ bool OpenGL::Update()
                     if (transform)
                     {
                         transform->SetScale(glm::vec3(0.01f));
-                        std::cout << "Applied scale and rotation to new model." << std::endl;
                     }
 
                     app.moduleScene->SetSelectedGameObject(newModel);
-                    std::cout << "New model auto-selected: " << newModel->GetName() << std::endl;
+                    LOG_DEBUG(SCENE, "New model auto-selected: {}", newModel->GetName());
 
                 }
                 catch (const std::exception& e)
                 {
-                    std::cerr << "EXCEPTION loading 3D model: " << e.what() << std::endl;
+                    LOG_ERROR(IMPORT, "Exception loading model {}: {}", filePath, e.what());
                 }
                 catch (...)
                 {
-                    std::cerr << "UNKNOWN EXCEPTION loading 3D model: " << filePath << std::endl;
+                    LOG_ERROR(IMPORT, "Unknown exception loading model {}", filePath);
                 }
             }
-            else if (ext == "jpg" || ext == "png" || ext == "tga" || ext == "bmp" || ext == "dds")
+            else if (ext == "jpg" || ext == "png" || ext == "tga" || ext == "bmp" || ext == "dds" || ext == "ktx2")
             {
                 try
                 {
-                    std::cout << "=== LOADING TEXTURE: " << filePath << " ===" << std::endl;
-
-                    GLuint newTex = (ext == "dds") ?
-                        Texture::LoadDDSTexture(filePath.c_str()) :
-                        Texture::LoadTexture(filePath.c_str());
+                    LOG_INFO(IMPORT, "Loading dropped texture: {}", filePath);
 
-                    if (!newTex || !glIsTexture(newTex))
+                    std::shared_ptr<TextureResource> newTex = TextureManager::LoadAsync(filePath);
+                    if (newTex == TextureManager::GetDefault())
                     {
-                        std::cerr << "ERROR: Failed to load texture: " << filePath << std::endl;
+                        LOG_ERROR(TEXTURE, "Failed to load texture: {}", filePath);
                         continue;
                     }
 
-                    std::set<GLuint> texturesInUse;
-                    GameObject* root = app.moduleScene->GetRoot();
-                    if (root)
-                        CollectTexturesInUse(root, texturesInUse);
-
+                    // Las texturas que dejen de usarse se liberan al soltar su ltima referencia
                     GameObject* selected = app.moduleScene->GetSelectedGameObject();
                     if (selected)
                     {
-                        ApplyTextureToGameObjects(selected, newTex, filePath.c_str());
-                        std::cout << "Texture applied to selected object: " << selected->GetName() << std::endl;
+                        ApplyTextureToGameObjects(selected, newTex);
+                        LOG_DEBUG(TEXTURE, "Texture applied to selected object: {}", selected->GetName());
                     }
-
-                    std::set<GLuint> newTexturesInUse;
-                    if (root)
-                        CollectTexturesInUse(root, newTexturesInUse);
-
-                    for (GLuint oldTex : texturesInUse)
-                    {
-                        if (newTexturesInUse.find(oldTex) == newTexturesInUse.end() &&
-                            oldTex != texture &&
-                            oldTex != newTex &&
-                            glIsTexture(oldTex))
-                        {
-                            std::cout << "Deleting unused texture: " << oldTex << std::endl;
-                            glDeleteTextures(1, &oldTex);
-                        }
-                    }
-
-                    std::cout << "=== TEXTURE LOADING COMPLETE ===" << std::endl;
                 }
                 catch (const std::exception& e)
                 {
-                    std::cerr << "EXCEPTION loading texture: " << e.what() << std::endl;
+                    LOG_ERROR(TEXTURE, "Exception loading texture {}: {}", filePath, e.what());
                 }
                 catch (...)
                 {
-                    std::cerr << "UNKNOWN EXCEPTION loading texture: " << filePath << std::endl;
+                    LOG_ERROR(TEXTURE, "Unknown exception loading texture {}", filePath);
                 }
             }
             else
             {
-                std::cout << "Unsupported file format: " << filePath << std::endl;
+                LOG_WARN(IMPORT, "Unsupported file format: {}", filePath);
             }
         }
 
         app.input->droppedFiles.clear();
     }
 
-    glBindFramebuffer(GL_FRAMEBUFFER, sceneFBO);
-    glViewport(0, 0, sceneWidth, sceneHeight);
-
-    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-
-    DrawGrid();
-
-    GameObject* root = nullptr;
-    if (app.moduleScene)
-        root = app.moduleScene->GetRoot();
-
-    if (root)
-        DrawGameObjectsWithAABB(root);
-
+    return true;
+}
 
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+bool OpenGL::HasPendingWork() const
+{
+    return TextureManager::GetPendingCount() > 0;
+}
 
-    // Draw Grid
-    DrawGrid();
+bool OpenGL::NeedsSceneRedraw(int width, int height)
+{
+    Application& app = Application::GetInstance();
+    sceneWidth = width;
+    sceneHeight = height;
+
+    SceneSignature signature;
+    signature.view = app.camera->getViewMatrix();
+    signature.projection = app.camera->getProjectionMatrix();
+    signature.width = width;
+    signature.height = height;
+    signature.selected = app.moduleScene ? app.moduleScene->GetSelectedGameObject() : nullptr;
+    signature.hierarchyVersion = GameObject::GetHierarchyVersion();
+    signature.transformVersion = ComponentTransform::GetChangeVersion();
+    signature.materialVersion = ComponentMaterial::GetChangeVersion();
+    signature.pendingTextures = TextureManager::GetPendingCount();
+    signature.streamedBytes = TextureStreamer::GetResidentBytes();
+    signature.evictions = ResidencyManager::GetEvictionCount();
+
+    const bool changed = signature.view != lastSignature.view || signature.projection != lastSignature.projection ||
+        signature.width != lastSignature.width || signature.height != lastSignature.height ||
+        signature.selected != lastSignature.selected ||
+        signature.hierarchyVersion != lastSignature.hierarchyVersion ||
+        signature.transformVersion != lastSignature.transformVersion ||
+        signature.materialVersion != lastSignature.materialVersion ||
+        signature.pendingTextures != lastSignature.pendingTextures ||
+        signature.streamedBytes != lastSignature.streamedBytes || signature.evictions != lastSignature.evictions;
+
+    lastSignature = signature;
+
+    const bool requested = redrawRequested.exchange(false);
+    return !renderOnDemand || changed || requested;
+}
 
-    if (!shader) return true;
+void OpenGL::DrawScene(GameObject* root)
+{
+    lodStats = LODStats();
+    batchStats = BatchStats();
+    sceneDrawnThisFrame = true;
+    GpuProfiler::MarkSceneFrame();
 
-    if (isGeometryActive && currentGeometry)
     {
-        shader->use();
-
-        glm::mat4 modelMatrix = glm::mat4(1.0f);
-        modelMatrix = glm::rotate(modelMatrix, rotationAngle, glm::vec3(0, 1, 0));
-
-        glm::mat4 view = app.camera->getViewMatrix();
-        glm::mat4 projection = app.camera->getProjectionMatrix();
-
-        glUniformMatrix4fv(glGetUniformLocation(shader->ID, "model"), 1, GL_FALSE, glm::value_ptr(modelMatrix));
-        glUniformMatrix4fv(glGetUniformLocation(shader->ID, "view"), 1, GL_FALSE, glm::value_ptr(view));
-        glUniformMatrix4fv(glGetUniformLocation(shader->ID, "projection"), 1, GL_FALSE, glm::value_ptr(projection));
-
-        glm::vec3 lightPos(2.0f, 2.0f, 2.0f);
-        glm::vec3 viewPos = app.camera->getPosition();
-        glm::vec3 lightColor(1.0f);
-
-        glUniform3fv(glGetUniformLocation(shader->ID, "lightPos"), 1, glm::value_ptr(lightPos));
-        glUniform3fv(glGetUniformLocation(shader->ID, "viewPos"), 1, glm::value_ptr(viewPos));
-        glUniform3fv(glGetUniformLocation(shader->ID, "lightColor"), 1, glm::value_ptr(lightColor));
-
-        glActiveTexture(GL_TEXTURE0);
-        glBindTexture(GL_TEXTURE_2D, texture);
-        currentGeometry->Draw();
+        PROFILE_GPU_SCOPE("Grid");
+        DrawGrid();
     }
-    else
+
+    if (root)
     {
-        GameObject* root = app.moduleScene->GetRoot();
-        if (root)
+        Application& app = Application::GetInstance();
+        passUniforms.view = app.camera->getViewMatrix();
+        passUniforms.projection = app.camera->getProjectionMatrix();
+        passUniforms.viewPos = app.camera->getPosition();
+        sceneShaderReady = false;
+
+        {
+            PROFILE_GPU_SCOPE("Scene objects");
             DrawGameObjectsWithAABB(root);
+        }
+        FlushBatches();
+        FlushAABBs();
     }
-
-    return true;
 }
 
-void OpenGL::ApplyTextureToGameObjects(GameObject* go, GLuint texID, const char* path)
+void OpenGL::ApplyTextureToGameObjects(GameObject* go, const std::shared_ptr<TextureResource>& tex)
 {
     if (!go)
     {
-        std::cout << "ApplyTextureToGameObjects: GameObject is null" << std::endl;
+        LOG_WARN(RENDER, "ApplyTextureToGameObjects: GameObject is null");
         return;
     }
 
     try
     {
-        std::cout << "Applying texture to GameObject: " << go->GetName() << std::endl;
-
-        if (!glIsTexture(texID))
+        if (!tex)
         {
-            std::cerr << "ERROR: Invalid texture ID: " << texID << std::endl;
+            LOG_ERROR(RENDER, "ApplyTextureToGameObjects: invalid texture for {}", go->GetName());
             return;
         }
 
         ComponentMaterial* material = go->GetComponent<ComponentMaterial>();
         if (material)
-        {
-            std::cout << "  - Setting texture on ComponentMaterial..." << std::endl;
-            material->SetTexture(texID, path);
-            std::cout << "  - Texture set successfully" << std::endl;
-        }
+            material->SetTexture(tex);
 
         const std::vector<GameObject*>& children = go->GetChildren();
-        std::cout << "  - Processing " << children.size() << " children" << std::endl;
+        LOG_TRACE(RENDER, "Texture applied to {} ({} children)", go->GetName(), children.size());
 
         for (size_t i = 0; i < children.size(); ++i)
         {
             GameObject* child = children[i];
             if (child)
             {
-                ApplyTextureToGameObjects(child, texID, path);
+                ApplyTextureToGameObjects(child, tex);
             }
             else
             {
-                std::cerr << "WARNING: Child " << i << " is null!" << std::endl;
+                LOG_WARN(RENDER, "ApplyTextureToGameObjects: child {} of {} is null", i, go->GetName());
             }
         }
     }
     catch (const std::exception& e)
     {
-        std::cerr << "EXCEPTION in ApplyTextureToGameObjects: " << e.what() << std::endl;
+        LOG_ERROR(RENDER, "Exception in ApplyTextureToGameObjects: {}", e.what());
     }
     catch (...)
     {
-        std::cerr << "UNKNOWN EXCEPTION in ApplyTextureToGameObjects" << std::endl;
+        LOG_ERROR(RENDER, "Unknown exception in ApplyTextureToGameObjects");
     }
 }
 
 bool OpenGL::CleanUp()
 {
-    std::cout << "Cleaning up OpenGL resources..." << std::endl;
+    LOG_DEBUG(RENDER, "Cleaning up OpenGL resources");
 
     Application::GetInstance().moduleScene->CleanUp();
 
+    GpuProfiler::Shutdown();
+
+    // Sin materiales vivos ya solo queda el checkerboard por defecto
+    TextureManager::Clear();
+    TextureArrayPool::Clear();
+
+    if (instanceVBO) {
+        glDeleteBuffers(1, &instanceVBO);
+        instanceVBO = 0;
+    }
+
     if (currentGeometry) {
         currentGeometry->Cleanup();
         delete currentGeometry;
@@ -676,11 +935,7 @@ bool OpenGL::CleanUp()
         gridVAO = 0;
     }
 
-    if (texture && glIsTexture(texture))
-    {
-        glDeleteTextures(1, &texture);
-        texture = 0;
-    }
+    texture = 0;
 
     if (shader)
     {
@@ -694,6 +949,12 @@ bool OpenGL::CleanUp()
         debugShader = nullptr;
     }
 
+    if (batchShader)
+    {
+        delete batchShader;
+        batchShader = nullptr;
+    }
+
     if (gridShader)
     {
         delete gridShader;
@@ -715,7 +976,7 @@ bool OpenGL::CleanUp()
         aabbVAO = 0;
     }
 
-    std::cout << "OpenGL cleanup complete" << std::endl;
+    LOG_DEBUG(RENDER, "OpenGL cleanup complete");
     return true;
 }
 
@@ -782,12 +1043,27 @@ void OpenGL::DrawAABB(const AABB& aabb, const glm::vec3& color)
     glUniformMatrix4fv(glGetUniformLocation(debugShader->ID, "view"), 1, GL_FALSE, glm::value_ptr(view));
     glUniformMatrix4fv(glGetUniformLocation(debugShader->ID, "projection"), 1, GL_FALSE, glm::value_ptr(projection));
     glUniform3fv(glGetUniformLocation(debugShader->ID, "color"), 1, glm::value_ptr(color));
+    RenderStats::CountUniforms(4);
 
     glBindVertexArray(aabbVAO);
     glDrawArrays(GL_LINES, 0, 24);
+    RenderStats::CountVAOBind();
+    RenderStats::CountDraw(GL_LINES, 24);
     glBindVertexArray(0);
 }
 
+void OpenGL::FlushAABBs()
+{
+    if (aabbQueue.empty())
+        return;
+
+    PROFILE_GPU_SCOPE("AABB debug");
+    for (const AABBItem& item : aabbQueue)
+        DrawAABB(item.aabb, item.color);
+
+    aabbQueue.clear();
+}
+
 void OpenGL::DrawGameObjectsWithAABB(GameObject* go)
 {
     if (!go || !go->IsActive())
@@ -798,46 +1074,76 @@ void OpenGL::DrawGameObjectsWithAABB(GameObject* go)
     ComponentMesh* mesh = go->GetComponent<ComponentMesh>();
     ComponentMaterial* material = go->GetComponent<ComponentMaterial>();
 
-    if (mesh && transform)
-    {
-        shader->use();
+    const glm::mat4& view = passUniforms.view;
+    const glm::mat4& projection = passUniforms.projection;
 
-        Application& app = Application::GetInstance();
+    // Fuera de la cmara: ni se dibuja ni pide LOD o mips (los hijos se comprueban por separado)
+    bool culled = false;
+    if (mesh && transform && enableFrustumCulling)
+    {
+        AABB worldAABB = mesh->GetLocalAABB().Transform(transform->GetGlobalMatrix());
+        culled = !IsInFrustum(worldAABB, projection * view);
+        if (culled)
+            RenderStats::CountCulled();
+    }
 
+    if (mesh && transform && !culled)
+    {
         glm::mat4 modelMatrix = transform->GetGlobalMatrix();
-        glm::mat4 view = app.camera->getViewMatrix();
-        glm::mat4 projection = app.camera->getProjectionMatrix();
 
-        glUniformMatrix4fv(glGetUniformLocation(shader->ID, "model"), 1, GL_FALSE, glm::value_ptr(modelMatrix));
-        glUniformMatrix4fv(glGetUniformLocation(shader->ID, "view"), 1, GL_FALSE, glm::value_ptr(view));
-        glUniformMatrix4fv(glGetUniformLocation(shader->ID, "projection"), 1, GL_FALSE, glm::value_ptr(projection));
-
-        glm::vec3 lightPos(2.0f, 2.0f, 2.0f);
-        glm::vec3 viewPos = app.camera->getPosition();
-        glm::vec3 lightColor(1.0f);
+        ApplyLOD(mesh, modelMatrix, projection);
+        RequestTextureMips(material, mesh, modelMatrix, projection);
 
-        glUniform3fv(glGetUniformLocation(shader->ID, "lightPos"), 1, glm::value_ptr(lightPos));
-        glUniform3fv(glGetUniformLocation(shader->ID, "viewPos"), 1, glm::value_ptr(viewPos));
-        glUniform3fv(glGetUniformLocation(shader->ID, "lightColor"), 1, glm::value_ptr(lightColor));
-
-        if (material)
-            material->Bind();
-        else
+        // Con la textura en un array, se dibuja al final junto al resto de objetos con la misma malla
+        const TextureArrayLayer* layer = material ? material->GetArrayLayer() : nullptr;
+        if (layer && mesh->GetResource())
         {
-            glActiveTexture(GL_TEXTURE0);
-            glBindTexture(GL_TEXTURE_2D, texture);
+            BatchItem item;
+            item.textureArray = layer->GetArray();
+            item.mesh = mesh->GetResource().get();
+            item.lod = mesh->GetCurrentLOD();
+            item.layer = (float)layer->GetLayer();
+            item.model = modelMatrix;
+            batchQueue.push_back(item);
+
+            // Se dibuja la copia del array, pero el uso cuenta para la textura original:
+            // sin esto el LRU la vera sin usar y la expulsara (o no la recargara)
+            material->GetTexture()->MarkUsed();
         }
+        else
+        {
+            // El programa y los uniforms de la pasada se preparan con el primer objeto que no va en lote
+            if (!sceneShaderReady)
+            {
+                shader->use();
+                UploadPassUniforms(shader);
+                sceneShaderReady = true;
+            }
+            glUniformMatrix4fv(glGetUniformLocation(shader->ID, "model"), 1, GL_FALSE, glm::value_ptr(modelMatrix));
+            RenderStats::CountUniforms();
 
-        mesh->Draw();
+            if (material)
+                material->Bind();
+            else
+            {
+                glActiveTexture(GL_TEXTURE0);
+                glBindTexture(GL_TEXTURE_2D, texture);
+                RenderStats::CountTextureBind();
+            }
 
-        // Dibujar AABB si est habilitado
+            mesh->ApplyVertexFormatUniforms(shader->ID);
+            mesh->Draw();
+        }
+
+        // Los AABB se dibujan despus, en su propia pasada
         if (showAABBs)
         {
-            glm::vec3 aabbColor = (go == Application::GetInstance().moduleScene->GetSelectedGameObject())
+            AABBItem item;
+            item.aabb = go->GetAABB();
+            item.color = (go == Application::GetInstance().moduleScene->GetSelectedGameObject())
                 ? glm::vec3(1.0f, 1.0f, 0.0f)  // Amarillo para seleccionado
                 : glm::vec3(0.0f, 1.0f, 0.0f);  // Verde para el resto
-
-            DrawAABB(go->GetAABB(), aabbColor);
+            aabbQueue.push_back(item);
         }
     }
 
@@ -1,9 +1,10 @@
 #pragma once
 #include "Module.h"
 #include "Shader.h"
+#include <atomic>
 #include <string>
 #include <vector>
-#include <set>
+#include <memory>
 #include <iostream>
 #include <glm/glm.hpp>
 #include "AABB.h" 
@@ -11,6 +12,10 @@
 class Model;
 class MeshGeometry;
 class GameObject;
+class ComponentMesh;
+class ComponentMaterial;
+class TextureResource;
+class MeshResource;
 
 class OpenGL : public Module
 {
@@ -18,6 +23,7 @@ private:
     void* glContext;
     Shader* shader;
     Shader* debugShader; // shader para debug (normales)
+    Shader* batchShader; // dibujado agrupado por instancias con GL_TEXTURE_2D_ARRAY
     Model* fbxModel;
 
     glm::mat4 modelMatrix;
@@ -25,7 +31,7 @@ private:
     glm::mat4 projection;
     float rotationAngle;
 
-    unsigned int texture;
+    unsigned int texture; // checkerboard compartido de TextureManager (no propio)
 
     // Grid
     unsigned int gridVAO;
@@ -41,15 +47,76 @@ private:
 
     // NUEVAS FUNCIONES PARA GAMEOBJECTS
     void DrawGameObjects(GameObject* go);
-    void ApplyTextureToGameObjects(GameObject* go, GLuint texID, const char* path);
+    void ApplyTextureToGameObjects(GameObject* go, const std::shared_ptr<TextureResource>& tex);
 
     GLuint aabbVAO = 0;
     GLuint aabbVBO = 0;
     void CreateAABBBuffers();
 
-    GLuint sceneFBO, sceneTexture, sceneRBO;
+    // Tamao del framebuffer de la escena (lo fija NeedsSceneRedraw)
     int sceneWidth = 1280, sceneHeight = 720;
 
+    // Render bajo demanda: lo que se vio en el ltimo dibujado de la escena
+    struct SceneSignature
+    {
+        glm::mat4 view = glm::mat4(0.0f);
+        glm::mat4 projection = glm::mat4(0.0f);
+        int width = 0;
+        int height = 0;
+        GameObject* selected = nullptr;
+        uint32_t hierarchyVersion = 0;
+        uint32_t transformVersion = 0;
+        uint32_t materialVersion = 0;
+        size_t pendingTextures = 0;
+        size_t streamedBytes = 0;
+        unsigned int evictions = 0;
+    } lastSignature;
+    bool sceneDrawnLastFrame = true;
+    bool sceneDrawnThisFrame = false;
+    static std::atomic<bool> redrawRequested;
+
+    float ComputeScreenCoverage(const AABB& worldAABB, const glm::mat4& projection) const;
+    bool IsInFrustum(const AABB& worldAABB, const glm::mat4& viewProjection) const;
+    void ApplyLOD(ComponentMesh* mesh, const glm::mat4& modelMatrix, const glm::mat4& projection);
+    void RequestTextureMips(ComponentMaterial* material, ComponentMesh* mesh, const glm::mat4& modelMatrix, const glm::mat4& projection);
+
+    // Objetos cuya textura est en un TextureArrayPool: se dibujan al final,
+    // una llamada por (array, malla, LOD) con la capa de cada uno por instancia
+    struct BatchItem
+    {
+        GLuint textureArray = 0;
+        MeshResource* mesh = nullptr;
+        int lod = 0;
+        float layer = 0.0f;
+        glm::mat4 model = glm::mat4(1.0f);
+    };
+    std::vector<BatchItem> batchQueue;
+    GLuint instanceVBO = 0;
+    void FlushBatches();
+
+    // Cmara y luz de la pasada de escena: se calculan una vez en DrawScene y se
+    // suben una vez por programa. Por objeto solo cambia "model", y los que van
+    // en lote ni eso (su matriz viaja en el buffer de instancias)
+    struct PassUniforms
+    {
+        glm::mat4 view = glm::mat4(1.0f);
+        glm::mat4 projection = glm::mat4(1.0f);
+        glm::vec3 lightPos = glm::vec3(2.0f, 2.0f, 2.0f);
+        glm::vec3 viewPos = glm::vec3(0.0f);
+        glm::vec3 lightColor = glm::vec3(1.0f);
+    } passUniforms;
+    bool sceneShaderReady = false;
+    void UploadPassUniforms(Shader* program);
+
+    // AABB de depuracin: se acumulan al recorrer la escena y se dibujan en una pasada aparte
+    struct AABBItem
+    {
+        AABB aabb;
+        glm::vec3 color = glm::vec3(0.0f, 1.0f, 0.0f);
+    };
+    std::vector<AABBItem> aabbQueue;
+    void FlushAABBs();
+
 public:
     OpenGL();
     ~OpenGL();
@@ -63,12 +130,46 @@ public:
 
     void LoadGeometry(const std::string& type);
 
-    void CollectTexturesInUse(GameObject* go, std::set<GLuint>& texturesInUse);
 
     // Variables pblicas para debug
     bool showAABBs = false;
     bool showGrid = true;
 
+    // Seleccin de LOD por tamao en pantalla
+    bool enableLOD = true;
+    float lodHysteresis = 0.15f;
+
+    // Descartar los objetos cuyo AABB queda fuera de la cmara
+    bool enableFrustumCulling = true;
+
+    // Solo se vuelve a dibujar la escena cuando cambia algo visible (cmara,
+    // escena, seleccin, tamao del viewport, texturas cargndose o un cambio en
+    // el editor pedido con RequestRedraw); si no, el viewport conserva la imagen
+    bool renderOnDemand = true;
+    static void RequestRedraw() { redrawRequested = true; }
+    bool NeedsSceneRedraw(int width, int height);
+    bool DrewSceneRecently() const { return sceneDrawnThisFrame || sceneDrawnLastFrame; }
+    // Cargas asncronas en curso: el bucle no debe dormirse mucho
+    bool HasPendingWork() const;
+
+    // Grid, objetos, lotes instanciados y AABBs al framebuffer enlazado
+    void DrawScene(GameObject* root);
+
+    // Estadsticas de LOD del ltimo dibujado de la escena (se reinician en DrawScene)
+    struct LODStats
+    {
+        unsigned int trianglesDrawn = 0;
+        unsigned int trianglesFullDetail = 0;
+        unsigned int meshesReduced = 0;
+    } lodStats;
+
+    // Dibujado agrupado del ltimo dibujado de la escena
+    struct BatchStats
+    {
+        unsigned int draws = 0;
+        unsigned int instances = 0;
+    } batchStats;
+
     // Getters para el editor
     bool IsGridVisible() const { return showGrid; }
     void SetGridVisible(bool visible) { showGrid = visible; }
@@ -0,0 +1,209 @@
+#include "Profiler.h"
+#include "FileUtils.h"
+#include "Logger.h"
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+
+std::atomic<bool> Profiler::enabled(true);
+
+std::mutex Profiler::registryMutex;
+std::vector<std::unique_ptr<Profiler::ThreadBuffer>> Profiler::buffers;
+std::vector<Profiler::ThreadEvents> Profiler::lastFrame;
+std::vector<Profiler::CapturedEvent> Profiler::captured;
+uint64_t Profiler::frameStart = 0;
+uint64_t Profiler::lastFrameStart = 0;
+uint64_t Profiler::lastFrameEnd = 0;
+std::atomic<uint64_t> Profiler::droppedEvents(0);
+bool Profiler::capturing = false;
+
+namespace
+{
+    // Límite de la captura (~64 MB de eventos); al llegar se detiene sola
+    const size_t MaxCapturedEvents = 2 * 1024 * 1024;
+
+    const std::chrono::steady_clock::time_point ProfilerEpoch = std::chrono::steady_clock::now();
+
+    void WriteEscaped(std::ostream& out, const char* text)
+    {
+        for (const char* c = text; *c; ++c)
+        {
+            if (*c == '"' || *c == '\\')
+                out << '\\';
+            out << *c;
+        }
+    }
+}
+
+uint64_t Profiler::Now()
+{
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - ProfilerEpoch).count();
+}
+
+Profiler::ThreadBuffer* Profiler::GetThreadBuffer()
+{
+    thread_local ThreadBuffer* buffer = nullptr;
+    if (!buffer)
+    {
+        std::lock_guard<std::mutex> lock(registryMutex);
+        buffers.emplace_back(new ThreadBuffer());
+        buffer = buffers.back().get();
+        buffer->threadId = (uint32_t)buffers.size();
+        buffer->threadName = "Thread " + std::to_string(buffer->threadId);
+    }
+    return buffer;
+}
+
+void Profiler::SetThreadName(const char* name)
+{
+    ThreadBuffer* buffer = GetThreadBuffer();
+    std::lock_guard<std::mutex> lock(registryMutex);
+    buffer->threadName = name;
+}
+
+void Profiler::Scope::Begin(const char* scopeName)
+{
+    name = scopeName;
+    start = Now();
+    GetThreadBuffer()->depth++;
+}
+
+void Profiler::Scope::End()
+{
+    ThreadBuffer* buffer = GetThreadBuffer();
+    buffer->depth--;
+
+    Event event;
+    event.name = name;
+    event.start = start;
+    event.end = Now();
+    event.depth = buffer->depth;
+    Push(*buffer, event);
+}
+
+void Profiler::Push(ThreadBuffer& buffer, const Event& event)
+{
+    const uint32_t write = buffer.writeIndex.load(std::memory_order_relaxed);
+    const uint32_t read = buffer.readIndex.load(std::memory_order_acquire);
+
+    // Lleno: el hilo principal no ha recogido a tiempo (p. ej. una carga muy larga)
+    if (write - read >= ThreadBuffer::Capacity)
+    {
+        droppedEvents.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    buffer.events[write % ThreadBuffer::Capacity] = event;
+    buffer.writeIndex.store(write + 1, std::memory_order_release);
+}
+
+void Profiler::BeginFrame()
+{
+    frameStart = Now();
+}
+
+void Profiler::EndFrame()
+{
+    const uint64_t frameEnd = Now();
+
+    std::lock_guard<std::mutex> lock(registryMutex);
+    lastFrame.resize(buffers.size());
+
+    for (size_t i = 0; i < buffers.size(); ++i)
+    {
+        ThreadBuffer& buffer = *buffers[i];
+        ThreadEvents& thread = lastFrame[i];
+        thread.threadId = buffer.threadId;
+        thread.threadName = buffer.threadName;
+        thread.events.clear();
+
+        const uint32_t read = buffer.readIndex.load(std::memory_order_relaxed);
+        const uint32_t write = buffer.writeIndex.load(std::memory_order_acquire);
+        for (uint32_t index = read; index != write; ++index)
+        {
+            const Event& event = buffer.events[index % ThreadBuffer::Capacity];
+            thread.events.push_back(event);
+
+            if (capturing)
+            {
+                CapturedEvent entry;
+                entry.event = event;
+                entry.threadId = buffer.threadId;
+                captured.push_back(entry);
+            }
+        }
+        buffer.readIndex.store(write, std::memory_order_release);
+    }
+
+    lastFrameStart = frameStart;
+    lastFrameEnd = frameEnd;
+
+    if (capturing && captured.size() >= MaxCapturedEvents)
+    {
+        capturing = false;
+        LOG_WARN(ENGINE, "Profiler capture stopped: event limit reached");
+    }
+}
+
+void Profiler::StartCapture()
+{
+    captured.clear();
+    capturing = true;
+}
+
+void Profiler::StopCapture()
+{
+    capturing = false;
+}
+
+bool Profiler::ExportChromeTrace(const std::string& path)
+{
+    size_t slash = path.find_last_of("/\\");
+    if (slash != std::string::npos)
+        FileUtils::CreateDirectories(path.substr(0, slash));
+
+    std::ofstream file(path, std::ios::trunc);
+    if (!file)
+    {
+        LOG_ERROR(ENGINE, "Profiler could not write {}", path);
+        return false;
+    }
+
+    // Formato "JSON Object" de Trace Event: eventos completos (ph X) en microsegundos
+    file << "{\"traceEvents\":[\n";
+    bool first = true;
+    {
+        std::lock_guard<std::mutex> lock(registryMutex);
+        for (const std::unique_ptr<ThreadBuffer>& buffer : buffers)
+        {
+            file << (first ? "" : ",\n") << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":"
+                << buffer->threadId << ",\"args\":{\"name\":\"";
+            WriteEscaped(file, buffer->threadName.c_str());
+            file << "\"}}";
+            first = false;
+        }
+    }
+
+    char timing[64];
+    for (const CapturedEvent& entry : captured)
+    {
+        snprintf(timing, sizeof(timing), "\"ts\":%.3f,\"dur\":%.3f",
+            entry.event.start / 1000.0, (entry.event.end - entry.event.start) / 1000.0);
+
+        file << (first ? "" : ",\n") << "{\"name\":\"";
+        WriteEscaped(file, entry.event.name);
+        file << "\",\"cat\":\"engine\",\"ph\":\"X\"," << timing << ",\"pid\":1,\"tid\":" << entry.threadId << "}";
+        first = false;
+    }
+    file << "\n]}\n";
+
+    if (!file)
+    {
+        LOG_ERROR(ENGINE, "Profiler could not write {}", path);
+        return false;
+    }
+
+    LOG_INFO(ENGINE, "Profiler exported {} events to {}", captured.size(), path);
+    return true;
+}
@@ -0,0 +1,125 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Profiler de CPU por scopes. Cada hilo escribe sus eventos en su propio buffer
+// circular (un productor, un consumidor, sin locks); el hilo principal los
+// recoge al acabar cada frame para el flame graph del editor y, mientras se
+// captura, para exportarlos como traza de Chrome (chrome://tracing, Perfetto).
+//
+// Los nombres deben vivir toda la ejecución (literales o module->name).
+// Sin ENGINE_PROFILER las macros no generan código; con él, un scope cuesta
+// una comprobación de Profiler::enabled cuando está desactivado.
+class Profiler
+{
+public:
+    struct Event
+    {
+        const char* name = nullptr;
+        uint64_t start = 0;         // ns desde el arranque del profiler
+        uint64_t end = 0;
+        uint32_t depth = 0;
+    };
+
+    struct ThreadEvents
+    {
+        uint32_t threadId = 0;
+        std::string threadName;
+        std::vector<Event> events;
+    };
+
+    static std::atomic<bool> enabled;
+
+    // Nombre del hilo actual en el editor y en la traza
+    static void SetThreadName(const char* name);
+
+    static void BeginFrame();
+    static void EndFrame();
+
+    // Eventos del último frame completo, agrupados por hilo
+    static const std::vector<ThreadEvents>& GetLastFrame() { return lastFrame; }
+    static uint64_t GetLastFrameStart() { return lastFrameStart; }
+    static uint64_t GetLastFrameEnd() { return lastFrameEnd; }
+    static uint64_t GetDroppedEvents() { return droppedEvents; }
+
+    // Captura de varios frames para la traza
+    static void StartCapture();
+    static void StopCapture();
+    static bool IsCapturing() { return capturing; }
+    static size_t GetCapturedEventCount() { return captured.size(); }
+    static bool ExportChromeTrace(const std::string& path);
+
+    static uint64_t Now();
+
+    class Scope
+    {
+    public:
+        explicit Scope(const char* name)
+        {
+            if (enabled.load(std::memory_order_relaxed))
+                Begin(name);
+        }
+        ~Scope()
+        {
+            if (name)
+                End();
+        }
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        void Begin(const char* scopeName);
+        void End();
+
+        const char* name = nullptr;
+        uint64_t start = 0;
+    };
+
+private:
+    // Buffer de un hilo: solo él escribe (writeIndex) y solo EndFrame lee (readIndex)
+    struct ThreadBuffer
+    {
+        static const uint32_t Capacity = 1 << 14;
+
+        Event events[Capacity];
+        std::atomic<uint32_t> writeIndex{ 0 };
+        std::atomic<uint32_t> readIndex{ 0 };
+        uint32_t threadId = 0;
+        uint32_t depth = 0;
+        std::string threadName;
+    };
+
+    struct CapturedEvent
+    {
+        Event event;
+        uint32_t threadId;
+    };
+
+    static ThreadBuffer* GetThreadBuffer();
+    static void Push(ThreadBuffer& buffer, const Event& event);
+
+    static std::mutex registryMutex;                        // solo al registrar hilos o renombrarlos
+    static std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+    static std::vector<ThreadEvents> lastFrame;
+    static std::vector<CapturedEvent> captured;
+    static uint64_t frameStart;
+    static uint64_t lastFrameStart;
+    static uint64_t lastFrameEnd;
+    static std::atomic<uint64_t> droppedEvents;
+    static bool capturing;
+};
+
+#if defined(ENGINE_PROFILER)
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+#define PROFILE_SCOPE(name) Profiler::Scope PROFILE_CONCAT(profileScope_, __LINE__)(name)
+#define PROFILE_FUNCTION() PROFILE_SCOPE(__FUNCTION__)
+#else
+#define PROFILE_SCOPE(name) ((void)0)
+#define PROFILE_FUNCTION() ((void)0)
+#endif
@@ -0,0 +1,51 @@
+#include "RenderStats.h"
+
+uint64_t RenderStats::current[RenderStats::COUNTER_COUNT] = {};
+uint64_t RenderStats::last[RenderStats::COUNTER_COUNT] = {};
+float RenderStats::history[RenderStats::COUNTER_COUNT][RenderStats::HistorySize] = {};
+int RenderStats::historyPos = 0;
+
+void RenderStats::NextFrame()
+{
+    for (int i = 0; i < COUNTER_COUNT; ++i)
+    {
+        last[i] = current[i];
+        history[i][historyPos] = (float)current[i];
+        current[i] = 0;
+    }
+    historyPos = (historyPos + 1) % HistorySize;
+}
+
+void RenderStats::DiscardFrame()
+{
+    for (int i = 0; i < COUNTER_COUNT; ++i)
+        current[i] = 0;
+}
+
+const char* RenderStats::GetName(Counter counter)
+{
+    switch (counter)
+    {
+    case DRAW_CALLS: return "Draw calls";
+    case TRIANGLES: return "Triangles";
+    case VERTICES: return "Vertices";
+    case PROGRAM_BINDS: return "Program binds";
+    case TEXTURE_BINDS: return "Texture binds";
+    case VAO_BINDS: return "VAO binds";
+    case UNIFORM_UPLOADS: return "Uniform uploads";
+    case BUFFER_BYTES: return "Buffer bytes";
+    case CULLED_OBJECTS: return "Culled objects";
+    default: return "Unknown";
+    }
+}
+
+float RenderStats::GetHistoryMax(Counter counter)
+{
+    float maxValue = 1.0f;
+    for (int i = 0; i < HistorySize; ++i)
+    {
+        if (history[counter][i] > maxValue)
+            maxValue = history[counter][i];
+    }
+    return maxValue;
+}
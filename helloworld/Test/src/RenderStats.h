@@ -0,0 +1,63 @@
+#pragma once
+#include <glad/glad.h>
+#include <cstddef>
+#include <cstdint>
+
+// Contadores del render por frame. Se incrementan donde se hace la llamada GL
+// (Shader, IndexBuffer, MeshResource, OpenGL...) y OpenGL::PreUpdate cierra el
+// frame anterior con NextFrame: el editor muestra siempre un frame completo.
+// Los frames en reposo (sin dibujar la escena) se descartan con DiscardFrame, así
+// que mientras no se redibuja se sigue viendo el último frame dibujado.
+// Solo se usan desde el hilo principal, que es el único con contexto GL.
+class RenderStats
+{
+public:
+    enum Counter
+    {
+        DRAW_CALLS,
+        TRIANGLES,
+        VERTICES,
+        PROGRAM_BINDS,
+        TEXTURE_BINDS,
+        VAO_BINDS,
+        UNIFORM_UPLOADS,
+        BUFFER_BYTES,
+        CULLED_OBJECTS,
+        COUNTER_COUNT
+    };
+
+    static const int HistorySize = 120;
+
+    static void CountDraw(GLenum mode, GLsizei count, GLsizei instances = 1)
+    {
+        current[DRAW_CALLS]++;
+        current[VERTICES] += (uint64_t)count * instances;
+        if (mode == GL_TRIANGLES)
+            current[TRIANGLES] += (uint64_t)(count / 3) * instances;
+    }
+    static void CountProgramBind() { current[PROGRAM_BINDS]++; }
+    static void CountTextureBind() { current[TEXTURE_BINDS]++; }
+    static void CountVAOBind() { current[VAO_BINDS]++; }
+    static void CountUniforms(unsigned int count = 1) { current[UNIFORM_UPLOADS] += count; }
+    static void CountBufferUpload(size_t bytes) { current[BUFFER_BYTES] += bytes; }
+    static void CountCulled() { current[CULLED_OBJECTS]++; }
+
+    // Guarda el frame en curso como último frame y en el historial, y empieza otro
+    static void NextFrame();
+    // Tira lo contado en el frame en curso sin tocar el último frame ni el historial
+    static void DiscardFrame();
+
+    static uint64_t GetLast(Counter counter) { return last[counter]; }
+    static const char* GetName(Counter counter);
+
+    // Historial circular para ImGui::PlotLines (values_offset = GetHistoryOffset())
+    static const float* GetHistory(Counter counter) { return history[counter]; }
+    static int GetHistoryOffset() { return historyPos; }
+    static float GetHistoryMax(Counter counter);
+
+private:
+    static uint64_t current[COUNTER_COUNT];
+    static uint64_t last[COUNTER_COUNT];
+    static float history[COUNTER_COUNT][HistorySize];
+    static int historyPos;
+};
@@ -0,0 +1,114 @@
+#include "ResidencyManager.h"
+#include "Logger.h"
+#include <algorithm>
+#include <vector>
+
+bool ResidencyManager::enforceBudget = true;
+size_t ResidencyManager::budgetBytes = 1024ull * 1024 * 1024;
+unsigned int ResidencyManager::minIdleFrames = 60;
+
+std::map<ResidencyManager::Handle, ResidencyManager::Allocation> ResidencyManager::allocations;
+ResidencyManager::Handle ResidencyManager::nextHandle = 1;
+size_t ResidencyManager::totalBytes = 0;
+size_t ResidencyManager::categoryBytes[(int)ResidencyManager::Category::COUNT] = {};
+unsigned int ResidencyManager::evictionCount = 0;
+uint64_t ResidencyManager::frame = 0;
+
+ResidencyManager::Handle ResidencyManager::Register(Category category, const std::string& owner, size_t bytes, Evictable* evictable)
+{
+    Handle handle = nextHandle++;
+
+    Allocation& allocation = allocations[handle];
+    allocation.category = category;
+    allocation.owner = owner;
+    allocation.bytes = bytes;
+    allocation.lastUsedFrame = frame;
+    allocation.evictable = evictable;
+
+    totalBytes += bytes;
+    categoryBytes[(int)category] += bytes;
+    return handle;
+}
+
+void ResidencyManager::Unregister(Handle handle)
+{
+    auto it = allocations.find(handle);
+    if (it == allocations.end())
+        return;
+
+    totalBytes -= it->second.bytes;
+    categoryBytes[(int)it->second.category] -= it->second.bytes;
+    allocations.erase(it);
+}
+
+void ResidencyManager::Resize(Handle handle, size_t bytes)
+{
+    auto it = allocations.find(handle);
+    if (it == allocations.end())
+        return;
+
+    Allocation& allocation = it->second;
+    totalBytes = totalBytes - allocation.bytes + bytes;
+    categoryBytes[(int)allocation.category] = categoryBytes[(int)allocation.category] - allocation.bytes + bytes;
+    allocation.bytes = bytes;
+}
+
+void ResidencyManager::Touch(Handle handle)
+{
+    auto it = allocations.find(handle);
+    if (it != allocations.end())
+        it->second.lastUsedFrame = frame;
+}
+
+void ResidencyManager::Update()
+{
+    frame++;
+
+    if (!enforceBudget || totalBytes <= budgetBytes)
+        return;
+
+    // Candidatos: residentes, expulsables y sin usar en los últimos minIdleFrames
+    std::vector<Handle> candidates;
+    for (const auto& pair : allocations)
+    {
+        const Allocation& allocation = pair.second;
+        if (allocation.evictable && allocation.bytes > 0 && allocation.lastUsedFrame + minIdleFrames < frame)
+            candidates.push_back(pair.first);
+    }
+
+    // Los menos usados primero
+    std::sort(candidates.begin(), candidates.end(), [](Handle a, Handle b)
+    {
+        return allocations[a].lastUsedFrame < allocations[b].lastUsedFrame;
+    });
+
+    for (Handle handle : candidates)
+    {
+        if (totalBytes <= budgetBytes)
+            break;
+
+        // El recurso actualiza su tamaño con Resize al expulsarse
+        auto it = allocations.find(handle);
+        if (it == allocations.end())
+            continue;
+
+        Allocation& allocation = it->second;
+        size_t before = allocation.bytes;
+        if (allocation.evictable->EvictFromGPU())
+        {
+            allocation.evictions++;
+            evictionCount++;
+            LOG_DEBUG(RENDER, "Evicted {} ({} KB)", allocation.owner, before / 1024);
+        }
+    }
+}
+
+const char* ResidencyManager::GetCategoryName(Category category)
+{
+    switch (category)
+    {
+    case Category::MESH: return "Mesh";
+    case Category::TEXTURE: return "Texture";
+    default: return "Other";
+    }
+}
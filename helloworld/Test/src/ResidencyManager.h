@@ -0,0 +1,67 @@
+#pragma once
+#include <map>
+#include <string>
+#include <cstdint>
+
+// Contabilidad de VRAM: cada buffer/textura se registra con su dueño y tamaño.
+// Si el total pasa del budget se expulsan los recursos dibujados hace más
+// tiempo; vuelven a cargarse desde su copia en disco cuando se vuelven a usar.
+class ResidencyManager
+{
+public:
+    enum class Category { MESH, TEXTURE, COUNT };
+
+    // Recursos que pueden salir de la VRAM
+    class Evictable
+    {
+    public:
+        virtual ~Evictable() = default;
+
+        // Libera la memoria de GPU dejando lo necesario para restaurarse al
+        // volver a usarse. Devuelve false si no se pudo (p. ej. sin copia en disco).
+        virtual bool EvictFromGPU() = 0;
+    };
+
+    using Handle = unsigned int;
+
+    struct Allocation
+    {
+        Category category = Category::MESH;
+        std::string owner;
+        size_t bytes = 0;
+        uint64_t lastUsedFrame = 0;
+        unsigned int evictions = 0;
+        Evictable* evictable = nullptr;
+    };
+
+    static bool enforceBudget;
+    static size_t budgetBytes;
+    static unsigned int minIdleFrames;  // nunca se expulsa lo usado hace menos frames
+
+    static Handle Register(Category category, const std::string& owner, size_t bytes, Evictable* evictable = nullptr);
+    static void Unregister(Handle handle);
+
+    // Cambia el tamaño registrado (0 = expulsado, sigue en la lista)
+    static void Resize(Handle handle, size_t bytes);
+
+    // Marca el recurso como usado en el frame actual
+    static void Touch(Handle handle);
+
+    // Una vez por frame: avanza el contador y expulsa por LRU si hace falta
+    static void Update();
+
+    static size_t GetTotalBytes() { return totalBytes; }
+    static size_t GetCategoryBytes(Category category) { return categoryBytes[(int)category]; }
+    static unsigned int GetEvictionCount() { return evictionCount; }
+    static uint64_t GetFrame() { return frame; }
+    static const std::map<Handle, Allocation>& GetAllocations() { return allocations; }
+    static const char* GetCategoryName(Category category);
+
+private:
+    static std::map<Handle, Allocation> allocations;
+    static Handle nextHandle;
+    static size_t totalBytes;
+    static size_t categoryBytes[(int)Category::COUNT];
+    static unsigned int evictionCount;
+    static uint64_t frame;
+};
@@ -0,0 +1,450 @@
+#include "SceneSerializer.h"
+#include "ModuleScene.h"
+#include "GameObject.h"
+#include "ComponentTransform.h"
+#include "ComponentMesh.h"
+#include "ComponentMaterial.h"
+#include "MeshManager.h"
+#include "MeshResource.h"
+#include "TextureManager.h"
+#include "TextureResource.h"
+#include "VirtualFileSystem.h"
+#include "FileUtils.h"
+#include "MemoryTracker.h"
+#include "Profiler.h"
+#include "Logger.h"
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <utility>
+
+const char* SceneSerializer::DefaultPath = "../Assets/Scenes/Scene.wscene";
+SceneSerializer::Timings SceneSerializer::lastTimings;
+
+namespace
+{
+    // Cambiar al modificar cualquiera de los registros del archivo
+    const uint32_t SCENE_VERSION = 1;
+
+    struct SceneHeader
+    {
+        char magic[4];
+        uint32_t version;
+        uint32_t nodeCount;
+        uint32_t meshCount;
+        uint32_t textureCount;
+        uint32_t stringBytes;
+    };
+
+    typedef std::chrono::high_resolution_clock Clock;
+
+    double ElapsedMs(Clock::time_point start)
+    {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+}
+
+uint32_t SceneSerializer::AddString(SceneData& data, const std::string& text)
+{
+    uint32_t offset = (uint32_t)data.strings.size();
+    data.strings.insert(data.strings.end(), text.begin(), text.end());
+    data.strings.push_back('\0');
+    return offset;
+}
+
+void SceneSerializer::Collect(GameObject* root, SceneData& data)
+{
+    std::map<const MeshResource*, int32_t> meshIndices;
+    std::map<const TextureResource*, int32_t> textureIndices;
+    const std::shared_ptr<TextureResource> defaultTexture = TextureManager::GetDefault();
+    unsigned int skippedMeshes = 0;
+
+    // Preorden con pila explícita: el padre siempre queda antes que sus hijos
+    std::vector<std::pair<GameObject*, int32_t>> stack;
+    const std::vector<GameObject*>& rootChildren = root->GetChildren();
+    for (auto it = rootChildren.rbegin(); it != rootChildren.rend(); ++it)
+        stack.push_back(std::make_pair(*it, -1));
+
+    while (!stack.empty())
+    {
+        GameObject* go = stack.back().first;
+        int32_t parentIndex = stack.back().second;
+        stack.pop_back();
+
+        NodeRecord record = {};
+        record.parent = parentIndex;
+        record.nameOffset = AddString(data, go->GetName());
+        record.flags = go->IsActive() ? (uint32_t)NODE_ACTIVE : 0u;
+        record.rotation[3] = 1.0f;
+        record.scale[0] = record.scale[1] = record.scale[2] = 1.0f;
+        record.mesh = -1;
+        record.texture = -1;
+
+        if (ComponentTransform* transform = (ComponentTransform*)go->GetComponent(ComponentType::TRANSFORM))
+        {
+            glm::vec3 position = transform->GetPosition();
+            glm::quat rotation = transform->GetRotation();
+            glm::vec3 scale = transform->GetScale();
+
+            record.flags |= NODE_TRANSFORM;
+            std::memcpy(record.position, &position[0], sizeof(record.position));
+            record.rotation[0] = rotation.x;
+            record.rotation[1] = rotation.y;
+            record.rotation[2] = rotation.z;
+            record.rotation[3] = rotation.w;
+            std::memcpy(record.scale, &scale[0], sizeof(record.scale));
+        }
+
+        if (ComponentMesh* mesh = (ComponentMesh*)go->GetComponent(ComponentType::MESH))
+        {
+            record.flags |= NODE_MESH;
+            const MeshResource* resource = mesh->GetResource().get();
+            if (resource && !resource->GetSourcePath().empty())
+            {
+                auto found = meshIndices.find(resource);
+                if (found == meshIndices.end())
+                {
+                    MeshRecord entry;
+                    entry.pathOffset = AddString(data, resource->GetSourcePath());
+                    entry.meshIndex = resource->GetSourceIndex();
+                    entry.cacheHash = resource->GetCacheHash();
+                    found = meshIndices.insert(std::make_pair(resource, (int32_t)data.meshes.size())).first;
+                    data.meshes.push_back(entry);
+                }
+                record.mesh = found->second;
+            }
+            else if (resource)
+            {
+                skippedMeshes++;
+            }
+        }
+
+        if (ComponentMaterial* material = (ComponentMaterial*)go->GetComponent(ComponentType::MATERIAL))
+        {
+            record.flags |= NODE_MATERIAL;
+            const std::shared_ptr<TextureResource>& texture = material->GetTexture();
+            if (texture && texture != defaultTexture && !texture->GetPath().empty())
+            {
+                auto found = textureIndices.find(texture.get());
+                if (found == textureIndices.end())
+                {
+                    found = textureIndices.insert(std::make_pair(texture.get(), (int32_t)data.textures.size())).first;
+                    data.textures.push_back(AddString(data, texture->GetPath()));
+                }
+                record.texture = found->second;
+            }
+        }
+
+        int32_t index = (int32_t)data.nodes.size();
+        data.nodes.push_back(record);
+
+        const std::vector<GameObject*>& children = go->GetChildren();
+        for (auto it = children.rbegin(); it != children.rend(); ++it)
+            stack.push_back(std::make_pair(*it, index));
+    }
+
+    if (skippedMeshes > 0)
+        LOG_WARN(SCENE, "{} procedural meshes are not saved (no source asset)", skippedMeshes);
+}
+
+bool SceneSerializer::Write(const std::string& path, const SceneData& data, size_t& bytes)
+{
+    SceneHeader header;
+    std::memcpy(header.magic, "WSCN", 4);
+    header.version = SCENE_VERSION;
+    header.nodeCount = (uint32_t)data.nodes.size();
+    header.meshCount = (uint32_t)data.meshes.size();
+    header.textureCount = (uint32_t)data.textures.size();
+    header.stringBytes = (uint32_t)data.strings.size();
+
+    size_t slash = path.find_last_of("/\\");
+    if (slash != std::string::npos)
+        FileUtils::CreateDirectories(path.substr(0, slash));
+
+    // Se escribe en un temporal y se renombra: si el guardado falla a medias
+    // (disco lleno, cierre inesperado) la escena anterior sigue intacta
+    std::string tempPath = FileUtils::MakeTempPath(path);
+    {
+        std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+        if (!file)
+        {
+            LOG_ERROR(SCENE, "Could not open {} for writing", path);
+            return false;
+        }
+
+        // Cada bloque de una sola escritura
+        file.write((const char*)&header, sizeof(header));
+        file.write((const char*)data.meshes.data(), data.meshes.size() * sizeof(MeshRecord));
+        file.write((const char*)data.textures.data(), data.textures.size() * sizeof(uint32_t));
+        file.write((const char*)data.nodes.data(), data.nodes.size() * sizeof(NodeRecord));
+        file.write(data.strings.data(), data.strings.size());
+        file.close();
+        if (!file)
+        {
+            LOG_ERROR(SCENE, "Could not write {}", path);
+            std::remove(tempPath.c_str());
+            return false;
+        }
+    }
+
+    if (!FileUtils::RenameOver(tempPath, path))
+    {
+        LOG_ERROR(SCENE, "Could not replace {}", path);
+        return false;
+    }
+
+    bytes = sizeof(header) + data.meshes.size() * sizeof(MeshRecord) + data.textures.size() * sizeof(uint32_t)
+        + data.nodes.size() * sizeof(NodeRecord) + data.strings.size();
+    return true;
+}
+
+bool SceneSerializer::Read(const std::string& path, SceneData& data, size_t& bytes)
+{
+    VirtualFile file = VirtualFileSystem::Open(path);
+    if (!file.IsOpen())
+    {
+        LOG_ERROR(SCENE, "Could not open {}", path);
+        return false;
+    }
+
+    SceneHeader header;
+    if (file.Size() < sizeof(header))
+        return false;
+    std::memcpy(&header, file.Data(), sizeof(header));
+
+    const size_t meshBytes = (size_t)header.meshCount * sizeof(MeshRecord);
+    const size_t textureBytes = (size_t)header.textureCount * sizeof(uint32_t);
+    const size_t nodeBytes = (size_t)header.nodeCount * sizeof(NodeRecord);
+    bytes = sizeof(header) + meshBytes + textureBytes + nodeBytes + header.stringBytes;
+
+    if (std::memcmp(header.magic, "WSCN", 4) != 0 || header.version != SCENE_VERSION || file.Size() < bytes)
+    {
+        LOG_ERROR(SCENE, "Invalid or outdated scene file: {}", path);
+        return false;
+    }
+
+    // Copias en bloque, sin recorrer el archivo registro a registro
+    const unsigned char* cursor = file.Data() + sizeof(header);
+    data.meshes.resize(header.meshCount);
+    std::memcpy(data.meshes.data(), cursor, meshBytes);
+    cursor += meshBytes;
+    data.textures.resize(header.textureCount);
+    std::memcpy(data.textures.data(), cursor, textureBytes);
+    cursor += textureBytes;
+    data.nodes.resize(header.nodeCount);
+    std::memcpy(data.nodes.data(), cursor, nodeBytes);
+    cursor += nodeBytes;
+    data.strings.assign((const char*)cursor, (const char*)cursor + header.stringBytes);
+
+    // Validar referencias una vez aquí para que Build no tenga que comprobar nada
+    bool valid = data.strings.empty() ? data.nodes.empty() && data.meshes.empty() && data.textures.empty()
+        : data.strings.back() == '\0';
+    for (const MeshRecord& mesh : data.meshes)
+        valid = valid && mesh.pathOffset < header.stringBytes;
+    for (uint32_t texture : data.textures)
+        valid = valid && texture < header.stringBytes;
+    for (size_t i = 0; i < data.nodes.size() && valid; ++i)
+    {
+        const NodeRecord& node = data.nodes[i];
+        valid = node.parent < (int32_t)i && node.parent >= -1
+            && node.nameOffset < header.stringBytes
+            && node.mesh < (int32_t)header.meshCount && node.mesh >= -1
+            && node.texture < (int32_t)header.textureCount && node.texture >= -1;
+    }
+
+    if (!valid)
+    {
+        LOG_ERROR(SCENE, "Corrupt scene file: {}", path);
+        return false;
+    }
+    return true;
+}
+
+void SceneSerializer::Build(const SceneData& data, ModuleScene& scene, GameObject* parent)
+{
+    // Assets referenciados: una vez por entrada de la tabla, no por nodo
+    std::vector<MeshManager::Reference> references(data.meshes.size());
+    for (size_t i = 0; i < data.meshes.size(); ++i)
+    {
+        references[i].sourcePath = &data.strings[data.meshes[i].pathOffset];
+        references[i].meshIndex = data.meshes[i].meshIndex;
+        references[i].cacheHash = data.meshes[i].cacheHash;
+    }
+    std::vector<std::shared_ptr<MeshResource>> meshes = MeshManager::LoadReferences(references);
+
+    std::vector<std::shared_ptr<TextureResource>> textures(data.textures.size());
+    for (size_t i = 0; i < data.textures.size(); ++i)
+        textures[i] = TextureManager::LoadAsync(&data.strings[data.textures[i]]);
+
+    // Reservar los hijos de cada nodo antes de crearlos
+    const size_t count = data.nodes.size();
+    std::vector<uint32_t> childCounts(count, 0);
+    size_t rootChildren = 0;
+    for (const NodeRecord& node : data.nodes)
+    {
+        if (node.parent < 0)
+            rootChildren++;
+        else
+            childCounts[node.parent]++;
+    }
+
+    std::vector<GameObject*> objects(count, nullptr);
+    parent->ReserveChildren(parent->GetChildren().size() + rootChildren);
+    scene.allGameObjects.reserve(scene.allGameObjects.size() + count);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        const NodeRecord& node = data.nodes[i];
+        GameObject* go = new GameObject(&data.strings[node.nameOffset]);
+        go->SetActive((node.flags & NODE_ACTIVE) != 0);
+        go->ReserveChildren(childCounts[i]);
+        (node.parent < 0 ? parent : objects[node.parent])->AddChild(go);
+        objects[i] = go;
+
+        if (node.flags & NODE_TRANSFORM)
+        {
+            ComponentTransform* transform = (ComponentTransform*)go->CreateComponent(ComponentType::TRANSFORM);
+            transform->SetPosition(glm::vec3(node.position[0], node.position[1], node.position[2]));
+            transform->SetRotation(glm::quat(node.rotation[3], node.rotation[0], node.rotation[1], node.rotation[2]));
+            transform->SetScale(glm::vec3(node.scale[0], node.scale[1], node.scale[2]));
+        }
+
+        if (node.flags & NODE_MESH)
+        {
+            ComponentMesh* mesh = (ComponentMesh*)go->CreateComponent(ComponentType::MESH);
+            if (node.mesh >= 0 && meshes[node.mesh])
+                mesh->SetResource(meshes[node.mesh]);
+        }
+
+        if (node.flags & NODE_MATERIAL)
+        {
+            ComponentMaterial* material = (ComponentMaterial*)go->CreateComponent(ComponentType::MATERIAL);
+            if (node.texture >= 0)
+                material->SetTexture(textures[node.texture]);
+        }
+    }
+
+    scene.allGameObjects.insert(scene.allGameObjects.end(), objects.begin(), objects.end());
+    parent->UpdateAABB();
+}
+
+bool SceneSerializer::Save(const std::string& path, GameObject* root)
+{
+    PROFILE_SCOPE("Scene save");
+    if (!root)
+        return false;
+
+    Clock::time_point start = Clock::now();
+
+    SceneData data;
+    Collect(root, data);
+
+    size_t bytes = 0;
+    if (!Write(path, data, bytes))
+        return false;
+
+    lastTimings.nodes = data.nodes.size();
+    lastTimings.fileBytes = bytes;
+    lastTimings.saveMs = ElapsedMs(start);
+
+    LOG_INFO(SCENE, "Saved {} nodes, {} meshes, {} textures to {} ({} KB, {:.2f} ms)", data.nodes.size(),
+        data.meshes.size(), data.textures.size(), path, bytes / 1024, lastTimings.saveMs);
+    return true;
+}
+
+bool SceneSerializer::Load(const std::string& path, ModuleScene& scene, GameObject* parent)
+{
+    PROFILE_SCOPE("Scene load");
+    MEMORY_TAG(SCENE);
+    if (!parent)
+        return false;
+
+    Clock::time_point start = Clock::now();
+
+    SceneData data;
+    size_t bytes = 0;
+    if (!Read(path, data, bytes))
+        return false;
+
+    double readMs = ElapsedMs(start);
+    Clock::time_point buildStart = Clock::now();
+    Build(data, scene, parent);
+
+    lastTimings.nodes = data.nodes.size();
+    lastTimings.fileBytes = bytes;
+    lastTimings.readMs = readMs;
+    lastTimings.buildMs = ElapsedMs(buildStart);
+
+    LOG_INFO(SCENE, "Loaded {} nodes from {} (read {:.2f} ms, build {:.2f} ms)", data.nodes.size(), path,
+        lastTimings.readMs, lastTimings.buildMs);
+    return true;
+}
+
+SceneSerializer::Timings SceneSerializer::RunBenchmark(ModuleScene& scene, size_t nodeCount)
+{
+    Timings result;
+    GameObject* root = scene.GetRoot();
+    if (!root || nodeCount == 0)
+        return result;
+
+    // Tablas de la escena actual; los nodos sintéticos las reutilizan
+    SceneData data;
+    Collect(root, data);
+    data.nodes.clear();
+    data.nodes.reserve(nodeCount);
+
+    // Árbol de 8 hijos por nodo con transform en todos y malla/material en las hojas
+    const size_t branching = 8;
+    const size_t firstLeaf = (nodeCount - 1) / branching + 1;
+    for (size_t i = 0; i < nodeCount; ++i)
+    {
+        NodeRecord record = {};
+        record.parent = i == 0 ? -1 : (int32_t)((i - 1) / branching);
+        record.nameOffset = AddString(data, "Node_" + std::to_string(i));
+        record.flags = NODE_ACTIVE | NODE_TRANSFORM;
+        record.position[0] = (float)(i % 100);
+        record.position[2] = (float)(i / 100 % 100);
+        record.rotation[3] = 1.0f;
+        record.scale[0] = record.scale[1] = record.scale[2] = 1.0f;
+        record.mesh = -1;
+        record.texture = -1;
+        if (i >= firstLeaf)
+        {
+            record.flags |= NODE_MESH | NODE_MATERIAL;
+            if (!data.meshes.empty())
+                record.mesh = (int32_t)(i % data.meshes.size());
+            if (!data.textures.empty())
+                record.texture = (int32_t)(i % data.textures.size());
+        }
+        data.nodes.push_back(record);
+    }
+
+    const std::string loadPath = "../Library/Benchmark/SceneLoad.wscene";
+    const std::string savePath = "../Library/Benchmark/SceneSave.wscene";
+    if (!Write(loadPath, data, result.fileBytes))
+        return result;
+    data = SceneData();
+
+    GameObject* container = scene.CreateGameObject("Scene Benchmark", root);
+    if (Load(loadPath, scene, container))
+    {
+        result.nodes = lastTimings.nodes;
+        result.readMs = lastTimings.readMs;
+        result.buildMs = lastTimings.buildMs;
+
+        if (Save(savePath, container))
+            result.saveMs = lastTimings.saveMs;
+    }
+    scene.DestroyGameObject(container);
+
+    std::remove(loadPath.c_str());
+    std::remove(savePath.c_str());
+
+    lastTimings = result;
+    LOG_INFO(SCENE, "Benchmark {} nodes ({} KB): save {:.2f} ms, read {:.2f} ms, build {:.2f} ms", result.nodes,
+        result.fileBytes / 1024, result.saveMs, result.readMs, result.buildMs);
+    return result;
+}
@@ -0,0 +1,83 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class GameObject;
+class ModuleScene;
+
+// Escena binaria (.wscene): jerarquía, transforms y referencias a las mallas
+// (por su entrada de MeshCache) y texturas que usan los componentes.
+// Cabecera, tablas de mallas y texturas, un array de nodos de tamaño fijo y
+// una tabla de cadenas. Se escribe en una sola pasada por el árbol y se lee de
+// golpe: los nodos se copian en bloque y cada padre reserva sus hijos antes de
+// crearlos, sin parsear nodo a nodo.
+class SceneSerializer
+{
+public:
+    static const char* DefaultPath;
+
+    // Guarda los descendientes de root (root no se incluye)
+    static bool Save(const std::string& path, GameObject* root);
+
+    // Crea la jerarquía guardada bajo parent
+    static bool Load(const std::string& path, ModuleScene& scene, GameObject* parent);
+
+    struct Timings
+    {
+        size_t nodes = 0;
+        size_t fileBytes = 0;
+        double saveMs = 0.0;
+        double readMs = 0.0;        // abrir, validar y resolver mallas/texturas
+        double buildMs = 0.0;       // crear GameObjects y componentes
+    };
+    static const Timings& GetLastTimings() { return lastTimings; }
+
+    // Escena sintética de nodeCount nodos (usa las mallas y texturas de la escena
+    // actual): la guarda, la carga bajo un nodo temporal y la destruye
+    static Timings RunBenchmark(ModuleScene& scene, size_t nodeCount = 100000);
+
+private:
+    enum NodeFlags : uint32_t
+    {
+        NODE_ACTIVE = 1 << 0,
+        NODE_TRANSFORM = 1 << 1,
+        NODE_MESH = 1 << 2,
+        NODE_MATERIAL = 1 << 3
+    };
+
+    struct NodeRecord
+    {
+        int32_t parent;             // índice de un nodo anterior, -1 = hijo directo del nodo de carga
+        uint32_t nameOffset;
+        uint32_t flags;
+        float position[3];
+        float rotation[4];          // x, y, z, w
+        float scale[3];
+        int32_t mesh;               // índice en la tabla de mallas o -1
+        int32_t texture;            // índice en la tabla de texturas o -1
+    };
+
+    struct MeshRecord
+    {
+        uint32_t pathOffset;
+        uint32_t meshIndex;
+        uint64_t cacheHash;
+    };
+
+    struct SceneData
+    {
+        std::vector<NodeRecord> nodes;
+        std::vector<MeshRecord> meshes;
+        std::vector<uint32_t> textures;     // offset de la ruta en strings
+        std::vector<char> strings;          // terminadas en '\0'
+    };
+
+    static void Collect(GameObject* root, SceneData& data);
+    static uint32_t AddString(SceneData& data, const std::string& text);
+    static bool Write(const std::string& path, const SceneData& data, size_t& bytes);
+    static bool Read(const std::string& path, SceneData& data, size_t& bytes);
+    static void Build(const SceneData& data, ModuleScene& scene, GameObject* parent);
+
+    static Timings lastTimings;
+};
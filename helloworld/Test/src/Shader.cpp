@@ -1,4 +1,5 @@
 #include "Shader.h"
+#include "RenderStats.h"
 
 Shader::Shader(const char* vertexSource, const char* fragmentSource)
 {
@@ -29,31 +30,37 @@ Shader::Shader(const char* vertexSource, const char* fragmentSource)
 void Shader::use()
 {
     glUseProgram(ID);
+    RenderStats::CountProgramBind();
 }
 
 void Shader::setBool(const std::string& name, bool value) const
 {
     glUniform1i(glGetUniformLocation(ID, name.c_str()), (int)value);
+    RenderStats::CountUniforms();
 }
 
 void Shader::setInt(const std::string& name, int value) const
 {
     glUniform1i(glGetUniformLocation(ID, name.c_str()), value);
+    RenderStats::CountUniforms();
 }
 
 void Shader::setFloat(const std::string& name, float value) const
 {
     glUniform1f(glGetUniformLocation(ID, name.c_str()), value);
+    RenderStats::CountUniforms();
 }
 
 void Shader::setVec3(const std::string& name, float x, float y, float z) const
 {
     glUniform3f(glGetUniformLocation(ID, name.c_str()), x, y, z);
+    RenderStats::CountUniforms();
 }
 
 void Shader::setVec4(const std::string& name, float x, float y, float z, float w) const
 {
     glUniform4f(glGetUniformLocation(ID, name.c_str()), x, y, z, w);
+    RenderStats::CountUniforms();
 }
 
 void Shader::checkCompileErrors(unsigned int shader, std::string type)
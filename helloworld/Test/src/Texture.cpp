@@ -1,8 +1,9 @@
 #include "Texture.h"
-#include <iostream>
-#include <fstream>
+#include "TextureManager.h"
+#include "TextureContainer.h"
+#include "VirtualFileSystem.h"
+#include "Logger.h"
 #include <vector>
-#include <cstring>
 #include <GL/gl.h>
 
 unsigned int Texture::CreateCheckerboardTexture(int width, int height, int cellSize)
@@ -33,19 +34,20 @@ unsigned int Texture::CreateCheckerboardTexture(int width, int height, int cellS
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 
-    std::cout << "[Texture] Generated checkerboard (" << width << "x" << height << ")" << std::endl;
+    LOG_DEBUG(TEXTURE, "Generated checkerboard ({}x{})", width, height);
     return texID;
 }
 
 unsigned int Texture::LoadTexture(const char* path)
 {
+    std::lock_guard<std::mutex> lock(TextureManager::GetDevILMutex());
     ILuint imgID;
     ilGenImages(1, &imgID);
     ilBindImage(imgID);
 
     if (!ilLoadImage(path))
     {
-        std::cerr << "[Texture] Failed to load: " << path << " -> using fallback checkerboard" << std::endl;
+        LOG_WARN(TEXTURE, "Failed to load: {} -> using fallback checkerboard", path);
         ilDeleteImages(1, &imgID);
         return CreateCheckerboardTexture(512, 512, 32);
     }
@@ -67,117 +69,37 @@ unsigned int Texture::LoadTexture(const char* path)
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 
     ilDeleteImages(1, &imgID);
-    std::cout << "[Texture] Loaded: " << path << std::endl;
+    LOG_DEBUG(TEXTURE, "Loaded: {}", path);
     return texID;
 }
 
 unsigned int Texture::LoadDDSTexture(const char* path)
 {
-    std::ifstream file(path, std::ios::binary);
-    if (!file.is_open())
+    // Map the file and upload every mip level straight from the mapping
+    VirtualFile file = VirtualFileSystem::Open(path);
+    if (!file.IsOpen())
     {
-        std::cout << "Could not open DDS file: " << path << std::endl;
+        LOG_ERROR(TEXTURE, "Could not open DDS file: {}", path);
         return 0;
     }
 
-    // Verify DDS magic number
-    char magic[4];
-    file.read(magic, 4);
-    if (std::strncmp(magic, "DDS ", 4) != 0)
-    {
-        std::cout << "Invalid DDS file format: " << path << std::endl;
-        file.close();
+    TextureImporter::CompressedImage image;
+    if (!TextureContainer::Parse(file.Data(), file.Size(), image, path))
         return 0;
-    }
-
-    // Read DDS header (124 bytes)
-    unsigned char header[124];
-    file.read(reinterpret_cast<char*>(header), 124);
-
-    unsigned int height = *(unsigned int*)&(header[8]);
-    unsigned int width = *(unsigned int*)&(header[12]);
-    unsigned int mipMapCount = *(unsigned int*)&(header[24]);
-    unsigned int fourCC = *(unsigned int*)&(header[80]);
-
-    // Default to at least one mipmap level
-    if (mipMapCount == 0) mipMapCount = 1;
 
-    // Determine compression format
-    GLenum format;
-    unsigned int blockSize;
-
-    if (fourCC == 0x31545844) // DXT1
-    {
-        format = 0x83F1; // GL_COMPRESSED_RGBA_S3TC_DXT1_EXT
-        blockSize = 8;
-    }
-    else if (fourCC == 0x33545844) // DXT3
+    // Materials sample a plain 2D texture
+    if (image.layerCount != 1 || image.faceCount != 1)
     {
-        format = 0x83F2; // GL_COMPRESSED_RGBA_S3TC_DXT3_EXT
-        blockSize = 16;
-    }
-    else if (fourCC == 0x35545844) // DXT5
-    {
-        format = 0x83F3; // GL_COMPRESSED_RGBA_S3TC_DXT5_EXT
-        blockSize = 16;
-    }
-    else
-    {
-        std::cout << "Unsupported DDS compression format (0x" << std::hex << fourCC << "): " << path << std::endl;
-        file.close();
+        LOG_ERROR(TEXTURE, "DDS arrays and cubemaps cannot be used as a 2D texture: {}", path);
         return 0;
     }
 
-    // Calculate total buffer size for all mipmap levels
-    unsigned int bufsize = ((width + 3) / 4) * ((height + 3) / 4) * blockSize;
-
-    unsigned int totalSize = bufsize;
-    unsigned int w = width / 2;
-    unsigned int h = height / 2;
-    for (unsigned int i = 1; i < mipMapCount; i++)
-    {
-        if (w == 0) w = 1;
-        if (h == 0) h = 1;
-        totalSize += ((w + 3) / 4) * ((h + 3) / 4) * blockSize;
-        w /= 2;
-        h /= 2;
-    }
-
-    // Read compressed texture data
-    unsigned char* buffer = new unsigned char[totalSize];
-    file.read(reinterpret_cast<char*>(buffer), totalSize);
-    file.close();
-
-    // Create OpenGL texture
-    GLuint texID;
-    glGenTextures(1, &texID);
-    glBindTexture(GL_TEXTURE_2D, texID);
-
-    // Upload all mipmap levels
-    unsigned int offset = 0;
-    w = width;
-    h = height;
-
-    for (unsigned int level = 0; level < mipMapCount; ++level)
-    {
-        if (w == 0) w = 1;
-        if (h == 0) h = 1;
-
-        unsigned int size = ((w + 3) / 4) * ((h + 3) / 4) * blockSize;
-        glCompressedTexImage2D(GL_TEXTURE_2D, level, format, w, h, 0, size, buffer + offset);
-
-        offset += size;
-        w /= 2;
-        h /= 2;
-    }
-
-    delete[] buffer;
-
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, mipMapCount > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    GLenum target = GL_TEXTURE_2D;
+    GLuint texID = TextureContainer::Upload(image, target);
+    if (texID == 0)
+        return 0;
 
-    std::cout << "Loaded DDS texture: " << path << " (" << width << "x" << height << ", " << mipMapCount << " mipmaps)" << std::endl;
+    LOG_DEBUG(TEXTURE, "Loaded DDS texture: {} ({}x{}, {} mipmaps, {})", path, image.levels[0].width, image.levels[0].height,
+        image.mipCount, TextureImporter::GetFormatName(TextureImporter::GetGLFormat(image.format)));
     return texID;
-}
+}
\ No newline at end of file
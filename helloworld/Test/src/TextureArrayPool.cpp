@@ -0,0 +1,243 @@
+#include "TextureArrayPool.h"
+#include "TextureResource.h"
+#include "TextureImporter.h"
+#include "TextureStreamer.h"
+#include "Logger.h"
+#include <algorithm>
+#include <string>
+
+bool TextureArrayPool::enabled = false;
+int TextureArrayPool::layersPerArray = 32;
+
+std::vector<TextureArrayPool::Array> TextureArrayPool::arrays;
+std::map<const TextureResource*, std::weak_ptr<TextureArrayLayer>> TextureArrayPool::layers;
+GLuint TextureArrayPool::copyPBO = 0;
+unsigned int TextureArrayPool::generation = 0;
+
+TextureArrayLayer::~TextureArrayLayer()
+{
+    TextureArrayPool::Release(arrayIndex, layer, generation);
+}
+
+std::shared_ptr<TextureArrayLayer> TextureArrayPool::Acquire(const std::shared_ptr<TextureResource>& texture)
+{
+    if (!enabled || !texture)
+        return nullptr;
+
+    // Las copias por contenido usan la textura que realmente está en GPU
+    const TextureResource* source = texture.get();
+    while (source->id == 0 && source->fallback && source->IsReady())
+        source = source->fallback.get();
+
+    if (source->id == 0 || !source->IsReady() || source->IsEvicted() || TextureStreamer::GetResidentMip(source) >= 0)
+        return nullptr;
+
+    auto it = layers.find(source);
+    if (it != layers.end())
+    {
+        if (std::shared_ptr<TextureArrayLayer> existing = it->second.lock())
+            return existing;
+    }
+
+    Key key;
+    if (!QueryKey(source->id, key))
+        return nullptr;
+
+    int arrayIndex = FindOrCreateArray(key);
+    Array& array = arrays[arrayIndex];
+    int layer = (int)(std::find(array.used.begin(), array.used.end(), false) - array.used.begin());
+
+    CopyToLayer(source->id, array, layer);
+    array.used[layer] = true;
+    array.usedCount++;
+
+    std::shared_ptr<TextureArrayLayer> result = std::make_shared<TextureArrayLayer>(array.id, arrayIndex, layer, generation);
+    layers[source] = result;
+
+    // Aprovechar para quitar las entradas de texturas que ya no tienen capa
+    for (auto entry = layers.begin(); entry != layers.end();)
+    {
+        if (entry->second.expired())
+            entry = layers.erase(entry);
+        else
+            ++entry;
+    }
+    return result;
+}
+
+bool TextureArrayPool::QueryKey(GLuint texID, Key& key)
+{
+    glBindTexture(GL_TEXTURE_2D, texID);
+
+    GLint width = 0, height = 0, internalFormat = 0, compressed = GL_FALSE, maxLevel = 1000;
+    glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_WIDTH, &width);
+    glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_HEIGHT, &height);
+    glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_INTERNAL_FORMAT, &internalFormat);
+    glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_COMPRESSED, &compressed);
+    glGetTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, &maxLevel);
+
+    int levels = 0;
+    while (levels <= maxLevel)
+    {
+        GLint levelWidth = 0;
+        glGetTexLevelParameteriv(GL_TEXTURE_2D, levels, GL_TEXTURE_WIDTH, &levelWidth);
+        if (levelWidth == 0)
+            break;
+        levels++;
+    }
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    if (width == 0 || height == 0 || levels == 0)
+        return false;
+
+    // Las no comprimidas (RGB, RGBA...) se guardan todas en RGBA8
+    key.width = width;
+    key.height = height;
+    key.format = compressed ? (GLenum)internalFormat : GL_RGBA8;
+    key.levels = levels;
+    return true;
+}
+
+int TextureArrayPool::FindOrCreateArray(const Key& key)
+{
+    for (size_t i = 0; i < arrays.size(); ++i)
+    {
+        if (arrays[i].key == key && arrays[i].usedCount < (int)arrays[i].used.size())
+            return (int)i;
+    }
+
+    Array array;
+    array.key = key;
+    array.used.assign(std::max(1, layersPerArray), false);
+
+    const bool compressed = (key.format != GL_RGBA8);
+    const GLsizei layerCount = (GLsizei)array.used.size();
+    size_t bytes = 0;
+
+    glGenTextures(1, &array.id);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, array.id);
+    for (int level = 0; level < key.levels; ++level)
+    {
+        int width = std::max(1, key.width >> level);
+        int height = std::max(1, key.height >> level);
+        if (compressed)
+        {
+            // glCompressedTexImage3D exige un tamaño de datos aunque no se pasen datos
+            size_t levelSize = TextureImporter::GetLevelSize(key.format, width, height);
+            glCompressedTexImage3D(GL_TEXTURE_2D_ARRAY, level, key.format, width, height, layerCount,
+                0, (GLsizei)(levelSize * layerCount), nullptr);
+            bytes += levelSize * layerCount;
+        }
+        else
+        {
+            glTexImage3D(GL_TEXTURE_2D_ARRAY, level, GL_RGBA8, width, height, layerCount,
+                0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+            bytes += (size_t)width * height * 4 * layerCount;
+        }
+    }
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_BASE_LEVEL, 0);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAX_LEVEL, key.levels - 1);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_REPEAT);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_REPEAT);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, key.levels > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+
+    std::string owner = "Texture array " + std::to_string(key.width) + "x" + std::to_string(key.height)
+        + " " + TextureImporter::GetFormatName(key.format);
+    array.residencyHandle = ResidencyManager::Register(ResidencyManager::Category::TEXTURE, owner, bytes);
+
+    LOG_DEBUG(TEXTURE, "Created array {}x{} ({}, {} layers, {} KB)", key.width, key.height,
+        TextureImporter::GetFormatName(key.format), layerCount, bytes / 1024);
+
+    arrays.push_back(array);
+    return (int)arrays.size() - 1;
+}
+
+void TextureArrayPool::CopyToLayer(GLuint texID, const Array& array, int layer)
+{
+    // Copia GPU -> GPU: el nivel se lee a un PBO y de ahí se escribe en la capa,
+    // sin pasar por memoria de CPU
+    if (copyPBO == 0)
+        glGenBuffers(1, &copyPBO);
+
+    const bool compressed = (array.key.format != GL_RGBA8);
+    glBindTexture(GL_TEXTURE_2D, texID);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, array.id);
+
+    for (int level = 0; level < array.key.levels; ++level)
+    {
+        int width = std::max(1, array.key.width >> level);
+        int height = std::max(1, array.key.height >> level);
+
+        GLint size = width * height * 4;
+        if (compressed)
+            glGetTexLevelParameteriv(GL_TEXTURE_2D, level, GL_TEXTURE_COMPRESSED_IMAGE_SIZE, &size);
+
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, copyPBO);
+        glBufferData(GL_PIXEL_PACK_BUFFER, size, nullptr, GL_STREAM_COPY);
+        if (compressed)
+            glGetCompressedTexImage(GL_TEXTURE_2D, level, (void*)0);
+        else
+            glGetTexImage(GL_TEXTURE_2D, level, GL_RGBA, GL_UNSIGNED_BYTE, (void*)0);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, copyPBO);
+        if (compressed)
+        {
+            glCompressedTexSubImage3D(GL_TEXTURE_2D_ARRAY, level, 0, 0, layer, width, height, 1,
+                array.key.format, size, (void*)0);
+        }
+        else
+        {
+            glTexSubImage3D(GL_TEXTURE_2D_ARRAY, level, 0, 0, layer, width, height, 1,
+                GL_RGBA, GL_UNSIGNED_BYTE, (void*)0);
+        }
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    }
+
+    glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+    glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+void TextureArrayPool::Release(int arrayIndex, int layer, unsigned int layerGeneration)
+{
+    if (layerGeneration != generation || arrayIndex >= (int)arrays.size())
+        return;
+
+    // El array se conserva aunque quede vacío: la siguiente textura del mismo tipo lo reutiliza
+    Array& array = arrays[arrayIndex];
+    if (array.used[layer])
+    {
+        array.used[layer] = false;
+        array.usedCount--;
+    }
+}
+
+void TextureArrayPool::Clear()
+{
+    for (Array& array : arrays)
+    {
+        glDeleteTextures(1, &array.id);
+        ResidencyManager::Unregister(array.residencyHandle);
+    }
+    arrays.clear();
+    layers.clear();
+
+    if (copyPBO != 0)
+    {
+        glDeleteBuffers(1, &copyPBO);
+        copyPBO = 0;
+    }
+
+    // Las capas que sigan vivas en algún material ya no apuntan a nada válido
+    generation++;
+}
+
+size_t TextureArrayPool::GetUsedLayerCount()
+{
+    size_t count = 0;
+    for (const Array& array : arrays)
+        count += array.usedCount;
+    return count;
+}
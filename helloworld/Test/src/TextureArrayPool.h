@@ -0,0 +1,88 @@
+#pragma once
+#include <glad/glad.h>
+#include <map>
+#include <memory>
+#include <vector>
+#include "ResidencyManager.h"
+
+class TextureResource;
+
+// Capa de un GL_TEXTURE_2D_ARRAY reservada para una textura. La capa se libera
+// cuando se suelta la última referencia (los materiales guardan un shared_ptr).
+class TextureArrayLayer
+{
+    friend class TextureArrayPool;
+
+public:
+    TextureArrayLayer(GLuint array, int arrayIndex, int layer, unsigned int generation)
+        : array(array), arrayIndex(arrayIndex), layer(layer), generation(generation) {}
+    ~TextureArrayLayer();
+
+    TextureArrayLayer(const TextureArrayLayer&) = delete;
+    TextureArrayLayer& operator=(const TextureArrayLayer&) = delete;
+
+    GLuint GetArray() const { return array; }
+    int GetLayer() const { return layer; }
+
+private:
+    GLuint array;
+    int arrayIndex;
+    int layer;
+    unsigned int generation;   // para ignorar capas de arrays ya destruidos por Clear
+};
+
+// Agrupa las texturas del mismo tamaño, formato y número de mips en arrays de
+// layersPerArray capas. Así el render puede dibujar con una sola llamada
+// objetos con texturas distintas: cada instancia indica su capa.
+// Las texturas en streaming se quedan fuera (sus mips cambian con el tiempo).
+class TextureArrayPool
+{
+public:
+    static bool enabled;
+    static int layersPerArray;
+
+    // Copia la textura (en GPU, a través de un PBO) a una capa libre. Devuelve
+    // nullptr si aún no está lista o no se puede agrupar.
+    static std::shared_ptr<TextureArrayLayer> Acquire(const std::shared_ptr<TextureResource>& texture);
+
+    // Destruye todos los arrays (antes de destruir el contexto GL)
+    static void Clear();
+
+    static size_t GetArrayCount() { return arrays.size(); }
+    static size_t GetUsedLayerCount();
+
+private:
+    friend class TextureArrayLayer;
+
+    struct Key
+    {
+        int width = 0;
+        int height = 0;
+        GLenum format = GL_RGBA8;
+        int levels = 0;
+
+        bool operator==(const Key& other) const
+        {
+            return width == other.width && height == other.height && format == other.format && levels == other.levels;
+        }
+    };
+
+    struct Array
+    {
+        Key key;
+        GLuint id = 0;
+        std::vector<bool> used;
+        int usedCount = 0;
+        ResidencyManager::Handle residencyHandle = 0;
+    };
+
+    static bool QueryKey(GLuint texID, Key& key);
+    static int FindOrCreateArray(const Key& key);
+    static void CopyToLayer(GLuint texID, const Array& array, int layer);
+    static void Release(int arrayIndex, int layer, unsigned int generation);
+
+    static std::vector<Array> arrays;
+    static std::map<const TextureResource*, std::weak_ptr<TextureArrayLayer>> layers;
+    static GLuint copyPBO;
+    static unsigned int generation;
+};
@@ -0,0 +1,421 @@
+#include "TextureContainer.h"
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+namespace
+{
+    const uint32_t DDS_MAGIC = 0x20534444; // "DDS "
+    const uint32_t DDS_HEADER_SIZE = 124;
+    const uint32_t DDS_DX10_HEADER_SIZE = 20;
+    const uint32_t DDSCAPS2_CUBEMAP = 0x200;
+    const uint32_t DDSCAPS2_CUBEMAP_ALLFACES = 0xFC00;
+    const uint32_t DDS_RESOURCE_MISC_TEXTURECUBE = 0x4;
+    const uint32_t DDS_DIMENSION_TEXTURE2D = 3;
+
+    const uint32_t FOURCC_DXT1 = 0x31545844;
+    const uint32_t FOURCC_DXT3 = 0x33545844;
+    const uint32_t FOURCC_DXT5 = 0x35545844;
+    const uint32_t FOURCC_ATI1 = 0x31495441;
+    const uint32_t FOURCC_BC4U = 0x55344342;
+    const uint32_t FOURCC_BC4S = 0x53344342;
+    const uint32_t FOURCC_ATI2 = 0x32495441;
+    const uint32_t FOURCC_BC5U = 0x55354342;
+    const uint32_t FOURCC_BC5S = 0x53354342;
+    const uint32_t FOURCC_DX10 = 0x30315844;
+
+    const unsigned char KTX2_IDENTIFIER[12] = { 0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n' };
+    const size_t KTX2_HEADER_SIZE = 80;
+    const size_t KTX2_LEVEL_ENTRY_SIZE = 24;
+
+    // Límites para descartar cabeceras corruptas antes de calcular tamaños
+    const int MAX_TEXTURE_DIMENSION = 16384;
+    const int MAX_ARRAY_LAYERS = 2048;
+
+    uint32_t ReadU32(const unsigned char* p)
+    {
+        return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+    }
+
+    uint64_t ReadU64(const unsigned char* p)
+    {
+        return (uint64_t)ReadU32(p) | ((uint64_t)ReadU32(p + 4) << 32);
+    }
+
+    int MaxMipCount(int width, int height)
+    {
+        int count = 1;
+        for (int size = std::max(width, height); size > 1; size >>= 1)
+            count++;
+        return count;
+    }
+
+    // Los formatos sRGB se leen como UNORM: el shader trabaja en espacio gamma
+    TextureImporter::Format FromDXGI(uint32_t dxgi)
+    {
+        switch (dxgi)
+        {
+        case 70: case 71: case 72: return TextureImporter::Format::BC1;
+        case 73: case 74: case 75: return TextureImporter::Format::BC2;
+        case 76: case 77: case 78: return TextureImporter::Format::BC3;
+        case 79: case 80: return TextureImporter::Format::BC4;
+        case 81: return TextureImporter::Format::BC4_SNORM;
+        case 82: case 83: return TextureImporter::Format::BC5;
+        case 84: return TextureImporter::Format::BC5_SNORM;
+        case 94: case 95: return TextureImporter::Format::BC6H_UF16;
+        case 96: return TextureImporter::Format::BC6H_SF16;
+        case 97: case 98: case 99: return TextureImporter::Format::BC7;
+        default: return TextureImporter::Format::NONE;
+        }
+    }
+
+    TextureImporter::Format FromFourCC(uint32_t fourCC)
+    {
+        switch (fourCC)
+        {
+        case FOURCC_DXT1: return TextureImporter::Format::BC1;
+        case FOURCC_DXT3: return TextureImporter::Format::BC2;
+        case FOURCC_DXT5: return TextureImporter::Format::BC3;
+        case FOURCC_ATI1:
+        case FOURCC_BC4U: return TextureImporter::Format::BC4;
+        case FOURCC_BC4S: return TextureImporter::Format::BC4_SNORM;
+        case FOURCC_ATI2:
+        case FOURCC_BC5U: return TextureImporter::Format::BC5;
+        case FOURCC_BC5S: return TextureImporter::Format::BC5_SNORM;
+        default: return TextureImporter::Format::NONE;
+        }
+    }
+
+    TextureImporter::Format FromVkFormat(uint32_t vkFormat)
+    {
+        switch (vkFormat)
+        {
+        case 131: case 132: case 133: case 134: return TextureImporter::Format::BC1;
+        case 135: case 136: return TextureImporter::Format::BC2;
+        case 137: case 138: return TextureImporter::Format::BC3;
+        case 139: return TextureImporter::Format::BC4;
+        case 140: return TextureImporter::Format::BC4_SNORM;
+        case 141: return TextureImporter::Format::BC5;
+        case 142: return TextureImporter::Format::BC5_SNORM;
+        case 143: return TextureImporter::Format::BC6H_UF16;
+        case 144: return TextureImporter::Format::BC6H_SF16;
+        case 145: case 146: return TextureImporter::Format::BC7;
+        default: return TextureImporter::Format::NONE;
+        }
+    }
+
+    bool ValidateDimensions(const TextureImporter::CompressedImage& image, int width, int height, const std::string& name)
+    {
+        if (width <= 0 || height <= 0 || width > MAX_TEXTURE_DIMENSION || height > MAX_TEXTURE_DIMENSION)
+        {
+            std::cerr << "[TextureContainer] Invalid size " << width << "x" << height << ": " << name << std::endl;
+            return false;
+        }
+        if (image.mipCount < 1 || image.mipCount > MaxMipCount(width, height))
+        {
+            std::cerr << "[TextureContainer] Invalid mip count " << image.mipCount << ": " << name << std::endl;
+            return false;
+        }
+        if (image.layerCount < 1 || image.layerCount > MAX_ARRAY_LAYERS)
+        {
+            std::cerr << "[TextureContainer] Invalid layer count " << image.layerCount << ": " << name << std::endl;
+            return false;
+        }
+        if (image.faceCount == 6 && width != height)
+        {
+            std::cerr << "[TextureContainer] Cubemap faces must be square: " << name << std::endl;
+            return false;
+        }
+        return true;
+    }
+}
+
+bool TextureContainer::Parse(const void* data, size_t size, TextureImporter::CompressedImage& out, const std::string& name)
+{
+    const unsigned char* bytes = (const unsigned char*)data;
+    if (size >= sizeof(KTX2_IDENTIFIER) && memcmp(bytes, KTX2_IDENTIFIER, sizeof(KTX2_IDENTIFIER)) == 0)
+        return ParseKTX2(data, size, out, name);
+    return ParseDDS(data, size, out, name);
+}
+
+bool TextureContainer::ParseDDS(const void* data, size_t size, TextureImporter::CompressedImage& out, const std::string& name)
+{
+    const unsigned char* bytes = (const unsigned char*)data;
+    if (size < 4 + DDS_HEADER_SIZE || ReadU32(bytes) != DDS_MAGIC || ReadU32(bytes + 4) != DDS_HEADER_SIZE)
+    {
+        std::cerr << "[TextureContainer] Invalid DDS header: " << name << std::endl;
+        return false;
+    }
+
+    const unsigned char* header = bytes + 4;
+    int height = (int)ReadU32(header + 8);
+    int width = (int)ReadU32(header + 12);
+    uint32_t fourCC = ReadU32(header + 80);
+    uint32_t caps2 = ReadU32(header + 108);
+
+    out.mipCount = (int)std::max(1u, ReadU32(header + 24));
+    out.layerCount = 1;
+    out.faceCount = 1;
+    size_t dataOffset = 4 + DDS_HEADER_SIZE;
+
+    if (fourCC == FOURCC_DX10)
+    {
+        if (size < dataOffset + DDS_DX10_HEADER_SIZE)
+        {
+            std::cerr << "[TextureContainer] Truncated DX10 header: " << name << std::endl;
+            return false;
+        }
+
+        const unsigned char* dx10 = bytes + dataOffset;
+        uint32_t dxgiFormat = ReadU32(dx10);
+        uint32_t dimension = ReadU32(dx10 + 4);
+        uint32_t miscFlag = ReadU32(dx10 + 8);
+        uint32_t arraySize = ReadU32(dx10 + 12);
+
+        if (dimension != DDS_DIMENSION_TEXTURE2D)
+        {
+            std::cerr << "[TextureContainer] Only 2D DDS textures are supported: " << name << std::endl;
+            return false;
+        }
+
+        out.format = FromDXGI(dxgiFormat);
+        out.layerCount = (int)std::min<uint32_t>(std::max(1u, arraySize), MAX_ARRAY_LAYERS + 1);
+        out.faceCount = (miscFlag & DDS_RESOURCE_MISC_TEXTURECUBE) ? 6 : 1;
+        dataOffset += DDS_DX10_HEADER_SIZE;
+
+        if (out.format == TextureImporter::Format::NONE)
+        {
+            std::cerr << "[TextureContainer] Unsupported DXGI format " << dxgiFormat << ": " << name << std::endl;
+            return false;
+        }
+    }
+    else
+    {
+        out.format = FromFourCC(fourCC);
+        if (out.format == TextureImporter::Format::NONE)
+        {
+            std::cerr << "[TextureContainer] Unsupported DDS compression format (0x" << std::hex << fourCC << std::dec << "): " << name << std::endl;
+            return false;
+        }
+
+        if (caps2 & DDSCAPS2_CUBEMAP)
+        {
+            if ((caps2 & DDSCAPS2_CUBEMAP_ALLFACES) != DDSCAPS2_CUBEMAP_ALLFACES)
+            {
+                std::cerr << "[TextureContainer] Partial cubemaps are not supported: " << name << std::endl;
+                return false;
+            }
+            out.faceCount = 6;
+        }
+    }
+
+    if (!ValidateDimensions(out, width, height, name))
+        return false;
+
+    // Orden en el archivo: por cada capa/cara, todos sus mips
+    const size_t available = size - dataOffset;
+    size_t offset = 0;
+    out.levels.clear();
+    for (int layer = 0; layer < out.layerCount * out.faceCount; ++layer)
+    {
+        for (int mip = 0; mip < out.mipCount; ++mip)
+        {
+            TextureImporter::Level level;
+            level.width = std::max(1, width >> mip);
+            level.height = std::max(1, height >> mip);
+            level.mip = mip;
+            level.layer = layer;
+            level.offset = offset;
+            level.size = TextureImporter::GetLevelSize(out.format, level.width, level.height);
+
+            if (level.size > available - offset)
+            {
+                std::cerr << "[TextureContainer] Truncated DDS (level " << mip << " of layer " << layer
+                    << " ends past the " << available << " bytes of image data): " << name << std::endl;
+                return false;
+            }
+
+            out.levels.push_back(level);
+            offset += level.size;
+        }
+    }
+
+    out.data.clear();
+    out.view = bytes + dataOffset;
+    return true;
+}
+
+bool TextureContainer::ParseKTX2(const void* data, size_t size, TextureImporter::CompressedImage& out, const std::string& name)
+{
+    const unsigned char* bytes = (const unsigned char*)data;
+    if (size < KTX2_HEADER_SIZE || memcmp(bytes, KTX2_IDENTIFIER, sizeof(KTX2_IDENTIFIER)) != 0)
+    {
+        std::cerr << "[TextureContainer] Invalid KTX2 header: " << name << std::endl;
+        return false;
+    }
+
+    uint32_t vkFormat = ReadU32(bytes + 12);
+    int width = (int)ReadU32(bytes + 20);
+    int height = (int)ReadU32(bytes + 24);
+    uint32_t depth = ReadU32(bytes + 28);
+    uint32_t layerCount = ReadU32(bytes + 32);
+    uint32_t faceCount = ReadU32(bytes + 36);
+    uint32_t levelCount = ReadU32(bytes + 40);
+    uint32_t supercompression = ReadU32(bytes + 44);
+
+    out.format = FromVkFormat(vkFormat);
+    if (out.format == TextureImporter::Format::NONE)
+    {
+        std::cerr << "[TextureContainer] Unsupported KTX2 format (VkFormat " << vkFormat << "): " << name << std::endl;
+        return false;
+    }
+    if (supercompression != 0)
+    {
+        std::cerr << "[TextureContainer] Supercompressed KTX2 (Basis/Zstd) is not supported: " << name << std::endl;
+        return false;
+    }
+    if (depth > 1 || (faceCount != 1 && faceCount != 6))
+    {
+        std::cerr << "[TextureContainer] Only 2D, array and cubemap KTX2 textures are supported: " << name << std::endl;
+        return false;
+    }
+
+    out.mipCount = (int)std::max(1u, std::min<uint32_t>(levelCount, 32));
+    out.layerCount = (int)std::min<uint32_t>(std::max(1u, layerCount), MAX_ARRAY_LAYERS + 1);
+    out.faceCount = (int)faceCount;
+
+    if (!ValidateDimensions(out, width, height, name))
+        return false;
+
+    if (size < KTX2_HEADER_SIZE + KTX2_LEVEL_ENTRY_SIZE * out.mipCount)
+    {
+        std::cerr << "[TextureContainer] Truncated KTX2 level index: " << name << std::endl;
+        return false;
+    }
+
+    // Cada nivel guarda sus capas y caras seguidas; el índice da su posición en el archivo
+    const int images = out.layerCount * out.faceCount;
+    out.levels.clear();
+    for (int mip = 0; mip < out.mipCount; ++mip)
+    {
+        const unsigned char* entry = bytes + KTX2_HEADER_SIZE + KTX2_LEVEL_ENTRY_SIZE * mip;
+        uint64_t byteOffset = ReadU64(entry);
+        uint64_t byteLength = ReadU64(entry + 8);
+
+        int levelWidth = std::max(1, width >> mip);
+        int levelHeight = std::max(1, height >> mip);
+        size_t imageSize = TextureImporter::GetLevelSize(out.format, levelWidth, levelHeight);
+
+        if (byteOffset > size || byteLength > size - byteOffset || byteLength < (uint64_t)imageSize * images)
+        {
+            std::cerr << "[TextureContainer] KTX2 level " << mip << " is out of bounds: " << name << std::endl;
+            return false;
+        }
+
+        for (int layer = 0; layer < images; ++layer)
+        {
+            TextureImporter::Level level;
+            level.width = levelWidth;
+            level.height = levelHeight;
+            level.mip = mip;
+            level.layer = layer;
+            level.offset = (size_t)byteOffset + imageSize * layer;
+            level.size = imageSize;
+            out.levels.push_back(level);
+        }
+    }
+
+    out.data.clear();
+    out.view = bytes;
+    return true;
+}
+
+GLuint TextureContainer::Upload(const TextureImporter::CompressedImage& image, GLenum& target)
+{
+    if (!IsFormatSupported(image.format))
+    {
+        std::cerr << "[TextureContainer] Format not supported by this GPU/driver" << std::endl;
+        return 0;
+    }
+    if (image.faceCount == 6 && image.layerCount > 1)
+    {
+        std::cerr << "[TextureContainer] Cubemap arrays need GL 4.0" << std::endl;
+        return 0;
+    }
+
+    const GLenum glFormat = TextureImporter::GetGLFormat(image.format);
+    const unsigned char* bytes = image.GetBytes();
+
+    if (image.faceCount == 6)
+        target = GL_TEXTURE_CUBE_MAP;
+    else if (image.layerCount > 1)
+        target = GL_TEXTURE_2D_ARRAY;
+    else
+        target = GL_TEXTURE_2D;
+
+    GLuint texID;
+    glGenTextures(1, &texID);
+    glBindTexture(target, texID);
+
+    if (target == GL_TEXTURE_2D_ARRAY)
+    {
+        // Reservar cada mip con todas las capas y rellenar capa a capa
+        for (int mip = 0; mip < image.mipCount; ++mip)
+        {
+            int w = std::max(1, image.levels[0].width >> mip);
+            int h = std::max(1, image.levels[0].height >> mip);
+            GLsizei layerSize = (GLsizei)TextureImporter::GetLevelSize(image.format, w, h);
+            glCompressedTexImage3D(target, mip, glFormat, w, h, image.layerCount, 0, layerSize * image.layerCount, nullptr);
+        }
+        for (const TextureImporter::Level& level : image.levels)
+        {
+            glCompressedTexSubImage3D(target, level.mip, 0, 0, level.layer, level.width, level.height, 1,
+                glFormat, (GLsizei)level.size, bytes + level.offset);
+        }
+    }
+    else
+    {
+        for (const TextureImporter::Level& level : image.levels)
+        {
+            GLenum face = (target == GL_TEXTURE_CUBE_MAP) ? GL_TEXTURE_CUBE_MAP_POSITIVE_X + level.layer : GL_TEXTURE_2D;
+            glCompressedTexImage2D(face, level.mip, glFormat, level.width, level.height, 0,
+                (GLsizei)level.size, bytes + level.offset);
+        }
+    }
+
+    const GLint wrap = (target == GL_TEXTURE_CUBE_MAP) ? GL_CLAMP_TO_EDGE : GL_REPEAT;
+    glTexParameteri(target, GL_TEXTURE_BASE_LEVEL, 0);
+    glTexParameteri(target, GL_TEXTURE_MAX_LEVEL, image.mipCount - 1);
+    glTexParameteri(target, GL_TEXTURE_WRAP_S, wrap);
+    glTexParameteri(target, GL_TEXTURE_WRAP_T, wrap);
+    glTexParameteri(target, GL_TEXTURE_MIN_FILTER, image.mipCount > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+    glTexParameteri(target, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+    return texID;
+}
+
+bool TextureContainer::IsFormatSupported(TextureImporter::Format format)
+{
+    if (format != TextureImporter::Format::BC6H_UF16 && format != TextureImporter::Format::BC6H_SF16
+        && format != TextureImporter::Format::BC7)
+        return format != TextureImporter::Format::NONE;
+
+    // BPTC es core en 4.2; en contextos 3.3 depende de la extensión
+    static int bptcSupported = -1;
+    if (bptcSupported < 0)
+    {
+        GLint major = 0, minor = 0, extensionCount = 0;
+        glGetIntegerv(GL_MAJOR_VERSION, &major);
+        glGetIntegerv(GL_MINOR_VERSION, &minor);
+        bptcSupported = (major > 4 || (major == 4 && minor >= 2)) ? 1 : 0;
+
+        glGetIntegerv(GL_NUM_EXTENSIONS, &extensionCount);
+        for (GLint i = 0; i < extensionCount && !bptcSupported; ++i)
+        {
+            const char* extension = (const char*)glGetStringi(GL_EXTENSIONS, i);
+            if (extension && strcmp(extension, "GL_ARB_texture_compression_bptc") == 0)
+                bptcSupported = 1;
+        }
+    }
+    return bptcSupported == 1;
+}
@@ -0,0 +1,25 @@
+#pragma once
+#include <glad/glad.h>
+#include <string>
+#include "TextureImporter.h"
+
+// Lectura de contenedores de texturas ya comprimidas (.dds con o sin cabecera
+// DX10, .ktx2 sin supercompresión). No copia nada: los niveles del resultado
+// apuntan a los bytes recibidos, que normalmente vienen de un MappedFile.
+class TextureContainer
+{
+public:
+    // Detecta el contenedor por la firma. Comprueba que todos los niveles
+    // caben en size; name solo se usa para los mensajes de error.
+    static bool Parse(const void* data, size_t size, TextureImporter::CompressedImage& out, const std::string& name);
+
+    static bool ParseDDS(const void* data, size_t size, TextureImporter::CompressedImage& out, const std::string& name);
+    static bool ParseKTX2(const void* data, size_t size, TextureImporter::CompressedImage& out, const std::string& name);
+
+    // Crea la textura de GL (2D, 2D array o cubemap según la imagen) y sube
+    // todos los niveles. Devuelve 0 si el formato no está soportado.
+    static GLuint Upload(const TextureImporter::CompressedImage& image, GLenum& target);
+
+    // BCn de S3TC y RGTC siempre; BC6H/BC7 solo con BPTC (solo en el hilo de GL)
+    static bool IsFormatSupported(TextureImporter::Format format);
+};
@@ -0,0 +1,228 @@
+#include "TextureImporter.h"
+#include "FileUtils.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+#define STB_DXT_IMPLEMENTATION
+#include <stb_dxt.h>
+
+bool TextureImporter::compressOnImport = true;
+std::string TextureImporter::cacheDirectory = "../Library/Textures";
+
+namespace
+{
+    const uint32_t DDS_MAGIC = 0x20534444; // "DDS "
+    const uint32_t FOURCC_DXT1 = 0x31545844;
+    const uint32_t FOURCC_DXT3 = 0x33545844;
+    const uint32_t FOURCC_DXT5 = 0x35545844;
+    const uint32_t FOURCC_ATI2 = 0x32495441;
+
+    void WriteU32(unsigned char* p, uint32_t v)
+    {
+        p[0] = (unsigned char)v;
+        p[1] = (unsigned char)(v >> 8);
+        p[2] = (unsigned char)(v >> 16);
+        p[3] = (unsigned char)(v >> 24);
+    }
+}
+
+TextureImporter::Format TextureImporter::ChooseFormat(const unsigned char* rgba, int width, int height)
+{
+    size_t pixelCount = (size_t)width * height;
+    for (size_t i = 0; i < pixelCount; ++i)
+    {
+        if (rgba[i * 4 + 3] != 255)
+            return Format::BC3;
+    }
+    return Format::BC1;
+}
+
+void TextureImporter::CompressLevel(const unsigned char* rgba, int width, int height, CompressedImage& out)
+{
+    Level level;
+    level.width = width;
+    level.height = height;
+    level.mip = (int)out.levels.size();
+    level.offset = out.data.size();
+    level.size = GetLevelSize(out.format, width, height);
+    out.data.resize(level.offset + level.size);
+
+    const int blockSize = GetBlockSize(out.format);
+    unsigned char* dst = out.data.data() + level.offset;
+
+    unsigned char block[16 * 4];
+    unsigned char rg[16 * 2];
+
+    for (int by = 0; by < height; by += 4)
+    {
+        for (int bx = 0; bx < width; bx += 4)
+        {
+            // Los bloques del borde repiten el último píxel
+            for (int y = 0; y < 4; ++y)
+            {
+                int sy = std::min(by + y, height - 1);
+                for (int x = 0; x < 4; ++x)
+                {
+                    int sx = std::min(bx + x, width - 1);
+                    memcpy(&block[(y * 4 + x) * 4], &rgba[((size_t)sy * width + sx) * 4], 4);
+                }
+            }
+
+            switch (out.format)
+            {
+            case Format::BC1:
+                stb_compress_dxt_block(dst, block, 0, STB_DXT_HIGHQUAL);
+                break;
+            case Format::BC3:
+                stb_compress_dxt_block(dst, block, 1, STB_DXT_HIGHQUAL);
+                break;
+            case Format::BC5:
+                for (int i = 0; i < 16; ++i)
+                {
+                    rg[i * 2] = block[i * 4];
+                    rg[i * 2 + 1] = block[i * 4 + 1];
+                }
+                stb_compress_bc5_block(dst, rg);
+                break;
+            default:
+                break;
+            }
+            dst += blockSize;
+        }
+    }
+
+    out.levels.push_back(level);
+    out.mipCount = (int)out.levels.size();
+}
+
+bool TextureImporter::SaveDDS(const std::string& path, const CompressedImage& image)
+{
+    uint32_t fourCC = 0;
+    switch (image.format)
+    {
+    case Format::BC1: fourCC = FOURCC_DXT1; break;
+    case Format::BC2: fourCC = FOURCC_DXT3; break;
+    case Format::BC3: fourCC = FOURCC_DXT5; break;
+    case Format::BC5: fourCC = FOURCC_ATI2; break;
+    default: return false;
+    }
+    if (image.levels.empty() || image.layerCount != 1 || image.faceCount != 1 || image.view)
+        return false;
+
+    unsigned char header[128] = {};
+    WriteU32(header + 0, DDS_MAGIC);
+    WriteU32(header + 4, 124);                                   // dwSize
+    WriteU32(header + 8, 0x1 | 0x2 | 0x4 | 0x1000 | 0x20000 | 0x80000); // CAPS|HEIGHT|WIDTH|PIXELFORMAT|MIPMAPCOUNT|LINEARSIZE
+    WriteU32(header + 12, (uint32_t)image.levels[0].height);
+    WriteU32(header + 16, (uint32_t)image.levels[0].width);
+    WriteU32(header + 20, (uint32_t)image.levels[0].size);
+    WriteU32(header + 28, (uint32_t)image.levels.size());
+    WriteU32(header + 76, 32);                                   // ddspf.dwSize
+    WriteU32(header + 80, 0x4);                                  // DDPF_FOURCC
+    WriteU32(header + 84, fourCC);
+    WriteU32(header + 108, 0x1000 | 0x400000 | 0x8);             // TEXTURE|MIPMAP|COMPLEX
+
+    // Se escribe en un temporal propio y se renombra para no dejar .dds a medias;
+    // dos jobs con el mismo hash pueden llegar aquí a la vez
+    std::string tempPath = FileUtils::MakeTempPath(path);
+    {
+        std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+        if (!file.is_open())
+        {
+            std::cerr << "[TextureImporter] Could not write: " << path << std::endl;
+            return false;
+        }
+        file.write((const char*)header, sizeof(header));
+        file.write((const char*)image.data.data(), image.data.size());
+        if (!file.good())
+        {
+            file.close();
+            std::remove(tempPath.c_str());
+            return false;
+        }
+    }
+
+    return FileUtils::RenameOver(tempPath, path);
+}
+
+std::string TextureImporter::GetCachePath(uint64_t contentHash)
+{
+    FileUtils::CreateDirectories(cacheDirectory);
+
+    std::ostringstream name;
+    name << cacheDirectory << "/" << std::hex << std::setw(16) << std::setfill('0') << contentHash << ".dds";
+    return name.str();
+}
+
+GLenum TextureImporter::GetGLFormat(Format format)
+{
+    switch (format)
+    {
+    case Format::BC1: return 0x83F1; // GL_COMPRESSED_RGBA_S3TC_DXT1_EXT
+    case Format::BC2: return 0x83F2; // GL_COMPRESSED_RGBA_S3TC_DXT3_EXT
+    case Format::BC3: return 0x83F3; // GL_COMPRESSED_RGBA_S3TC_DXT5_EXT
+    case Format::BC4: return GL_COMPRESSED_RED_RGTC1;
+    case Format::BC4_SNORM: return GL_COMPRESSED_SIGNED_RED_RGTC1;
+    case Format::BC5: return GL_COMPRESSED_RG_RGTC2;
+    case Format::BC5_SNORM: return GL_COMPRESSED_SIGNED_RG_RGTC2;
+    case Format::BC6H_UF16: return 0x8E8F; // GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT
+    case Format::BC6H_SF16: return 0x8E8E; // GL_COMPRESSED_RGB_BPTC_SIGNED_FLOAT
+    case Format::BC7: return 0x8E8C; // GL_COMPRESSED_RGBA_BPTC_UNORM
+    default: return GL_RGBA8;
+    }
+}
+
+int TextureImporter::GetBlockSize(Format format)
+{
+    return GetBlockSize(GetGLFormat(format));
+}
+
+size_t TextureImporter::GetLevelSize(Format format, int width, int height)
+{
+    return GetLevelSize(GetGLFormat(format), width, height);
+}
+
+int TextureImporter::GetBlockSize(GLenum glFormat)
+{
+    switch (glFormat)
+    {
+    case 0x83F0: // GL_COMPRESSED_RGB_S3TC_DXT1_EXT
+    case 0x83F1:
+    case GL_COMPRESSED_RED_RGTC1:
+    case GL_COMPRESSED_SIGNED_RED_RGTC1:
+        return 8;
+    default:
+        return 16;
+    }
+}
+
+size_t TextureImporter::GetLevelSize(GLenum glFormat, int width, int height)
+{
+    return (size_t)((width + 3) / 4) * ((height + 3) / 4) * GetBlockSize(glFormat);
+}
+
+const char* TextureImporter::GetFormatName(GLenum glFormat)
+{
+    switch (glFormat)
+    {
+    case 0x83F0:
+    case 0x83F1: return "BC1";
+    case 0x83F2: return "BC2";
+    case 0x83F3: return "BC3";
+    case GL_COMPRESSED_RED_RGTC1:
+    case GL_COMPRESSED_SIGNED_RED_RGTC1: return "BC4";
+    case GL_COMPRESSED_RG_RGTC2:
+    case GL_COMPRESSED_SIGNED_RG_RGTC2: return "BC5";
+    case 0x8E8E:
+    case 0x8E8F: return "BC6H";
+    case 0x8E8C:
+    case 0x8E8D: return "BC7";
+    case GL_RGBA8: return "RGBA8";
+    default: return "Unknown";
+    }
+}
@@ -0,0 +1,79 @@
+#pragma once
+#include <glad/glad.h>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+// Paso de importación de texturas: comprime a BCn (con todos los mips) y guarda
+// el resultado en Library/Textures como .dds, indexado por el hash del archivo
+// original. Las siguientes cargas leen ese .dds y lo suben tal cual.
+class TextureImporter
+{
+public:
+    // El importador solo genera BC1/BC3 (BC5 sabe comprimirlo, pero ChooseFormat no
+    // lo elige todavía); el resto se aceptan al leer .dds/.ktx2
+    enum class Format
+    {
+        NONE,
+        BC1,        // RGB opaco, 4 bpp
+        BC2,        // DXT3
+        BC3,        // RGBA, 8 bpp
+        BC4,        // un canal, 4 bpp
+        BC4_SNORM,
+        BC5,        // dos canales (normal maps XY), 8 bpp
+        BC5_SNORM,
+        BC6H_UF16,  // HDR, necesita BPTC (GL 4.2 o ARB_texture_compression_bptc)
+        BC6H_SF16,
+        BC7         // RGBA de alta calidad, necesita BPTC
+    };
+
+    struct Level
+    {
+        int width = 0;
+        int height = 0;
+        int mip = 0;
+        int layer = 0;      // capa * faceCount + cara
+        size_t offset = 0;
+        size_t size = 0;
+    };
+
+    struct CompressedImage
+    {
+        Format format = Format::NONE;
+        int mipCount = 0;
+        int layerCount = 1;
+        int faceCount = 1;  // 6 en cubemaps
+
+        // Los niveles apuntan a data (generado por el importador) o a view
+        // (archivo proyectado en memoria, que debe seguir abierto)
+        std::vector<unsigned char> data;
+        const unsigned char* view = nullptr;
+        std::vector<Level> levels;
+
+        const unsigned char* GetBytes() const { return view ? view : data.data(); }
+    };
+
+    // Si es false las texturas se suben en RGBA8 como antes
+    static bool compressOnImport;
+    static std::string cacheDirectory;
+
+    // BC3 si hay alfa, BC1 en otro caso. BC5 no: el material solo tiene el slot
+    // difuso y el shader lee .rgb, un normal map en BC5 se vería rojo y verde
+    static Format ChooseFormat(const unsigned char* rgba, int width, int height);
+
+    // Comprime un nivel RGBA8 y lo añade al final de out
+    static void CompressLevel(const unsigned char* rgba, int width, int height, CompressedImage& out);
+
+    static bool SaveDDS(const std::string& path, const CompressedImage& image);
+
+    // Ruta del .dds cacheado para un hash de contenido (crea la carpeta si hace falta)
+    static std::string GetCachePath(uint64_t contentHash);
+
+    static GLenum GetGLFormat(Format format);
+    static int GetBlockSize(Format format);
+    static size_t GetLevelSize(Format format, int width, int height);
+    // Lo mismo a partir del formato de GL (incluye el DXT1 RGB, que no genera el importador)
+    static int GetBlockSize(GLenum glFormat);
+    static size_t GetLevelSize(GLenum glFormat, int width, int height);
+    static const char* GetFormatName(GLenum glFormat);
+};
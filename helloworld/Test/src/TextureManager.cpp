@@ -0,0 +1,699 @@
+#include "TextureManager.h"
+#include "Profiler.h"
+#include "MemoryTracker.h"
+#include "Logger.h"
+#include "TextureResource.h"
+#include "Texture.h"
+#include "TextureImporter.h"
+#include "TextureContainer.h"
+#include "TextureStreamer.h"
+#include "VirtualFileSystem.h"
+#include "JobSystem.h"
+#include "FileUtils.h"
+#include "RenderStats.h"
+#include <IL/il.h>
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+// Carga en curso: el worker rellena los píxeles (con mips, en RGBA8 o ya en BCn)
+// y el hilo principal los sube por tramos
+struct TextureManager::PendingTexture
+{
+    enum State { DECODING, DECODED, FAILED };
+
+    std::weak_ptr<TextureResource> resource;
+    std::string path;
+    bool isContainer = false;   // .dds / .ktx2 ya comprimidos
+    std::atomic<int> state{ DECODING };
+
+    // Resultado del worker (solo se lee cuando state == DECODED). Los niveles
+    // se copian al PBO desde source: pixels propios o el archivo proyectado
+    uint64_t hash = 0;
+    int channels = 0;
+    GLenum format = GL_RGBA8;
+    TextureImporter::Format compressedFormat = TextureImporter::Format::NONE;
+    std::vector<unsigned char> pixels;
+    VirtualFile mapped;
+    const unsigned char* source = nullptr;
+    std::vector<TextureImporter::Level> levels;
+    std::string sourceFile;     // .dds/.ktx2 del que se pueden volver a leer los mips
+
+    // Progreso de la subida
+    GLuint texID = 0;
+    size_t firstLevel = 0;      // > 0 si los mips grandes se dejan para el streamer
+    size_t level = 0;
+    int row = 0;
+};
+
+std::map<std::string, std::weak_ptr<TextureResource>> TextureManager::byPath;
+std::map<uint64_t, std::weak_ptr<TextureResource>> TextureManager::byContent;
+std::shared_ptr<TextureResource> TextureManager::defaultTexture;
+std::vector<std::shared_ptr<TextureManager::PendingTexture>> TextureManager::pending;
+GLuint TextureManager::uploadPBOs[TextureManager::UPLOAD_PBO_COUNT] = {};
+int TextureManager::nextPBO = 0;
+std::mutex TextureManager::devilMutex;
+size_t TextureManager::uploadBudgetBytes = 8 * 1024 * 1024;
+unsigned int TextureManager::hits = 0;
+unsigned int TextureManager::misses = 0;
+
+std::string TextureManager::NormalizePath(const std::string& path)
+{
+    return FileUtils::NormalizePath(path);
+}
+
+uint64_t TextureManager::HashContent(const void* data, size_t size)
+{
+    // FNV-1a de 64 bits
+    const unsigned char* bytes = (const unsigned char*)data;
+    uint64_t hash = 14695981039346656037ull;
+    for (size_t i = 0; i < size; ++i)
+    {
+        hash ^= bytes[i];
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+std::shared_ptr<TextureResource> TextureManager::Load(const std::string& path)
+{
+    MEMORY_TAG(TEXTURE);
+    if (path.empty())
+        return GetDefault();
+
+    std::string key = NormalizePath(path);
+
+    auto it = byPath.find(key);
+    if (it != byPath.end())
+    {
+        if (std::shared_ptr<TextureResource> existing = it->second.lock())
+        {
+            hits++;
+            return existing;
+        }
+    }
+
+    // Proyectar el archivo una vez: sirve para el hash y para decodificar desde memoria
+    VirtualFile file = VirtualFileSystem::Open(path);
+    if (!file.IsOpen())
+    {
+        std::cerr << "[TextureManager] Could not open: " << path << " -> using default texture" << std::endl;
+        return GetDefault();
+    }
+
+    uint64_t hash = HashContent(file.Data(), file.Size());
+
+    auto sameContent = byContent.find(hash);
+    if (sameContent != byContent.end())
+    {
+        if (std::shared_ptr<TextureResource> existing = sameContent->second.lock())
+        {
+            byPath[key] = existing;
+            hits++;
+            return existing;
+        }
+    }
+
+    std::string ext = path.substr(path.find_last_of('.') + 1);
+    for (auto& c : ext) c = (char)tolower(c);
+
+    std::shared_ptr<TextureResource> resource = LoadFromMemory(path, ext, file.Data(), file.Size(), hash);
+    if (!resource)
+        return GetDefault();
+
+    resource->TrackResidency(QueryTextureBytes(resource->id), true);
+    byPath[key] = resource;
+    byContent[hash] = resource;
+    misses++;
+
+    PurgeExpired();
+    return resource;
+}
+
+std::shared_ptr<TextureResource> TextureManager::LoadFromMemory(const std::string& path, const std::string& ext,
+    const void* data, size_t size, uint64_t hash)
+{
+    MEMORY_TAG(TEXTURE);
+    GLuint texID = 0;
+    int width = 0, height = 0, channels = 0;
+    GLint format = GL_RGBA8;
+
+    // Si ya se importó antes, se usa el .dds comprimido de la caché
+    std::string ddsPath = (ext == "dds" || ext == "ktx2") ? path : std::string();
+    if (ddsPath.empty() && TextureImporter::compressOnImport)
+    {
+        std::string cachePath = TextureImporter::GetCachePath(hash);
+        if (std::ifstream(cachePath, std::ios::binary).is_open())
+            ddsPath = cachePath;
+    }
+
+    if (!ddsPath.empty())
+    {
+        texID = Texture::LoadDDSTexture(ddsPath.c_str());
+        if (texID == 0)
+            return nullptr;
+
+        glBindTexture(GL_TEXTURE_2D, texID);
+        glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_WIDTH, &width);
+        glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_HEIGHT, &height);
+        glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_INTERNAL_FORMAT, &format);
+        channels = 4;
+    }
+    else
+    {
+        // DevIL para el resto de formatos (jpg, png, tga, bmp, etc.)
+        std::lock_guard<std::mutex> lock(devilMutex);
+        ILuint imgID;
+        ilGenImages(1, &imgID);
+        ilBindImage(imgID);
+
+        if (!ilLoadL(IL_TYPE_UNKNOWN, data, (ILuint)size) && !ilLoadImage(path.c_str()))
+        {
+            std::cerr << "[TextureManager] Failed to load: " << path << " -> using default texture" << std::endl;
+            ilDeleteImages(1, &imgID);
+            return nullptr;
+        }
+
+        ilConvertImage(IL_RGBA, IL_UNSIGNED_BYTE);
+
+        width = ilGetInteger(IL_IMAGE_WIDTH);
+        height = ilGetInteger(IL_IMAGE_HEIGHT);
+        channels = ilGetInteger(IL_IMAGE_CHANNELS);
+
+        glGenTextures(1, &texID);
+        glBindTexture(GL_TEXTURE_2D, texID);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, ilGetData());
+        glGenerateMipmap(GL_TEXTURE_2D);
+
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+        ilDeleteImages(1, &imgID);
+    }
+
+    LOG_DEBUG(TEXTURE, "Loaded texture: {} ({}x{})", path, width, height);
+
+    std::shared_ptr<TextureResource> resource = std::make_shared<TextureResource>(texID, width, height, channels, path, hash);
+    resource->format = (GLenum)format;
+    return resource;
+}
+
+std::shared_ptr<TextureResource> TextureManager::LoadAsync(const std::string& path)
+{
+    MEMORY_TAG(TEXTURE);
+    if (path.empty())
+        return GetDefault();
+
+    std::string key = NormalizePath(path);
+
+    auto it = byPath.find(key);
+    if (it != byPath.end())
+    {
+        if (std::shared_ptr<TextureResource> existing = it->second.lock())
+        {
+            hits++;
+            return existing;
+        }
+    }
+
+    if (!VirtualFileSystem::Exists(path))
+    {
+        std::cerr << "[TextureManager] Could not open: " << path << " -> using default texture" << std::endl;
+        return GetDefault();
+    }
+
+    std::shared_ptr<TextureResource> resource = std::make_shared<TextureResource>(0, 0, 0, 0, path);
+    resource->fallback = GetDefault();
+    resource->ready = false;
+    byPath[key] = resource;
+    misses++;
+
+    Enqueue(resource, path);
+    return resource;
+}
+
+void TextureManager::Reload(const std::shared_ptr<TextureResource>& resource)
+{
+    if (!resource || resource->path.empty())
+        return;
+
+    LOG_DEBUG(TEXTURE, "Reloading evicted texture: {}", resource->path);
+    Enqueue(resource, resource->path);
+}
+
+void TextureManager::Enqueue(const std::shared_ptr<TextureResource>& resource, const std::string& path)
+{
+    std::shared_ptr<PendingTexture> job = std::make_shared<PendingTexture>();
+    job->resource = resource;
+    job->path = path;
+
+    std::string ext = path.substr(path.find_last_of('.') + 1);
+    for (auto& c : ext) c = (char)tolower(c);
+    job->isContainer = (ext == "dds" || ext == "ktx2");
+
+    pending.push_back(job);
+    JobSystem::Submit([job]() { DecodeJob(*job); });
+}
+
+void TextureManager::DecodeJob(PendingTexture& job)
+{
+    PROFILE_SCOPE("Texture decode");
+    MEMORY_TAG(TEXTURE);
+    VirtualFile file = VirtualFileSystem::Open(job.path);
+    if (!file.IsOpen())
+    {
+        job.state = PendingTexture::FAILED;
+        return;
+    }
+
+    job.hash = HashContent(file.Data(), file.Size());
+
+    // Los .dds/.ktx2 ya vienen comprimidos y con mips: los niveles se suben
+    // directamente desde el archivo proyectado
+    TextureImporter::CompressedImage image;
+    if (job.isContainer)
+    {
+        if (!TextureContainer::Parse(file.Data(), file.Size(), image, job.path) || image.layerCount != 1 || image.faceCount != 1)
+        {
+            job.state = PendingTexture::FAILED;
+            return;
+        }
+        job.mapped = std::move(file);
+        job.sourceFile = job.path;
+        SetCompressedResult(job, image);
+        job.state = PendingTexture::DECODED;
+        return;
+    }
+
+    // Importada en otra sesión: usar el .dds de la caché en lugar de decodificar.
+    // Los BC5 son de versiones que elegían el formato por el nombre: se reimportan
+    std::string cachePath;
+    if (TextureImporter::compressOnImport)
+    {
+        cachePath = TextureImporter::GetCachePath(job.hash);
+        VirtualFile cached = VirtualFileSystem::Open(cachePath);
+        if (cached.IsOpen() && TextureContainer::ParseDDS(cached.Data(), cached.Size(), image, cachePath)
+            && image.format != TextureImporter::Format::BC5)
+        {
+            job.mapped = std::move(cached);
+            job.sourceFile = cachePath;
+            SetCompressedResult(job, image);
+            job.state = PendingTexture::DECODED;
+            return;
+        }
+    }
+
+    int width = 0, height = 0;
+    {
+        std::lock_guard<std::mutex> lock(devilMutex);
+
+        ILuint imgID;
+        ilGenImages(1, &imgID);
+        ilBindImage(imgID);
+
+        if (!ilLoadL(IL_TYPE_UNKNOWN, file.Data(), (ILuint)file.Size()))
+        {
+            ilDeleteImages(1, &imgID);
+            job.state = PendingTexture::FAILED;
+            return;
+        }
+
+        ilConvertImage(IL_RGBA, IL_UNSIGNED_BYTE);
+        width = ilGetInteger(IL_IMAGE_WIDTH);
+        height = ilGetInteger(IL_IMAGE_HEIGHT);
+        job.channels = ilGetInteger(IL_IMAGE_CHANNELS);
+
+        // Reservar la cadena de mips completa de una vez (~4/3 del nivel base)
+        size_t baseSize = (size_t)width * height * 4;
+        job.pixels.reserve(baseSize + baseSize / 3 + 16);
+        job.pixels.assign(ilGetData(), ilGetData() + baseSize);
+
+        ilDeleteImages(1, &imgID);
+    }
+
+    // Mips en CPU con filtro de caja 2x2 (lo que antes hacía glGenerateMipmap)
+    TextureImporter::Level base;
+    base.width = width;
+    base.height = height;
+    base.size = (size_t)width * height * 4;
+    job.levels.push_back(base);
+
+    while (job.levels.back().width > 1 || job.levels.back().height > 1)
+    {
+        const TextureImporter::Level src = job.levels.back();
+        TextureImporter::Level dst;
+        dst.width = std::max(1, src.width / 2);
+        dst.height = std::max(1, src.height / 2);
+        dst.offset = job.pixels.size();
+        dst.size = (size_t)dst.width * dst.height * 4;
+
+        job.pixels.resize(dst.offset + dst.size);
+        const unsigned char* in = job.pixels.data() + src.offset;
+        unsigned char* out = job.pixels.data() + dst.offset;
+
+        for (int y = 0; y < dst.height; ++y)
+        {
+            int y0 = std::min(y * 2, src.height - 1);
+            int y1 = std::min(y * 2 + 1, src.height - 1);
+            for (int x = 0; x < dst.width; ++x)
+            {
+                int x0 = std::min(x * 2, src.width - 1);
+                int x1 = std::min(x * 2 + 1, src.width - 1);
+                for (int c = 0; c < 4; ++c)
+                {
+                    int sum = in[((size_t)y0 * src.width + x0) * 4 + c] + in[((size_t)y0 * src.width + x1) * 4 + c]
+                        + in[((size_t)y1 * src.width + x0) * 4 + c] + in[((size_t)y1 * src.width + x1) * 4 + c];
+                    out[((size_t)y * dst.width + x) * 4 + c] = (unsigned char)((sum + 2) / 4);
+                }
+            }
+        }
+
+        job.levels.push_back(dst);
+    }
+
+    // Importación: comprimir todos los niveles y guardarlos para las próximas cargas
+    if (TextureImporter::compressOnImport)
+    {
+        image = TextureImporter::CompressedImage();
+        image.format = TextureImporter::ChooseFormat(job.pixels.data(), width, height);
+        for (const TextureImporter::Level& level : job.levels)
+            TextureImporter::CompressLevel(job.pixels.data() + level.offset, level.width, level.height, image);
+
+        if (TextureImporter::SaveDDS(cachePath, image))
+            job.sourceFile = cachePath;
+        SetCompressedResult(job, image);
+    }
+    else
+    {
+        job.source = job.pixels.data();
+    }
+
+    job.state = PendingTexture::DECODED;
+}
+
+void TextureManager::SetCompressedResult(PendingTexture& job, TextureImporter::CompressedImage& image)
+{
+    job.format = TextureImporter::GetGLFormat(image.format);
+    job.compressedFormat = image.format;
+    job.levels = std::move(image.levels);
+    if (image.view)
+    {
+        // La proyección la guarda job.mapped
+        job.pixels.clear();
+        job.source = image.view;
+    }
+    else
+    {
+        job.pixels = std::move(image.data);
+        job.source = job.pixels.data();
+    }
+    if (job.channels == 0)
+        job.channels = 4;
+}
+
+bool TextureManager::UploadStep(PendingTexture& job, TextureResource& resource, size_t& budget)
+{
+    if (job.texID == 0)
+    {
+        // En RGBA8 se reservan todos los niveles sin datos y se rellenan por tramos
+        // desde los PBO; los comprimidos se suben nivel a nivel completos
+        glGenTextures(1, &job.texID);
+        glBindTexture(GL_TEXTURE_2D, job.texID);
+        if (job.format == GL_RGBA8)
+        {
+            for (size_t i = 0; i < job.levels.size(); ++i)
+            {
+                glTexImage2D(GL_TEXTURE_2D, (GLint)i, GL_RGBA8, job.levels[i].width, job.levels[i].height,
+                    0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+            }
+        }
+        else if (TextureStreamer::enabled && !job.sourceFile.empty())
+        {
+            // Solo los mips pequeños; el resto los sube TextureStreamer cuando se vean de cerca
+            job.firstLevel = (size_t)TextureStreamer::GetInitialMip(job.levels);
+            job.level = job.firstLevel;
+        }
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, (GLint)job.firstLevel);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, (GLint)job.levels.size() - 1);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    }
+
+    if (uploadPBOs[0] == 0)
+        glGenBuffers(UPLOAD_PBO_COUNT, uploadPBOs);
+
+    glBindTexture(GL_TEXTURE_2D, job.texID);
+
+    while (job.level < job.levels.size())
+    {
+        const TextureImporter::Level& mip = job.levels[job.level];
+        const bool compressed = (job.format != GL_RGBA8);
+        const size_t rowBytes = (size_t)mip.width * 4;
+
+        // Siempre al menos una fila (o un nivel comprimido) para no quedarse
+        // atascado con budgets pequeños
+        int rows = mip.height - job.row;
+        if (!compressed)
+            rows = std::min(rows, (int)std::max<size_t>(1, budget / rowBytes));
+        const size_t bytes = compressed ? mip.size : rowBytes * rows;
+
+        // Anillo de PBOs huérfanos: el driver no tiene que esperar a que la GPU
+        // termine de leer el tramo anterior
+        GLuint pbo = uploadPBOs[nextPBO];
+        nextPBO = (nextPBO + 1) % UPLOAD_PBO_COUNT;
+
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, pbo);
+        glBufferData(GL_PIXEL_UNPACK_BUFFER, bytes, nullptr, GL_STREAM_DRAW);
+        void* dst = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, bytes, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+        if (dst)
+        {
+            memcpy(dst, job.source + mip.offset + (compressed ? 0 : rowBytes * job.row), bytes);
+            glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+            RenderStats::CountBufferUpload(bytes);
+            if (compressed)
+            {
+                glCompressedTexImage2D(GL_TEXTURE_2D, (GLint)job.level, job.format, mip.width, mip.height,
+                    0, (GLsizei)bytes, (void*)0);
+            }
+            else
+            {
+                glTexSubImage2D(GL_TEXTURE_2D, (GLint)job.level, 0, job.row, mip.width, rows,
+                    GL_RGBA, GL_UNSIGNED_BYTE, (void*)0);
+            }
+        }
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+        job.row += rows;
+        if (job.row >= mip.height)
+        {
+            job.level++;
+            job.row = 0;
+        }
+
+        budget = bytes >= budget ? 0 : budget - bytes;
+        if (budget == 0)
+            break;
+    }
+
+    if (job.level < job.levels.size())
+        return false;
+
+    // Subida completa: el recurso deja de usar el placeholder
+    resource.id = job.texID;
+    resource.width = job.levels[0].width;
+    resource.height = job.levels[0].height;
+    resource.channels = job.channels;
+    resource.format = job.format;
+    job.texID = 0;
+    return true;
+}
+
+void TextureManager::Update()
+{
+    MEMORY_TAG(TEXTURE);
+    size_t budget = uploadBudgetBytes;
+
+    for (size_t i = 0; i < pending.size();)
+    {
+        PendingTexture& job = *pending[i];
+        std::shared_ptr<TextureResource> resource = job.resource.lock();
+        int state = job.state.load();
+
+        // Nadie la usa ya: descartar (el worker puede seguir, pero su resultado se ignora)
+        if (!resource)
+        {
+            if (job.texID != 0)
+                glDeleteTextures(1, &job.texID);
+            pending.erase(pending.begin() + i);
+            continue;
+        }
+
+        if (state == PendingTexture::DECODING || (budget == 0 && state == PendingTexture::DECODED))
+        {
+            ++i;
+            continue;
+        }
+
+        bool finished = true;
+        if (state == PendingTexture::FAILED)
+        {
+            std::cerr << "[TextureManager] Failed to load: " << job.path << " -> using default texture" << std::endl;
+            resource->failed = true;
+        }
+        else if (job.texID == 0 && job.level == 0)
+        {
+            // Mismo contenido que una textura ya residente: compartirla
+            auto sameContent = byContent.find(job.hash);
+            std::shared_ptr<TextureResource> existing = sameContent != byContent.end() ? sameContent->second.lock() : nullptr;
+            if (existing && existing != resource && existing->IsReady() && !existing->HasFailed())
+            {
+                resource->fallback = existing;
+                resource->width = existing->GetWidth();
+                resource->height = existing->GetHeight();
+                resource->channels = existing->GetChannels();
+                resource->format = existing->GetFormat();
+            }
+            else if (job.format != GL_RGBA8 && !TextureContainer::IsFormatSupported(job.compressedFormat))
+            {
+                std::cerr << "[TextureManager] " << TextureImporter::GetFormatName(job.format)
+                    << " is not supported by this GPU: " << job.path << " -> using default texture" << std::endl;
+                resource->failed = true;
+            }
+            else
+            {
+                finished = UploadStep(job, *resource, budget);
+            }
+        }
+        else
+        {
+            finished = UploadStep(job, *resource, budget);
+        }
+
+        if (!finished)
+        {
+            ++i;
+            continue;
+        }
+
+        if (resource->id != 0 && job.firstLevel > 0)
+            TextureStreamer::Register(resource, job.sourceFile, job.compressedFormat, job.levels, (int)job.firstLevel);
+
+        resource->contentHash = job.hash;
+        resource->ready = true;
+        if (resource->id != 0)
+        {
+            size_t bytes = 0;
+            for (size_t level = job.firstLevel; level < job.levels.size(); ++level)
+                bytes += job.levels[level].size;
+            resource->TrackResidency(bytes, true);
+
+            resource->fallback.reset();
+            byContent[job.hash] = resource;
+            LOG_DEBUG(TEXTURE, "Streamed texture: {} ({}x{}, {})", job.path, resource->width, resource->height,
+                TextureImporter::GetFormatName(resource->format));
+        }
+        pending.erase(pending.begin() + i);
+    }
+}
+
+std::shared_ptr<TextureResource> TextureManager::GetDefault()
+{
+    if (!defaultTexture)
+    {
+        GLuint texID = Texture::CreateCheckerboardTexture(512, 512, 32);
+        defaultTexture = std::make_shared<TextureResource>(texID, 512, 512, 3, "checkerboard_default");
+        defaultTexture->TrackResidency(QueryTextureBytes(texID), false);
+    }
+    return defaultTexture;
+}
+
+size_t TextureManager::QueryTextureBytes(GLuint texID)
+{
+    // Suma de los niveles que tiene definidos la textura (comprimidos o RGBA8)
+    size_t total = 0;
+    glBindTexture(GL_TEXTURE_2D, texID);
+    for (GLint level = 0; level < 16; ++level)
+    {
+        GLint width = 0, height = 0, compressed = GL_FALSE;
+        glGetTexLevelParameteriv(GL_TEXTURE_2D, level, GL_TEXTURE_WIDTH, &width);
+        glGetTexLevelParameteriv(GL_TEXTURE_2D, level, GL_TEXTURE_HEIGHT, &height);
+        if (width == 0 || height == 0)
+            break;
+
+        glGetTexLevelParameteriv(GL_TEXTURE_2D, level, GL_TEXTURE_COMPRESSED, &compressed);
+        if (compressed)
+        {
+            GLint size = 0;
+            glGetTexLevelParameteriv(GL_TEXTURE_2D, level, GL_TEXTURE_COMPRESSED_IMAGE_SIZE, &size);
+            total += (size_t)size;
+        }
+        else
+        {
+            total += (size_t)width * height * 4;
+        }
+    }
+    glBindTexture(GL_TEXTURE_2D, 0);
+    return total;
+}
+
+void TextureManager::PurgeExpired()
+{
+    for (auto it = byPath.begin(); it != byPath.end();)
+    {
+        if (it->second.expired())
+            it = byPath.erase(it);
+        else
+            ++it;
+    }
+
+    for (auto it = byContent.begin(); it != byContent.end();)
+    {
+        if (it->second.expired())
+            it = byContent.erase(it);
+        else
+            ++it;
+    }
+}
+
+void TextureManager::Clear()
+{
+    // Las subidas a medias se descartan; los workers que sigan decodificando
+    // solo tienen su propia copia del trabajo
+    for (const std::shared_ptr<PendingTexture>& job : pending)
+    {
+        if (job->texID != 0)
+            glDeleteTextures(1, &job->texID);
+    }
+    pending.clear();
+    TextureStreamer::Clear();
+
+    if (uploadPBOs[0] != 0)
+    {
+        glDeleteBuffers(UPLOAD_PBO_COUNT, uploadPBOs);
+        for (GLuint& pbo : uploadPBOs)
+            pbo = 0;
+    }
+
+    defaultTexture.reset();
+    byPath.clear();
+    byContent.clear();
+}
+
+size_t TextureManager::GetLoadedCount()
+{
+    size_t count = 0;
+    for (const auto& entry : byContent)
+    {
+        if (!entry.second.expired())
+            count++;
+    }
+    return count + (defaultTexture ? 1 : 0);
+}
@@ -0,0 +1,75 @@
+#pragma once
+#include <glad/glad.h>
+#include "TextureImporter.h"
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+class TextureResource;
+
+// Caché de texturas indexada por ruta normalizada y por hash del contenido
+// (dos rutas distintas al mismo archivo, o copias idénticas, comparten textura).
+// Guarda weak_ptr: la textura se libera al soltar la última referencia.
+class TextureManager
+{
+public:
+    // Devuelve la textura ya cargada o la carga. Si falla, devuelve la textura por defecto.
+    static std::shared_ptr<TextureResource> Load(const std::string& path);
+
+    // Igual que Load pero sin bloquear: decodifica y genera mips en el JobSystem y
+    // la sube en varios frames. Hasta entonces el recurso muestra el checkerboard.
+    static std::shared_ptr<TextureResource> LoadAsync(const std::string& path);
+
+    // Vuelve a encolar la carga de una textura expulsada de la VRAM
+    static void Reload(const std::shared_ptr<TextureResource>& resource);
+
+    // Avanza las subidas pendientes (hilo principal, una vez por frame)
+    static void Update();
+    static size_t GetPendingCount() { return pending.size(); }
+
+    // Bytes que se pueden subir por frame a través de los PBO
+    static size_t uploadBudgetBytes;
+
+    // DevIL guarda estado global: toda llamada a il* debe hacerse con este mutex
+    static std::mutex& GetDevILMutex() { return devilMutex; }
+
+    // Checkerboard compartido por todos los materiales sin textura
+    static std::shared_ptr<TextureResource> GetDefault();
+
+    // Suelta la textura por defecto y vacía las tablas (antes de destruir el contexto GL)
+    static void Clear();
+
+    static size_t GetLoadedCount();
+    static unsigned int GetHits() { return hits; }
+    static unsigned int GetMisses() { return misses; }
+
+    static std::string NormalizePath(const std::string& path);
+    static uint64_t HashContent(const void* data, size_t size);
+
+private:
+    struct PendingTexture;
+
+    static void DecodeJob(PendingTexture& job);
+    static void SetCompressedResult(PendingTexture& job, TextureImporter::CompressedImage& image);
+    static bool UploadStep(PendingTexture& job, TextureResource& resource, size_t& budget);
+    static std::shared_ptr<TextureResource> LoadFromMemory(const std::string& path, const std::string& ext,
+        const void* data, size_t size, uint64_t hash);
+    static void PurgeExpired();
+    static void Enqueue(const std::shared_ptr<TextureResource>& resource, const std::string& path);
+    static size_t QueryTextureBytes(GLuint texID);
+
+    static std::map<std::string, std::weak_ptr<TextureResource>> byPath;
+    static std::map<uint64_t, std::weak_ptr<TextureResource>> byContent;
+    static std::shared_ptr<TextureResource> defaultTexture;
+
+    static std::vector<std::shared_ptr<PendingTexture>> pending;
+    static constexpr int UPLOAD_PBO_COUNT = 3;
+    static GLuint uploadPBOs[UPLOAD_PBO_COUNT];
+    static int nextPBO;
+    static std::mutex devilMutex;
+    static unsigned int hits;
+    static unsigned int misses;
+};
@@ -0,0 +1,63 @@
+#include "TextureResource.h"
+#include "TextureManager.h"
+#include "TextureStreamer.h"
+#include <iostream>
+
+TextureResource::TextureResource(GLuint id, int width, int height, int channels, const std::string& path, uint64_t contentHash)
+    : id(id), width(width), height(height), channels(channels), path(path), contentHash(contentHash)
+{
+}
+
+TextureResource::~TextureResource()
+{
+    ResidencyManager::Unregister(residencyHandle);
+
+    if (id != 0)
+    {
+        glDeleteTextures(1, &id);
+        id = 0;
+    }
+}
+
+void TextureResource::TrackResidency(size_t bytes, bool evictable)
+{
+    if (residencyHandle != 0)
+        ResidencyManager::Resize(residencyHandle, bytes);
+    else
+        residencyHandle = ResidencyManager::Register(ResidencyManager::Category::TEXTURE, path, bytes, evictable ? this : nullptr);
+}
+
+void TextureResource::MarkUsed()
+{
+    if (evicted)
+    {
+        evicted = false;
+        TextureManager::Reload(shared_from_this());
+    }
+    else if (id == 0 && fallback)
+    {
+        // Copia por contenido o carga en curso: lo que se dibuja es el respaldo
+        fallback->MarkUsed();
+    }
+
+    ResidencyManager::Touch(residencyHandle);
+}
+
+bool TextureResource::EvictFromGPU()
+{
+    if (id == 0 || !ready)
+        return false;
+
+    // En streaming basta con soltar los mips grandes
+    if (TextureStreamer::GetResidentMip(this) >= 0)
+        return TextureStreamer::ReleaseMips(this);
+
+    // El resto se borra entero y se vuelve a cargar desde su archivo (o el .dds de la caché)
+    glDeleteTextures(1, &id);
+    id = 0;
+    fallback = TextureManager::GetDefault();
+    ready = false;
+    evicted = true;
+    ResidencyManager::Resize(residencyHandle, 0);
+    return true;
+}
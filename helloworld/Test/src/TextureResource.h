@@ -0,0 +1,62 @@
+#pragma once
+#include <glad/glad.h>
+#include <string>
+#include <memory>
+#include <cstdint>
+#include "ResidencyManager.h"
+
+// Textura de OpenGL compartida. La crea TextureManager y se destruye (con su
+// glDeleteTextures) cuando se suelta la última referencia.
+// Mientras se carga en segundo plano GetID() devuelve la textura de respaldo.
+// Si ResidencyManager la expulsa, vuelve a cargarse desde disco al usarse.
+class TextureResource : public ResidencyManager::Evictable, public std::enable_shared_from_this<TextureResource>
+{
+    friend class TextureManager;
+    friend class TextureStreamer;
+    friend class TextureArrayPool;
+
+private:
+    GLuint id = 0;
+    int width = 0;
+    int height = 0;
+    int channels = 0;
+    GLenum format = GL_RGBA8;   // GL_RGBA8 o el formato BCn comprimido
+    std::string path;
+    uint64_t contentHash = 0;
+
+    // Se usa mientras id == 0: placeholder durante la carga, o la textura
+    // con el mismo contenido que ya estaba cargada
+    std::shared_ptr<TextureResource> fallback;
+    bool ready = true;
+    bool failed = false;
+
+    ResidencyManager::Handle residencyHandle = 0;
+    bool evicted = false;
+
+    // Registra (o actualiza) los bytes de VRAM que ocupa
+    void TrackResidency(size_t bytes, bool evictable);
+
+public:
+    TextureResource(GLuint id, int width, int height, int channels, const std::string& path, uint64_t contentHash = 0);
+    ~TextureResource() override;
+
+    TextureResource(const TextureResource&) = delete;
+    TextureResource& operator=(const TextureResource&) = delete;
+
+    GLuint GetID() const { return id != 0 ? id : (fallback ? fallback->GetID() : 0); }
+    bool IsReady() const { return ready; }
+    bool HasFailed() const { return failed; }
+    int GetWidth() const { return width; }
+    int GetHeight() const { return height; }
+    int GetChannels() const { return channels; }
+    GLenum GetFormat() const { return format; }
+    const std::string& GetPath() const { return path; }
+    uint64_t GetContentHash() const { return contentHash; }
+
+    // Al dibujar con ella: cuenta para el LRU y la recarga si estaba expulsada
+    void MarkUsed();
+    bool IsEvicted() const { return evicted; }
+
+    // ResidencyManager::Evictable
+    bool EvictFromGPU() override;
+};
@@ -0,0 +1,267 @@
+#include "TextureStreamer.h"
+#include "TextureResource.h"
+#include "TextureContainer.h"
+#include "VirtualFileSystem.h"
+#include "Logger.h"
+#include <algorithm>
+#include <cmath>
+
+bool TextureStreamer::enabled = true;
+size_t TextureStreamer::vramBudgetBytes = 256 * 1024 * 1024;
+size_t TextureStreamer::streamBudgetBytes = 4 * 1024 * 1024;
+int TextureStreamer::initialMaxSize = 128;
+unsigned int TextureStreamer::keepFrames = 120;
+
+std::map<const TextureResource*, TextureStreamer::Entry> TextureStreamer::entries;
+size_t TextureStreamer::residentBytes = 0;
+uint64_t TextureStreamer::frame = 0;
+
+int TextureStreamer::GetInitialMip(const std::vector<TextureImporter::Level>& levels)
+{
+    for (size_t i = 0; i < levels.size(); ++i)
+    {
+        if (std::max(levels[i].width, levels[i].height) <= initialMaxSize)
+            return (int)i;
+    }
+    return levels.empty() ? 0 : (int)levels.size() - 1;
+}
+
+void TextureStreamer::Register(const std::shared_ptr<TextureResource>& resource, const std::string& sourcePath,
+    TextureImporter::Format format, const std::vector<TextureImporter::Level>& levels, int residentMip)
+{
+    if (!resource || levels.empty())
+        return;
+
+    Entry entry;
+    entry.resource = resource;
+    entry.sourcePath = sourcePath;
+    entry.format = format;
+    entry.levels = levels;
+    entry.initialMip = residentMip;
+    entry.residentMip = residentMip;
+    entry.requestedMip = residentMip;
+    entry.lastUsedFrame = frame;
+
+    // Al recargarse tras una expulsión la entrada anterior se sustituye
+    auto previous = entries.find(resource.get());
+    if (previous != entries.end())
+        residentBytes -= ResidentSize(previous->second, previous->second.residentMip);
+
+    residentBytes += ResidentSize(entry, residentMip);
+    entries[resource.get()] = entry;
+}
+
+void TextureStreamer::RequestSize(const TextureResource* resource, float screenPixels)
+{
+    // Las copias por contenido apuntan a la textura que realmente está en streaming
+    while (resource && resource->id == 0 && resource->fallback)
+        resource = resource->fallback.get();
+
+    auto it = entries.find(resource);
+    if (it == entries.end())
+        return;
+
+    Entry& entry = it->second;
+    const TextureImporter::Level& base = entry.levels[0];
+    float texels = (float)std::max(base.width, base.height);
+
+    // Un texel por píxel: cada mip por encima del necesario es VRAM desperdiciada
+    int mip = 0;
+    if (screenPixels > 0.0f && texels > screenPixels)
+        mip = (int)std::floor(std::log2(texels / screenPixels));
+    mip = std::min(mip, (int)entry.levels.size() - 1);
+
+    if (entry.lastUsedFrame != frame)
+        entry.requestedMip = mip;
+    else
+        entry.requestedMip = std::min(entry.requestedMip, mip);
+    entry.lastUsedFrame = frame;
+}
+
+void TextureStreamer::Update()
+{
+    // Las peticiones del frame anterior ya están hechas; las nuevas se marcarán con este número
+    uint64_t requestFrame = frame;
+    frame++;
+
+    for (auto it = entries.begin(); it != entries.end();)
+    {
+        if (it->second.resource.expired())
+        {
+            residentBytes -= ResidentSize(it->second, it->second.residentMip);
+            it = entries.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    if (!enabled)
+        return;
+
+    // Lo que lleva keepFrames sin dibujarse vuelve a sus mips iniciales
+    std::vector<Entry*> wanting;
+    std::vector<Entry*> idle;
+    for (auto& pair : entries)
+    {
+        Entry& entry = pair.second;
+        bool recentlyUsed = entry.lastUsedFrame + keepFrames >= requestFrame;
+        int target = recentlyUsed ? entry.requestedMip : entry.initialMip;
+
+        if (target < entry.residentMip)
+            wanting.push_back(&entry);
+        else if (!recentlyUsed && entry.residentMip < entry.initialMip)
+            idle.push_back(&entry);
+    }
+
+    for (Entry* entry : idle)
+        Evict(*entry, entry->initialMip);
+
+    // Primero las que más mips les faltan
+    std::sort(wanting.begin(), wanting.end(), [](const Entry* a, const Entry* b)
+    {
+        return (a->residentMip - a->requestedMip) > (b->residentMip - b->requestedMip);
+    });
+
+    size_t budget = streamBudgetBytes;
+    for (Entry* entry : wanting)
+    {
+        while (budget > 0 && entry->residentMip > entry->requestedMip)
+        {
+            size_t levelSize = entry->levels[entry->residentMip - 1].size;
+
+            // Sin sitio: soltar mips de la textura usada hace más tiempo
+            while (residentBytes + levelSize > vramBudgetBytes)
+            {
+                Entry* victim = nullptr;
+                for (auto& pair : entries)
+                {
+                    // Las que se dibujan este frame solo ceden los mips que les sobran
+                    Entry& candidate = pair.second;
+                    if (&candidate == entry || candidate.residentMip >= candidate.initialMip)
+                        continue;
+                    if (candidate.lastUsedFrame == requestFrame && candidate.residentMip >= candidate.requestedMip)
+                        continue;
+                    if (!victim || candidate.lastUsedFrame < victim->lastUsedFrame)
+                        victim = &candidate;
+                }
+                if (!victim || !Evict(*victim, victim->residentMip + 1))
+                    break;
+            }
+            if (residentBytes + levelSize > vramBudgetBytes)
+                return;
+
+            if (!StreamIn(*entry))
+                break;
+            budget = levelSize >= budget ? 0 : budget - levelSize;
+        }
+    }
+}
+
+bool TextureStreamer::StreamIn(Entry& entry)
+{
+    std::shared_ptr<TextureResource> resource = entry.resource.lock();
+    if (!resource || resource->id == 0)
+        return false;
+
+    VirtualFile file = VirtualFileSystem::Open(entry.sourcePath);
+    TextureImporter::CompressedImage image;
+    if (!file.IsOpen() || !TextureContainer::Parse(file.Data(), file.Size(), image, entry.sourcePath)
+        || image.levels.size() != entry.levels.size())
+    {
+        LOG_WARN(TEXTURE, "Source changed or missing, streaming stopped: {}", entry.sourcePath);
+        entry.requestedMip = entry.residentMip;
+        entry.initialMip = entry.residentMip;
+        return false;
+    }
+
+    // El mip nuevo se define en la misma textura y se baja el nivel base
+    int mip = entry.residentMip - 1;
+    const TextureImporter::Level& level = image.levels[mip];
+    glBindTexture(GL_TEXTURE_2D, resource->id);
+    glCompressedTexImage2D(GL_TEXTURE_2D, mip, TextureImporter::GetGLFormat(image.format), level.width, level.height,
+        0, (GLsizei)level.size, image.GetBytes() + level.offset);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, mip);
+
+    entry.residentMip = mip;
+    residentBytes += level.size;
+    resource->TrackResidency(ResidentSize(entry, mip), true);
+    return true;
+}
+
+bool TextureStreamer::Evict(Entry& entry, int newResidentMip)
+{
+    std::shared_ptr<TextureResource> resource = entry.resource.lock();
+    newResidentMip = std::min(newResidentMip, (int)entry.levels.size() - 1);
+    if (!resource || resource->id == 0 || newResidentMip <= entry.residentMip)
+        return false;
+
+    VirtualFile file = VirtualFileSystem::Open(entry.sourcePath);
+    TextureImporter::CompressedImage image;
+    if (!file.IsOpen() || !TextureContainer::Parse(file.Data(), file.Size(), image, entry.sourcePath)
+        || image.levels.size() != entry.levels.size())
+        return false;
+
+    // GL no libera niveles sueltos: se crea la textura de nuevo solo con los mips que quedan
+    const GLenum glFormat = TextureImporter::GetGLFormat(image.format);
+    GLuint texID;
+    glGenTextures(1, &texID);
+    glBindTexture(GL_TEXTURE_2D, texID);
+    for (size_t mip = newResidentMip; mip < image.levels.size(); ++mip)
+    {
+        const TextureImporter::Level& level = image.levels[mip];
+        glCompressedTexImage2D(GL_TEXTURE_2D, (GLint)mip, glFormat, level.width, level.height,
+            0, (GLsizei)level.size, image.GetBytes() + level.offset);
+    }
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, newResidentMip);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, (GLint)image.levels.size() - 1);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+    glDeleteTextures(1, &resource->id);
+    resource->id = texID;
+
+    residentBytes -= ResidentSize(entry, entry.residentMip) - ResidentSize(entry, newResidentMip);
+    entry.residentMip = newResidentMip;
+    resource->TrackResidency(ResidentSize(entry, newResidentMip), true);
+    return true;
+}
+
+bool TextureStreamer::ReleaseMips(const TextureResource* resource)
+{
+    auto it = entries.find(resource);
+    if (it == entries.end())
+        return false;
+    return Evict(it->second, it->second.initialMip);
+}
+
+void TextureStreamer::Clear()
+{
+    entries.clear();
+    residentBytes = 0;
+}
+
+int TextureStreamer::GetResidentMip(const TextureResource* resource)
+{
+    auto it = entries.find(resource);
+    return it != entries.end() ? it->second.residentMip : -1;
+}
+
+size_t TextureStreamer::GetFullBytes()
+{
+    size_t total = 0;
+    for (const auto& pair : entries)
+        total += ResidentSize(pair.second, 0);
+    return total;
+}
+
+size_t TextureStreamer::ResidentSize(const Entry& entry, int fromMip)
+{
+    size_t total = 0;
+    for (size_t mip = (size_t)std::max(0, fromMip); mip < entry.levels.size(); ++mip)
+        total += entry.levels[mip].size;
+    return total;
+}
@@ -0,0 +1,68 @@
+#pragma once
+#include <glad/glad.h>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include "TextureImporter.h"
+
+class TextureResource;
+
+// Residencia por mips de las texturas comprimidas que tienen un .dds/.ktx2 en
+// disco. Al cargar solo se suben los mips pequeños; el render pide cada frame
+// el tamaño en pantalla de los objetos que usan la textura y aquí se suben los
+// mips grandes que hagan falta (o se sueltan si se pasa del budget de VRAM).
+class TextureStreamer
+{
+public:
+    static bool enabled;
+    static size_t vramBudgetBytes;      // budget para el total de texturas en streaming
+    static size_t streamBudgetBytes;    // bytes que se pueden subir por frame
+    static int initialMaxSize;          // al cargar, solo mips de hasta este tamaño
+    static unsigned int keepFrames;     // frames sin usarse antes de soltar mips
+
+    // Primer mip que se sube al cargar (el mayor cuyo lado no pasa de initialMaxSize)
+    static int GetInitialMip(const std::vector<TextureImporter::Level>& levels);
+
+    // La textura ya tiene subidos los mips [residentMip, último]
+    static void Register(const std::shared_ptr<TextureResource>& resource, const std::string& sourcePath,
+        TextureImporter::Format format, const std::vector<TextureImporter::Level>& levels, int residentMip);
+
+    // Desde el render: el objeto que usa la textura ocupa screenPixels de alto
+    static void RequestSize(const TextureResource* resource, float screenPixels);
+
+    // Sube o suelta mips según lo pedido este frame (hilo principal, una vez por frame)
+    static void Update();
+    static void Clear();
+
+    // Vuelve a dejar solo los mips iniciales (lo usa ResidencyManager al expulsar)
+    static bool ReleaseMips(const TextureResource* resource);
+
+    // -1 si la textura no está en streaming
+    static int GetResidentMip(const TextureResource* resource);
+    static size_t GetStreamedCount() { return entries.size(); }
+    static size_t GetResidentBytes() { return residentBytes; }
+    static size_t GetFullBytes();
+
+private:
+    struct Entry
+    {
+        std::weak_ptr<TextureResource> resource;
+        std::string sourcePath;
+        TextureImporter::Format format = TextureImporter::Format::NONE;
+        std::vector<TextureImporter::Level> levels;
+        int initialMip = 0;
+        int residentMip = 0;
+        int requestedMip = 0;       // el menor pedido este frame
+        uint64_t lastUsedFrame = 0;
+    };
+
+    static size_t ResidentSize(const Entry& entry, int fromMip);
+    static bool StreamIn(Entry& entry);
+    static bool Evict(Entry& entry, int newResidentMip);
+
+    static std::map<const TextureResource*, Entry> entries;
+    static size_t residentBytes;
+    static uint64_t frame;
+};
@@ -0,0 +1,438 @@
+#include "VirtualFileSystem.h"
+#include "FileUtils.h"
+#include "Logger.h"
+#include <zlib.h>
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+
+std::vector<VirtualFileSystem::MountPoint> VirtualFileSystem::mounts;
+std::map<std::string, VirtualFileSystem::Entry> VirtualFileSystem::index;
+std::multimap<std::string, std::string> VirtualFileSystem::byName;
+std::mutex VirtualFileSystem::mutex;
+
+namespace
+{
+    // Formato zip (little endian)
+    const uint32_t ZIP_LOCAL_HEADER = 0x04034b50;
+    const uint32_t ZIP_CENTRAL_HEADER = 0x02014b50;
+    const uint32_t ZIP_END_OF_CENTRAL = 0x06054b50;
+    const size_t ZIP_LOCAL_HEADER_SIZE = 30;
+    const size_t ZIP_CENTRAL_HEADER_SIZE = 46;
+    const size_t ZIP_END_SIZE = 22;
+
+    uint16_t Read16(const unsigned char* p) { return (uint16_t)(p[0] | (p[1] << 8)); }
+    uint32_t Read32(const unsigned char* p) { return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24); }
+
+    void Write16(std::vector<unsigned char>& out, uint16_t v)
+    {
+        out.push_back((unsigned char)(v & 0xFF));
+        out.push_back((unsigned char)(v >> 8));
+    }
+
+    void Write32(std::vector<unsigned char>& out, uint32_t v)
+    {
+        for (int i = 0; i < 4; ++i)
+            out.push_back((unsigned char)((v >> (8 * i)) & 0xFF));
+    }
+
+    std::string FileName(const std::string& path)
+    {
+        size_t slash = path.find_last_of('/');
+        return slash == std::string::npos ? path : path.substr(slash + 1);
+    }
+}
+
+bool VirtualFileSystem::Mount(const std::string& mountPoint, const std::string& source)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    MountPoint mount;
+    mount.info.mountPoint = mountPoint;
+    mount.info.source = source;
+
+    std::string prefix = FileUtils::NormalizePath(mountPoint);
+    if (!prefix.empty())
+        prefix += '/';
+
+    int mountIndex = (int)mounts.size();
+    bool mounted = FileUtils::IsDirectory(source)
+        ? MountDirectory(mount, mountIndex, prefix)
+        : MountPack(mount, mountIndex, prefix);
+    if (!mounted)
+        return false;
+
+    LOG_INFO(ENGINE, "Mounted {} at {} ({} files)", source, mountPoint, mount.info.fileCount);
+    mounts.push_back(std::move(mount));
+    return true;
+}
+
+bool VirtualFileSystem::MountDirectory(MountPoint& mount, int mountIndex, const std::string& prefix)
+{
+    for (const std::string& relative : FileUtils::ListFiles(mount.info.source))
+    {
+        std::string key = prefix + FileUtils::NormalizePath(relative);
+        if (index.find(key) == index.end())
+            byName.emplace(FileName(key), key);
+
+        Entry& entry = index[key];
+        entry = Entry();
+        entry.mount = mountIndex;
+        entry.diskPath = mount.info.source + "/" + relative;
+        mount.info.fileCount++;
+    }
+    return true;
+}
+
+bool VirtualFileSystem::MountPack(MountPoint& mount, int mountIndex, const std::string& prefix)
+{
+    std::shared_ptr<MappedFile> archive = std::make_shared<MappedFile>(mount.info.source);
+    if (!archive->IsOpen() || archive->Size() < ZIP_END_SIZE)
+    {
+        LOG_ERROR(ENGINE, "Could not open pack: {}", mount.info.source);
+        return false;
+    }
+
+    const unsigned char* data = archive->Data();
+    const size_t fileSize = archive->Size();
+
+    // El final del directorio central está en los últimos 22 bytes + comentario (máx. 64 KB)
+    size_t end = std::string::npos;
+    size_t searchStart = fileSize > ZIP_END_SIZE + 0xFFFF ? fileSize - ZIP_END_SIZE - 0xFFFF : 0;
+    for (size_t pos = fileSize - ZIP_END_SIZE + 1; pos-- > searchStart;)
+    {
+        if (Read32(data + pos) == ZIP_END_OF_CENTRAL)
+        {
+            end = pos;
+            break;
+        }
+    }
+    if (end == std::string::npos)
+    {
+        LOG_ERROR(ENGINE, "Not a zip pack: {}", mount.info.source);
+        return false;
+    }
+
+    const uint16_t entryCount = Read16(data + end + 10);
+    const uint32_t directorySize = Read32(data + end + 12);
+    const uint32_t directoryOffset = Read32(data + end + 16);
+    if (directoryOffset == 0xFFFFFFFF || (size_t)directoryOffset + directorySize > end)
+    {
+        LOG_ERROR(ENGINE, "Unsupported or corrupt pack (zip64?): {}", mount.info.source);
+        return false;
+    }
+
+    // Primero se valida todo el directorio y después se añade al índice
+    std::vector<std::pair<std::string, Entry>> entries;
+    size_t pos = directoryOffset;
+    for (uint16_t i = 0; i < entryCount; ++i)
+    {
+        if (pos + ZIP_CENTRAL_HEADER_SIZE > end || Read32(data + pos) != ZIP_CENTRAL_HEADER)
+        {
+            LOG_ERROR(ENGINE, "Corrupt central directory in {}", mount.info.source);
+            return false;
+        }
+
+        const uint16_t method = Read16(data + pos + 10);
+        const uint32_t compressedSize = Read32(data + pos + 20);
+        const uint32_t size = Read32(data + pos + 24);
+        const uint16_t nameLength = Read16(data + pos + 28);
+        const uint16_t extraLength = Read16(data + pos + 30);
+        const uint16_t commentLength = Read16(data + pos + 32);
+        const uint32_t localOffset = Read32(data + pos + 42);
+
+        if (pos + ZIP_CENTRAL_HEADER_SIZE + nameLength > end)
+        {
+            LOG_ERROR(ENGINE, "Corrupt central directory in {}", mount.info.source);
+            return false;
+        }
+        std::string name((const char*)data + pos + ZIP_CENTRAL_HEADER_SIZE, nameLength);
+        pos += ZIP_CENTRAL_HEADER_SIZE + nameLength + extraLength + commentLength;
+
+        // Carpetas
+        if (name.empty() || name.back() == '/')
+            continue;
+
+        if (method != STORED && method != DEFLATED)
+        {
+            LOG_WARN(ENGINE, "Skipping {}: unsupported compression {}", name, method);
+            continue;
+        }
+
+        // Open sirve los STORED directamente con size: solo se ha comprobado compressedSize
+        if (method == STORED && size != compressedSize)
+        {
+            LOG_ERROR(ENGINE, "Corrupt stored entry {}: size {} != compressed size {}", name, size, compressedSize);
+            return false;
+        }
+
+        // La cabecera local puede tener un campo extra distinto al del directorio central
+        if ((size_t)localOffset + ZIP_LOCAL_HEADER_SIZE > directoryOffset || Read32(data + localOffset) != ZIP_LOCAL_HEADER)
+        {
+            LOG_ERROR(ENGINE, "Corrupt local header for {}", name);
+            return false;
+        }
+        size_t dataOffset = (size_t)localOffset + ZIP_LOCAL_HEADER_SIZE
+            + Read16(data + localOffset + 26) + Read16(data + localOffset + 28);
+        if (dataOffset + compressedSize > directoryOffset)
+        {
+            LOG_ERROR(ENGINE, "Truncated data for {}", name);
+            return false;
+        }
+
+        Entry entry;
+        entry.mount = mountIndex;
+        entry.offset = dataOffset;
+        entry.compressedSize = compressedSize;
+        entry.size = size;
+        entry.method = method;
+        entries.emplace_back(prefix + FileUtils::NormalizePath(name), entry);
+    }
+
+    for (const auto& pair : entries)
+    {
+        if (index.find(pair.first) == index.end())
+            byName.emplace(FileName(pair.first), pair.first);
+        index[pair.first] = pair.second;
+        mount.info.bytes += pair.second.size;
+    }
+
+    mount.info.isPack = true;
+    mount.info.fileCount = entries.size();
+    mount.archive = archive;
+    return true;
+}
+
+void VirtualFileSystem::UnmountAll()
+{
+    // Los VirtualFile abiertos conservan su paquete hasta que se destruyen
+    std::lock_guard<std::mutex> lock(mutex);
+    mounts.clear();
+    index.clear();
+    byName.clear();
+}
+
+const VirtualFileSystem::Entry* VirtualFileSystem::Find(const std::string& normalizedPath)
+{
+    auto it = index.find(normalizedPath);
+    return it != index.end() ? &it->second : nullptr;
+}
+
+bool VirtualFileSystem::Exists(const std::string& path)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (Find(FileUtils::NormalizePath(path)))
+            return true;
+    }
+    return FileUtils::Exists(path);
+}
+
+VirtualFile VirtualFileSystem::Open(const std::string& path)
+{
+    VirtualFile file;
+
+    Entry entry;
+    std::shared_ptr<MappedFile> archive;
+    bool found = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (const Entry* indexed = Find(FileUtils::NormalizePath(path)))
+        {
+            entry = *indexed;
+            archive = mounts[indexed->mount].archive;
+            found = true;
+        }
+    }
+
+    if (!found || !archive)
+    {
+        // Fuera de los montajes o dentro de una carpeta montada: archivo suelto en disco
+        if (file.mapped.Open(found ? entry.diskPath : path))
+        {
+            file.data = file.mapped.Data();
+            file.size = file.mapped.Size();
+        }
+        return file;
+    }
+
+    file.archive = archive;
+    if (entry.method == STORED)
+    {
+        // Sin copia: el puntero va directamente a las páginas del paquete
+        file.data = archive->Data() + entry.offset;
+        file.size = entry.size;
+        return file;
+    }
+
+    file.buffer.resize(entry.size);
+    z_stream stream = {};
+    stream.next_in = (Bytef*)(archive->Data() + entry.offset);
+    stream.avail_in = (uInt)entry.compressedSize;
+    stream.next_out = file.buffer.data();
+    stream.avail_out = (uInt)entry.size;
+
+    bool ok = inflateInit2(&stream, -MAX_WBITS) == Z_OK;
+    ok = ok && inflate(&stream, Z_FINISH) == Z_STREAM_END && stream.total_out == entry.size;
+    inflateEnd(&stream);
+
+    if (!ok || entry.size == 0)
+    {
+        LOG_ERROR(ENGINE, "Could not inflate {}", path);
+        file.buffer.clear();
+        return file;
+    }
+
+    file.data = file.buffer.data();
+    file.size = file.buffer.size();
+    return file;
+}
+
+std::string VirtualFileSystem::Locate(const std::string& reference, const std::string& directory)
+{
+    std::string direct = directory.empty() ? reference : directory + "/" + reference;
+    if (Exists(direct))
+        return direct;
+    if (Exists(reference))
+        return reference;
+
+    // Por nombre: de los archivos que se llaman igual, el que comparte más ruta con directory
+    std::string name = FileName(FileUtils::NormalizePath(reference));
+    std::string normalizedDirectory = FileUtils::NormalizePath(directory);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    std::string best;
+    size_t bestShared = 0;
+    auto range = byName.equal_range(name);
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        const std::string& candidate = it->second;
+        size_t shared = 0;
+        while (shared < candidate.size() && shared < normalizedDirectory.size() && candidate[shared] == normalizedDirectory[shared])
+            shared++;
+        if (best.empty() || shared > bestShared)
+        {
+            best = candidate;
+            bestShared = shared;
+        }
+    }
+    return best;
+}
+
+bool VirtualFileSystem::BuildPack(const std::string& directory, const std::string& packPath)
+{
+    std::vector<std::string> files = FileUtils::ListFiles(directory);
+    std::string tmpPath = FileUtils::MakeTempPath(packPath);
+    std::ofstream out(tmpPath, std::ios::binary | std::ios::trunc);
+    if (!out)
+    {
+        LOG_ERROR(ENGINE, "Could not write pack: {}", packPath);
+        return false;
+    }
+
+    std::vector<unsigned char> central;
+    std::vector<unsigned char> header;
+    size_t offset = 0;
+    uint16_t count = 0;
+
+    for (const std::string& relative : files)
+    {
+        MappedFile source(directory + "/" + relative);
+        size_t size = source.IsOpen() ? source.Size() : 0;
+        if (count == 0xFFFF || offset + size >= 0xFFFFFFFFull)
+        {
+            LOG_WARN(ENGINE, "Pack too large (zip64 not supported), stopped at {}", relative);
+            break;
+        }
+
+        uint32_t crc = (uint32_t)crc32(0L, Z_NULL, 0);
+        if (size > 0)
+            crc = (uint32_t)crc32(crc, source.Data(), (uInt)size);
+
+        // Cabecera local + datos sin comprimir (STORED): se leen sin copia al montarlo
+        header.clear();
+        Write32(header, ZIP_LOCAL_HEADER);
+        Write16(header, 10);            // versión necesaria
+        Write16(header, 0);             // flags
+        Write16(header, STORED);
+        Write16(header, 0);             // hora
+        Write16(header, 0x21);          // fecha (1980-01-01)
+        Write32(header, crc);
+        Write32(header, (uint32_t)size);
+        Write32(header, (uint32_t)size);
+        Write16(header, (uint16_t)relative.size());
+        Write16(header, 0);
+        header.insert(header.end(), relative.begin(), relative.end());
+        out.write((const char*)header.data(), header.size());
+        if (size > 0)
+            out.write((const char*)source.Data(), size);
+
+        Write32(central, ZIP_CENTRAL_HEADER);
+        Write16(central, 20);           // versión que lo creó
+        Write16(central, 10);
+        Write16(central, 0);
+        Write16(central, STORED);
+        Write16(central, 0);
+        Write16(central, 0x21);
+        Write32(central, crc);
+        Write32(central, (uint32_t)size);
+        Write32(central, (uint32_t)size);
+        Write16(central, (uint16_t)relative.size());
+        Write16(central, 0);            // extra
+        Write16(central, 0);            // comentario
+        Write16(central, 0);            // disco
+        Write16(central, 0);            // atributos internos
+        Write32(central, 0);            // atributos externos
+        Write32(central, (uint32_t)offset);
+        central.insert(central.end(), relative.begin(), relative.end());
+
+        offset += header.size() + size;
+        count++;
+    }
+
+    std::vector<unsigned char> tail;
+    Write32(tail, ZIP_END_OF_CENTRAL);
+    Write16(tail, 0);
+    Write16(tail, 0);
+    Write16(tail, count);
+    Write16(tail, count);
+    Write32(tail, (uint32_t)central.size());
+    Write32(tail, (uint32_t)offset);
+    Write16(tail, 0);
+
+    out.write((const char*)central.data(), central.size());
+    out.write((const char*)tail.data(), tail.size());
+    out.close();
+    if (!out)
+    {
+        std::remove(tmpPath.c_str());
+        LOG_ERROR(ENGINE, "Could not write pack: {}", packPath);
+        return false;
+    }
+
+    // Si el paquete está montado (y proyectado) en Windows no se puede reemplazar;
+    // en ese caso el paquete anterior sigue intacto
+    if (!FileUtils::RenameOver(tmpPath, packPath))
+    {
+        LOG_ERROR(ENGINE, "Could not replace {} (is it mounted?)", packPath);
+        return false;
+    }
+
+    LOG_INFO(ENGINE, "Built pack {}: {} files, {} KB", packPath, count, offset / 1024);
+    return true;
+}
+
+std::vector<VirtualFileSystem::MountInfo> VirtualFileSystem::GetMounts()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    std::vector<MountInfo> result;
+    for (const MountPoint& mount : mounts)
+        result.push_back(mount.info);
+    return result;
+}
+
+size_t VirtualFileSystem::GetFileCount()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return index.size();
+}
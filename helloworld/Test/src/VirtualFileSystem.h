@@ -0,0 +1,98 @@
+#pragma once
+#include "MappedFile.h"
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+// Archivo abierto a través del VFS. Data() apunta al archivo proyectado en
+// disco, directamente dentro del paquete (entradas sin comprimir) o a un
+// buffer propio si la entrada del paquete venía comprimida.
+class VirtualFile
+{
+    friend class VirtualFileSystem;
+
+public:
+    VirtualFile() = default;
+    VirtualFile(VirtualFile&&) = default;
+    VirtualFile& operator=(VirtualFile&&) = default;
+
+    bool IsOpen() const { return data != nullptr; }
+    const unsigned char* Data() const { return data; }
+    size_t Size() const { return size; }
+    bool IsPacked() const { return archive != nullptr; }
+
+private:
+    MappedFile mapped;
+    std::shared_ptr<MappedFile> archive;    // mantiene el paquete proyectado
+    std::vector<unsigned char> buffer;
+    const unsigned char* data = nullptr;
+    size_t size = 0;
+};
+
+// Sistema de archivos virtual. Cada punto de montaje expone una carpeta o un
+// paquete .pak (zip) bajo una ruta; las rutas que ya usa el motor ("../Assets/...")
+// siguen funcionando montando el paquete en esa misma ruta. Al montar se indexan
+// todos los archivos, así que buscar uno no toca el disco, y los paquetes se
+// proyectan en memoria una sola vez para todos sus archivos.
+// Lo que no está montado (p. ej. la caché de Library) se lee directamente del disco.
+class VirtualFileSystem
+{
+public:
+    // Monta una carpeta o un .pak en mountPoint. Los montajes posteriores tienen
+    // prioridad sobre los anteriores para las rutas que coinciden.
+    static bool Mount(const std::string& mountPoint, const std::string& source);
+    static void UnmountAll();
+
+    static bool Exists(const std::string& path);
+    static VirtualFile Open(const std::string& path);
+
+    // Busca un archivo referenciado desde otro (p. ej. la textura de un FBX):
+    // primero relativo a directory y si no, por nombre en todo el índice,
+    // prefiriendo el más cercano a directory. Devuelve "" si no existe.
+    static std::string Locate(const std::string& reference, const std::string& directory);
+
+    // Empaqueta una carpeta en un zip sin compresión (para leerlo sin copias)
+    static bool BuildPack(const std::string& directory, const std::string& packPath);
+
+    struct MountInfo
+    {
+        std::string mountPoint;
+        std::string source;
+        bool isPack = false;
+        size_t fileCount = 0;
+        size_t bytes = 0;
+    };
+    static std::vector<MountInfo> GetMounts();
+    static size_t GetFileCount();
+
+private:
+    enum Method : uint16_t { STORED = 0, DEFLATED = 8 };
+
+    struct Entry
+    {
+        int mount = -1;
+        std::string diskPath;       // montajes de carpeta
+        size_t offset = 0;          // montajes de paquete: datos dentro del .pak
+        size_t compressedSize = 0;
+        size_t size = 0;
+        uint16_t method = STORED;
+    };
+
+    struct MountPoint
+    {
+        MountInfo info;
+        std::shared_ptr<MappedFile> archive;
+    };
+
+    static bool MountDirectory(MountPoint& mount, int mountIndex, const std::string& prefix);
+    static bool MountPack(MountPoint& mount, int mountIndex, const std::string& prefix);
+    static const Entry* Find(const std::string& normalizedPath);
+
+    static std::vector<MountPoint> mounts;
+    static std::map<std::string, Entry> index;                  // ruta normalizada -> entrada
+    static std::multimap<std::string, std::string> byName;      // nombre de archivo -> ruta normalizada
+    static std::mutex mutex;
+};
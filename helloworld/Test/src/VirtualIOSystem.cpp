@@ -0,0 +1,50 @@
+#include "VirtualIOSystem.h"
+#include <algorithm>
+#include <cstring>
+
+size_t VirtualIOStream::Read(void* buffer, size_t size, size_t count)
+{
+    if (size == 0 || position >= file.Size())
+        return 0;
+
+    // Solo elementos completos, como fread
+    size_t available = (file.Size() - position) / size;
+    size_t elements = std::min(count, available);
+    memcpy(buffer, file.Data() + position, elements * size);
+    position += elements * size;
+    return elements;
+}
+
+aiReturn VirtualIOStream::Seek(size_t offset, aiOrigin origin)
+{
+    size_t target = 0;
+    switch (origin)
+    {
+    case aiOrigin_SET: target = offset; break;
+    case aiOrigin_CUR: target = position + offset; break;
+    case aiOrigin_END: target = file.Size() - offset; break;
+    default: return aiReturn_FAILURE;
+    }
+
+    if (target > file.Size())
+        return aiReturn_FAILURE;
+    position = target;
+    return aiReturn_SUCCESS;
+}
+
+bool VirtualIOSystem::Exists(const char* path) const
+{
+    return path && VirtualFileSystem::Exists(path);
+}
+
+Assimp::IOStream* VirtualIOSystem::Open(const char* path, const char* mode)
+{
+    // Los montajes son de solo lectura
+    if (!path || (mode && (strchr(mode, 'w') || strchr(mode, 'a') || strchr(mode, '+'))))
+        return nullptr;
+
+    VirtualFile file = VirtualFileSystem::Open(path);
+    if (!file.IsOpen())
+        return nullptr;
+    return new VirtualIOStream(std::move(file));
+}
@@ -0,0 +1,33 @@
+#pragma once
+#include "VirtualFileSystem.h"
+#include <assimp/IOSystem.hpp>
+#include <assimp/IOStream.hpp>
+
+// Lectura de Assimp a través del VFS: los modelos (y sus .mtl, binarios, etc.)
+// se leen de las carpetas o paquetes montados igual que las texturas
+class VirtualIOStream : public Assimp::IOStream
+{
+public:
+    explicit VirtualIOStream(VirtualFile&& file) : file(std::move(file)) {}
+
+    size_t Read(void* buffer, size_t size, size_t count) override;
+    // Solo lectura
+    size_t Write(const void*, size_t, size_t) override { return 0; }
+    aiReturn Seek(size_t offset, aiOrigin origin) override;
+    size_t Tell() const override { return position; }
+    size_t FileSize() const override { return file.Size(); }
+    void Flush() override {}
+
+private:
+    VirtualFile file;
+    size_t position = 0;
+};
+
+class VirtualIOSystem : public Assimp::IOSystem
+{
+public:
+    bool Exists(const char* path) const override;
+    char getOsSeparator() const override { return '/'; }
+    Assimp::IOStream* Open(const char* path, const char* mode = "rb") override;
+    void Close(Assimp::IOStream* stream) override { delete stream; }
+};
@@ -14,6 +14,11 @@ bool Window::Start()
 {
     std::cout << "Init SDL3 Window" << std::endl;
 
+    // El driver offscreen crea el contexto con EGL (surfaceless con Mesa/llvmpipe).
+    // Prioridad normal: SDL_VIDEO_DRIVER en el entorno sigue mandando
+    if (headless)
+        SDL_SetHint(SDL_HINT_VIDEO_DRIVER, "offscreen");
+
     if (!SDL_Init(SDL_INIT_VIDEO))
     {
         std::cerr << "SDL_Init failed! SDL Error: " << SDL_GetError() << std::endl;
@@ -30,7 +35,7 @@ bool Window::Start()
         "SDL3 OpenGL Window",
         width,
         height,
-        SDL_WINDOW_OPENGL | SDL_WINDOW_RESIZABLE
+        headless ? SDL_WINDOW_OPENGL | SDL_WINDOW_HIDDEN : SDL_WINDOW_OPENGL | SDL_WINDOW_RESIZABLE
     );
 
     if (window == nullptr)
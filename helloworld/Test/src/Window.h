@@ -13,6 +13,8 @@ public:
     bool PostUpdate() override;
     bool CleanUp() override;
     bool vsync = true; 
+    // Sin pantalla (benchmark en CI): ventana oculta con el driver offscreen de SDL
+    bool headless = false;
     void Render();
     void GetWindowSize(int& width, int& height) const;
     int GetScale() const;
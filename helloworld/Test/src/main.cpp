@@ -8,6 +8,16 @@ int main(int argc, char* argv[])
 
     Application& app = Application::GetInstance();
 
+    // --benchmark: sin ventana visible, mide la escena y sale (código 0 si escribió el JSON)
+    ModuleBenchmark::Options benchmarkOptions;
+    if (!ModuleBenchmark::ParseArgs(argc, argv, benchmarkOptions))
+    {
+        ModuleBenchmark::PrintUsage();
+        return -1;
+    }
+    if (benchmarkOptions.enabled)
+        app.EnableBenchmark(benchmarkOptions);
+
     // Awake
     if (!app.Awake())
     {
@@ -34,5 +44,7 @@ int main(int argc, char* argv[])
 
     std::cout << "Application closed successfully" << std::endl;
 
+    if (app.benchmark)
+        return app.benchmark->Succeeded() ? 0 : 1;
     return 0;
 }
\ No newline at end of file